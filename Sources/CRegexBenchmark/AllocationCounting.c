@@ -0,0 +1,132 @@
+//===----------------------------------------------------------------------===//
+//
+// This source file is part of the Swift.org open source project
+//
+// Copyright (c) 2025 Apple Inc. and the Swift project authors
+// Licensed under Apache License v2.0 with Runtime Library Exception
+//
+// See https://swift.org/LICENSE.txt for license information
+//
+//===----------------------------------------------------------------------===//
+
+#include "include/AllocationCounting.h"
+
+#include <errno.h>
+#include <stdatomic.h>
+#include <stddef.h>
+#include <stdlib.h>
+
+// The counters are updated with relaxed atomics, since allocations can come
+// from any thread and only the totals are read.
+static atomic_bool isCounting;
+static atomic_uint_fast64_t allocationCount;
+static atomic_uint_fast64_t allocationBytes;
+
+static inline void recordAllocation(size_t size) {
+  if (atomic_load_explicit(&isCounting, memory_order_relaxed)) {
+    atomic_fetch_add_explicit(&allocationCount, 1, memory_order_relaxed);
+    atomic_fetch_add_explicit(&allocationBytes, size, memory_order_relaxed);
+  }
+}
+
+#if defined(__APPLE__)
+
+// libmalloc calls the malloc logger after every allocation and deallocation
+// in any zone. It's what malloc stack logging uses, and isn't declared in
+// the SDK.
+typedef void(malloc_logger_t)(uint32_t type, uintptr_t arg1, uintptr_t arg2,
+                              uintptr_t arg3, uintptr_t result,
+                              uint32_t num_hot_frames_to_skip);
+extern malloc_logger_t *malloc_logger;
+
+#define MALLOC_LOG_TYPE_ALLOCATE 2
+#define MALLOC_LOG_TYPE_DEALLOCATE 4
+
+static void countingLogger(uint32_t type, uintptr_t arg1, uintptr_t arg2,
+                           uintptr_t arg3, uintptr_t result,
+                           uint32_t num_hot_frames_to_skip) {
+  if (!(type & MALLOC_LOG_TYPE_ALLOCATE)) {
+    return;
+  }
+  // A reallocation passes the old pointer before the new size.
+  recordAllocation(type & MALLOC_LOG_TYPE_DEALLOCATE ? arg3 : arg2);
+}
+
+bool regex_benchmark_canCountAllocations(void) { return true; }
+
+#elif defined(__GLIBC__)
+
+// Definitions in the executable take precedence over the C library's, so
+// these see every allocation in the process, and forward to glibc's
+// implementations under their internal names.
+extern void *__libc_malloc(size_t size);
+extern void *__libc_calloc(size_t count, size_t size);
+extern void *__libc_realloc(void *ptr, size_t size);
+extern void *__libc_memalign(size_t alignment, size_t size);
+
+void *malloc(size_t size) {
+  recordAllocation(size);
+  return __libc_malloc(size);
+}
+
+void *calloc(size_t count, size_t size) {
+  recordAllocation(count * size);
+  return __libc_calloc(count, size);
+}
+
+void *realloc(void *ptr, size_t size) {
+  recordAllocation(size);
+  return __libc_realloc(ptr, size);
+}
+
+void *memalign(size_t alignment, size_t size) {
+  recordAllocation(size);
+  return __libc_memalign(alignment, size);
+}
+
+void *aligned_alloc(size_t alignment, size_t size) {
+  recordAllocation(size);
+  return __libc_memalign(alignment, size);
+}
+
+int posix_memalign(void **result, size_t alignment, size_t size) {
+  if (alignment % sizeof(void *) != 0 || (alignment & (alignment - 1)) != 0) {
+    return EINVAL;
+  }
+  recordAllocation(size);
+  void *ptr = __libc_memalign(alignment, size);
+  if (ptr == NULL && size != 0) {
+    return ENOMEM;
+  }
+  *result = ptr;
+  return 0;
+}
+
+bool regex_benchmark_canCountAllocations(void) { return true; }
+
+#else
+
+bool regex_benchmark_canCountAllocations(void) { return false; }
+
+#endif
+
+void regex_benchmark_startCountingAllocations(void) {
+  atomic_store(&allocationCount, 0);
+  atomic_store(&allocationBytes, 0);
+  atomic_store(&isCounting, true);
+#if defined(__APPLE__)
+  malloc_logger = countingLogger;
+#endif
+}
+
+regex_benchmark_allocations regex_benchmark_stopCountingAllocations(void) {
+#if defined(__APPLE__)
+  malloc_logger = NULL;
+#endif
+  atomic_store(&isCounting, false);
+  regex_benchmark_allocations result = {
+    atomic_load(&allocationCount),
+    atomic_load(&allocationBytes),
+  };
+  return result;
+}
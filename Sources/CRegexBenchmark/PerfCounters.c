@@ -0,0 +1,129 @@
+//===----------------------------------------------------------------------===//
+//
+// This source file is part of the Swift.org open source project
+//
+// Copyright (c) 2025 Apple Inc. and the Swift project authors
+// Licensed under Apache License v2.0 with Runtime Library Exception
+//
+// See https://swift.org/LICENSE.txt for license information
+//
+//===----------------------------------------------------------------------===//
+
+#include "include/PerfCounters.h"
+
+#if defined(__linux__)
+
+#include <linux/perf_event.h>
+#include <string.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+enum {
+  INSTRUCTIONS,
+  CYCLES,
+  BRANCH_MISSES,
+  L1D_MISSES,
+  LLC_MISSES,
+  EVENT_COUNT
+};
+
+#define CACHE_READ_MISS(cache)                                                 \
+  ((cache) | (PERF_COUNT_HW_CACHE_OP_READ << 8) |                             \
+   (PERF_COUNT_HW_CACHE_RESULT_MISS << 16))
+
+static const struct {
+  uint32_t type;
+  uint64_t config;
+} events[EVENT_COUNT] = {
+  [INSTRUCTIONS] = {PERF_TYPE_HARDWARE, PERF_COUNT_HW_INSTRUCTIONS},
+  [CYCLES] = {PERF_TYPE_HARDWARE, PERF_COUNT_HW_CPU_CYCLES},
+  [BRANCH_MISSES] = {PERF_TYPE_HARDWARE, PERF_COUNT_HW_BRANCH_MISSES},
+  [L1D_MISSES] = {PERF_TYPE_HW_CACHE, CACHE_READ_MISS(PERF_COUNT_HW_CACHE_L1D)},
+  [LLC_MISSES] = {PERF_TYPE_HW_CACHE, CACHE_READ_MISS(PERF_COUNT_HW_CACHE_LL)},
+};
+
+// The file descriptor of each event's counter, or -1 if it isn't open.
+static int fds[EVENT_COUNT] = {-1, -1, -1, -1, -1};
+
+bool regex_benchmark_openPerfCounters(void) {
+  bool opened = false;
+  for (int i = 0; i < EVENT_COUNT; i++) {
+    if (fds[i] >= 0) {
+      opened = true;
+      continue;
+    }
+    struct perf_event_attr attr;
+    memset(&attr, 0, sizeof(attr));
+    attr.size = sizeof(attr);
+    attr.type = events[i].type;
+    attr.config = events[i].config;
+    attr.disabled = 1;
+    attr.inherit = 1;
+    attr.exclude_kernel = 1;
+    attr.exclude_hv = 1;
+    attr.read_format =
+        PERF_FORMAT_TOTAL_TIME_ENABLED | PERF_FORMAT_TOTAL_TIME_RUNNING;
+    // Each event is opened on its own, rather than as a group, so that the
+    // others are still counted on machines without some of them.
+    fds[i] = (int)syscall(SYS_perf_event_open, &attr, 0, -1, -1, 0);
+    opened = opened || fds[i] >= 0;
+  }
+  return opened;
+}
+
+void regex_benchmark_startPerfCounters(void) {
+  for (int i = 0; i < EVENT_COUNT; i++) {
+    if (fds[i] >= 0) {
+      ioctl(fds[i], PERF_EVENT_IOC_RESET, 0);
+      ioctl(fds[i], PERF_EVENT_IOC_ENABLE, 0);
+    }
+  }
+}
+
+static int64_t readCounter(int fd) {
+  struct {
+    uint64_t value;
+    uint64_t timeEnabled;
+    uint64_t timeRunning;
+  } data;
+  if (fd < 0 || read(fd, &data, sizeof(data)) != sizeof(data)) {
+    return -1;
+  }
+  if (data.timeRunning == 0) {
+    return data.timeEnabled == 0 ? 0 : -1;
+  }
+  if (data.timeRunning < data.timeEnabled) {
+    return (int64_t)((double)data.value * data.timeEnabled / data.timeRunning);
+  }
+  return (int64_t)data.value;
+}
+
+regex_benchmark_perf_counts regex_benchmark_stopPerfCounters(void) {
+  for (int i = 0; i < EVENT_COUNT; i++) {
+    if (fds[i] >= 0) {
+      ioctl(fds[i], PERF_EVENT_IOC_DISABLE, 0);
+    }
+  }
+  regex_benchmark_perf_counts result = {
+    readCounter(fds[INSTRUCTIONS]),
+    readCounter(fds[CYCLES]),
+    readCounter(fds[BRANCH_MISSES]),
+    readCounter(fds[L1D_MISSES]),
+    readCounter(fds[LLC_MISSES]),
+  };
+  return result;
+}
+
+#else
+
+bool regex_benchmark_openPerfCounters(void) { return false; }
+
+void regex_benchmark_startPerfCounters(void) {}
+
+regex_benchmark_perf_counts regex_benchmark_stopPerfCounters(void) {
+  regex_benchmark_perf_counts result = {-1, -1, -1, -1, -1};
+  return result;
+}
+
+#endif
@@ -0,0 +1,40 @@
+//===----------------------------------------------------------------------===//
+//
+// This source file is part of the Swift.org open source project
+//
+// Copyright (c) 2025 Apple Inc. and the Swift project authors
+// Licensed under Apache License v2.0 with Runtime Library Exception
+//
+// See https://swift.org/LICENSE.txt for license information
+//
+//===----------------------------------------------------------------------===//
+
+#ifndef REGEX_BENCHMARK_ALLOCATION_COUNTING_H
+#define REGEX_BENCHMARK_ALLOCATION_COUNTING_H
+
+#include "stdbool.h"
+#include "stdint.h"
+
+/// The heap allocations made while counting was enabled.
+typedef struct {
+  /// The number of allocations, including reallocations.
+  uint64_t count;
+  /// The number of bytes requested by those allocations.
+  uint64_t bytes;
+} regex_benchmark_allocations;
+
+/// Whether allocations can be counted on this platform.
+///
+/// Allocations are counted by interposing the C allocator on glibc, and by
+/// installing the malloc logger on Darwin.
+bool regex_benchmark_canCountAllocations(void);
+
+/// Resets the counts and starts counting the allocations made by every
+/// thread.
+void regex_benchmark_startCountingAllocations(void);
+
+/// Stops counting, and returns the allocations made since the last call to
+/// `regex_benchmark_startCountingAllocations`.
+regex_benchmark_allocations regex_benchmark_stopCountingAllocations(void);
+
+#endif // REGEX_BENCHMARK_ALLOCATION_COUNTING_H
@@ -0,0 +1,45 @@
+//===----------------------------------------------------------------------===//
+//
+// This source file is part of the Swift.org open source project
+//
+// Copyright (c) 2025 Apple Inc. and the Swift project authors
+// Licensed under Apache License v2.0 with Runtime Library Exception
+//
+// See https://swift.org/LICENSE.txt for license information
+//
+//===----------------------------------------------------------------------===//
+
+#ifndef REGEX_BENCHMARK_PERF_COUNTERS_H
+#define REGEX_BENCHMARK_PERF_COUNTERS_H
+
+#include "stdbool.h"
+#include "stdint.h"
+
+/// The hardware events counted while the counters were running. Each count
+/// is `-1` if the event couldn't be counted.
+typedef struct {
+  int64_t instructions;
+  int64_t cycles;
+  int64_t branchMisses;
+  int64_t l1DataCacheMisses;
+  int64_t lastLevelCacheMisses;
+} regex_benchmark_perf_counts;
+
+/// Opens the hardware counters for the calling thread and the threads it
+/// creates afterwards, returning whether any event can be counted.
+///
+/// Counters are opened with `perf_event_open` on Linux, and are subject to
+/// `/proc/sys/kernel/perf_event_paranoid`. Other platforms have none.
+bool regex_benchmark_openPerfCounters(void);
+
+/// Resets and starts the open counters.
+void regex_benchmark_startPerfCounters(void);
+
+/// Stops the open counters, and returns the events counted since the last
+/// call to `regex_benchmark_startPerfCounters`.
+///
+/// Counts are scaled up if the kernel multiplexed the counters, so that
+/// they estimate the events over the whole time they were started.
+regex_benchmark_perf_counts regex_benchmark_stopPerfCounters(void);
+
+#endif // REGEX_BENCHMARK_PERF_COUNTERS_H
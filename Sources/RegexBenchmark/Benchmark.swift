@@ -45,6 +45,9 @@ extension SwiftRegexBenchmark {
   mutating func enableMetrics() {
     let _ = regex._forceAction(.addOptions([.enableMetrics]))
   }
+  mutating func enableThreadedCode() {
+    let _ = regex._forceAction(.addOptions(.enableThreadedCode))
+  }
 }
 
 struct Benchmark: SwiftRegexBenchmark {
@@ -113,6 +116,47 @@ struct InputListBenchmark: SwiftRegexBenchmark {
   }
 }
 
+/// A benchmark running a regex on strings in input set, reusing one match
+/// context for every string and only finding the offsets of each match and
+/// its captures
+struct InputListContextBenchmark: SwiftRegexBenchmark {
+  let name: String
+  var regex: Regex<AnyRegexOutput>
+  let pattern: String?
+  let targets: [String]
+
+  func run() {
+    var context = RegexMatchContext(regex)
+    var offsets = [Int](repeating: 0, count: 2 * (context.captureCount + 1))
+    offsets.withUnsafeMutableBufferPointer { offsets in
+      for target in targets {
+        blackHole(try! context.wholeMatch(in: target[...], offsets: offsets))
+      }
+    }
+  }
+}
+
+/// A benchmark finding all matches of a regex, as `matches(of:)` does, but
+/// only finding the offsets of each match and its captures
+struct MatchOffsetsBenchmark: SwiftRegexBenchmark {
+  let name: String
+  var regex: Regex<AnyRegexOutput>
+  let pattern: String?
+  let target: String
+
+  func run() {
+    var context = RegexMatchContext(regex)
+    var offsets = [Int](repeating: 0, count: 2 * (context.captureCount + 1))
+    var count = 0
+    offsets.withUnsafeMutableBufferPointer { offsets in
+      try! context.forEachMatch(in: target[...], offsets: offsets) {
+        count += 1
+      }
+    }
+    blackHole(count)
+  }
+}
+
 struct InputListNSBenchmark: RegexBenchmark {
   let name: String
   let regex: NSRegularExpression
@@ -136,10 +180,171 @@ struct InputListNSBenchmark: RegexBenchmark {
   }
 }
 
+/// A benchmark finding which of many regexes match each string in an input
+/// set, using a `RegexSet`
+struct RegexSetBenchmark: RegexBenchmark {
+  let name: String
+  let regexSet: RegexSet
+  let targets: [String]
+
+  func run() {
+    for target in targets {
+      blackHole(try! regexSet.matchingIndices(in: target))
+    }
+  }
+}
+
+/// A benchmark finding which of many regexes match each string in an input
+/// set, by searching with each regex in turn
+struct RegexListBenchmark: RegexBenchmark {
+  let name: String
+  let regexes: [Regex<AnyRegexOutput>]
+  let targets: [String]
+
+  func run() {
+    for target in targets {
+      blackHole(regexes.indices.filter {
+        target.firstMatch(of: regexes[$0]) != nil
+      })
+    }
+  }
+}
+
+/// A benchmark finding all matches of a regex, searching separate parts of
+/// the input concurrently
+struct ParallelMatchesBenchmark: RegexBenchmark {
+  let name: String
+  let regex: Regex<AnyRegexOutput>
+  let target: String
+
+  func run() {
+    blackHole(target.matches(
+      of: regex,
+      chunkCount: ProcessInfo.processInfo.activeProcessorCount,
+      concurrentPerform: DispatchQueue.concurrentPerform))
+  }
+}
+
+/// A benchmark's input in a memory-mapped file, which is only written and
+/// mapped the first time a benchmark reads it, so that registering, listing
+/// or filtering benchmarks doesn't touch the disk
+final class MappedInputFile {
+  let name: String
+  private let makeInput: () -> String
+  private var mapped: Data? = nil
+
+  init(name: String, makeInput: @escaping () -> String) {
+    self.name = name
+    self.makeInput = makeInput
+  }
+
+  var data: Data {
+    if let mapped {
+      return mapped
+    }
+    let url = FileManager.default.temporaryDirectory
+      .appendingPathComponent("RegexBenchmark-\(name).txt")
+    try! Data(makeInput().utf8).write(to: url)
+    let data = try! Data(contentsOf: url, options: .alwaysMapped)
+    mapped = data
+    return data
+  }
+}
+
+/// A benchmark finding all matches in a memory-mapped file, either by
+/// copying the whole file into a string first, or by feeding the mapping to
+/// a stream matcher a chunk at a time
+struct MappedFileBenchmark: SwiftRegexBenchmark {
+  let name: String
+  var regex: Regex<AnyRegexOutput>
+  let pattern: String?
+  let file: MappedInputFile
+  let isStreamed: Bool
+
+  func matchCount() -> Int {
+    let data = file.data
+    guard isStreamed else {
+      let target = String(decoding: data, as: UTF8.self)
+      return target.matches(of: regex).count
+    }
+    var matcher = RegexStreamMatcher(regex)
+    var count = 0
+    data.withUnsafeBytes { bytes in
+      try! matcher.forEachMatch(in: bytes) { _ in count += 1 }
+    }
+    return count
+  }
+
+  func run() {
+    blackHole(matchCount())
+  }
+}
+
+/// A benchmark creating many regexes and matching each against the input
+/// once, as an app might at launch, either from their patterns or from their
+/// compiled representations
+struct RegexStartupBenchmark: RegexBenchmark {
+  let name: String
+  let patterns: [String]
+  let compiledRepresentations: [[UInt8]]?
+  let target: String
+
+  func run() {
+    if let compiledRepresentations {
+      for bytes in compiledRepresentations {
+        let regex = try! Regex(compiledRepresentation: bytes)
+        blackHole(target.firstMatch(of: regex))
+      }
+    } else {
+      // Parse and compile every regex, rather than reusing the programs
+      // cached by the last run.
+      RegexCache.removeAll()
+      for pattern in patterns {
+        let regex = try! Regex(pattern)
+        blackHole(target.firstMatch(of: regex))
+      }
+    }
+  }
+}
+
+/// A benchmark running one stage of compiling a regex from a pattern, using
+/// the result of the previous stage
+struct CompileStageBenchmark: RegexBenchmark {
+  let name: String
+  let stages: _CompilationStages
+  let stage: Stage
+
+  enum Stage: CaseIterable {
+    case parse
+    case lower
+    case emit
+
+    var nameSuffix: String {
+      switch self {
+      case .parse: return "_Parse"
+      case .lower: return "_Lower"
+      case .emit: return "_Emit"
+      }
+    }
+  }
+
+  func run() {
+    switch stage {
+    case .parse: try! stages.parse()
+    case .lower: stages.lower()
+    case .emit: try! stages.emit()
+    }
+  }
+}
+
 /// A benchmark meant to be ran across multiple engines
 struct CrossBenchmark {
   /// Suffix added onto NSRegularExpression benchmarks
   static var nsSuffix: String { "_NS" }
+
+  /// Suffix added onto benchmarks compiled to threaded code rather than
+  /// interpreted
+  static var threadedSuffix: String { "_Threaded" }
   
   /// The base name of the benchmark
   var baseName: String
@@ -19,6 +19,7 @@ extension BenchmarkRunner {
     self.addCSS()
     self.addNotFound()
     self.addGraphemeBreak()
+    self.addGraphemeBreakStepping()
     self.addHangulSyllable()
     // self.addHTML() // Disabled due to \b being unusably slow
     self.addEmail()
@@ -33,6 +34,15 @@ extension BenchmarkRunner {
 
     self.addURLWithWordBoundaries()
     self.addFSPathsRegex()
+    self.addSavePoints()
+    self.addRegexSet()
+    self.addMemoization()
+    self.addLazyDFA()
+    self.addStartup()
+    self.addWordBoundaries()
+    self.addKeywordList()
+    self.addCompileScaling()
+    self.addMappedFile()
 
     // Register community benchmarks
     self.addCommunityBenchmark_sspringerURL()
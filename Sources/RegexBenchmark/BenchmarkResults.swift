@@ -48,26 +48,50 @@ extension BenchmarkRunner {
   }
 
   /// Compare this runner's results against the results stored in the given file path
+  ///
+  /// Returns a description of each regression larger than
+  /// `regressionThreshold` percent, in run time, allocations, or
+  /// instructions executed.
+  @discardableResult
   func compare(
     against compareFilePath: String,
     showChart: Bool,
-    saveTo: String?
-  ) throws {
+    saveTo: String?,
+    regressionThreshold: Double? = nil
+  ) throws -> [String] {
     let compareFileURL = URL(fileURLWithPath: compareFilePath)
     let compareResult = try SuiteResult.load(from: compareFileURL)
     let compareFile = compareFileURL.lastPathComponent
 
-    let comparisons = results
+    let allComparisons = results
       .compare(with: compareResult)
       .filter({!$0.name.contains("_NS")})
-      .filter({$0.diff != nil})
+      .sorted(by: {$0.name < $1.name})
+    let comparisons = allComparisons.filter({$0.diff != nil})
     displayComparisons(
       comparisons,
       showChart,
       against: "saved benchmark result " + compareFile)
+
+    // Counts are deterministic enough to compare whether or not the run
+    // times differ significantly.
+    print("=== Changed counts =============================================================")
+    for item in allComparisons where !item.changedCounts.isEmpty {
+      print("- \(item.name)")
+      for count in item.changedCounts {
+        print("    \(count)")
+      }
+    }
+
     if let saveFile = saveTo {
       try saveComparisons(comparisons, path: saveFile)
     }
+    guard let regressionThreshold else {
+      return []
+    }
+    return allComparisons.flatMap {
+      $0.regressions(threshold: regressionThreshold)
+    }
   }
   
   // Compile times are often very short (5-20µs) so results are likely to be
@@ -104,6 +128,20 @@ extension BenchmarkRunner {
     }
   }
   
+  /// Compares Swift Regex benchmark results run with threaded code against
+  /// the same benchmarks run by the interpreter
+  func compareWithThreadedCode(showChart: Bool, saveTo: String?) throws {
+    let comparisons = results.compareWithThreadedCode()
+      .filter({$0.diff != nil})
+    displayComparisons(
+      comparisons,
+      showChart,
+      against: "the interpreter (via CrossBenchmark)")
+    if let saveFile = saveTo {
+      try saveComparisons(comparisons, path: saveFile)
+    }
+  }
+
   func displayComparisons(
     _ comparisons: [BenchmarkResult.Comparison],
     _ showChart: Bool,
@@ -149,7 +187,11 @@ extension BenchmarkRunner {
         withIntermediateDirectories: true)
     }
     
-    var contents = "name,latest,baseline,diff,percentage\n"
+    var contents = """
+      name,latest,baseline,diff,percentage,\
+      latest_allocations,baseline_allocations,\
+      latest_instructions,baseline_instructions\n
+      """
     for comparison in comparisons {
       contents += comparison.asCsv + "\n"
     }
@@ -190,6 +232,13 @@ struct BenchmarkResult: Codable, CustomStringConvertible {
   let runtime: Measurement
   let compileTime: Measurement?
   let parseTime: Measurement?
+  /// The allocations made by a single run, if they could be counted.
+  var allocations: Allocations? = nil
+  /// The hardware events counted per run, if the counters are available.
+  var counters: HardwareCounters? = nil
+  /// The rate the input was searched, for benchmarks run on scaled inputs
+  /// or on several threads.
+  var throughput: Throughput? = nil
   
   var description: String {
     var base = "  > run time: \(runtime.description)"
@@ -199,13 +248,25 @@ struct BenchmarkResult: Codable, CustomStringConvertible {
     if let parseTime = parseTime {
       base += "\n  > parse time: \(parseTime)"
     }
+    if let allocations = allocations {
+      base += "\n  > allocations: \(allocations)"
+    }
+    if let counters = counters {
+      base += "\n  > counters: \(counters)"
+    }
+    if let throughput = throughput {
+      base += "\n  > throughput: \(throughput)"
+    }
     return base
   }
 
   var asCSV: String {
     let na = "N/A, N/A, N/A"
     return """
-    \(runtime.asCSV), \(compileTime?.asCSV ?? na), \(parseTime?.asCSV ?? na)
+    \(runtime.asCSV), \(compileTime?.asCSV ?? na), \(parseTime?.asCSV ?? na), \
+    \(allocations?.asCSV ?? "N/A, N/A"), \
+    \(counters?.asCSV ?? "N/A, N/A, N/A, N/A, N/A"), \
+    \(throughput?.asCSV ?? "N/A, N/A, N/A, N/A")
     """
   }
 }
@@ -216,6 +277,10 @@ extension BenchmarkResult {
     var name: String
     var baseline: Measurement
     var latest: Measurement
+    var baselineAllocations: Allocations? = nil
+    var latestAllocations: Allocations? = nil
+    var baselineCounters: HardwareCounters? = nil
+    var latestCounters: HardwareCounters? = nil
     
     var latestTime: Time { latest.median }
     var baselineTime: Time { baseline.median }
@@ -252,9 +317,96 @@ extension BenchmarkResult {
         return "\(name),N/A"
       }
       let percentage = (1000 * diff.seconds / baselineTime.seconds).rounded()/10
-      return "\"\(name)\",\(latestTime.seconds),\(baselineTime.seconds),\(diff.seconds),\(percentage)%"
+      func csv(_ count: Int?) -> String {
+        count.map(String.init) ?? "N/A"
+      }
+      return """
+        "\(name)",\(latestTime.seconds),\(baselineTime.seconds),\
+        \(diff.seconds),\(percentage)%,\
+        \(csv(latestAllocations?.count)),\(csv(baselineAllocations?.count)),\
+        \(csv(latestCounters?.instructions)),\(csv(baselineCounters?.instructions))
+        """
+    }
+  }
+}
+
+extension BenchmarkResult.Comparison {
+  /// A count recorded in both the baseline and the latest results.
+  struct CountChange: CustomStringConvertible {
+    var label: String
+    var baseline: Int
+    var latest: Int
+    /// Whether the count varies little enough between runs to flag a
+    /// regression.
+    var isStable: Bool
+
+    /// The change from the baseline, in percent.
+    var percentage: Double {
+      guard baseline != 0 else {
+        return latest == 0 ? 0 : .infinity
+      }
+      return (1000 * Double(latest - baseline) / Double(baseline)).rounded() / 10
+    }
+
+    var description: String {
+      "\(label): \(latest) (baseline \(baseline), \(percentage)%)"
     }
   }
+
+  /// The counts recorded in both results.
+  var counts: [CountChange] {
+    var result: [CountChange] = []
+    func add(
+      _ label: String, _ baseline: Int?, _ latest: Int?, isStable: Bool = false
+    ) {
+      if let baseline, let latest {
+        result.append(CountChange(
+          label: label, baseline: baseline, latest: latest, isStable: isStable))
+      }
+    }
+    add("allocations",
+        baselineAllocations?.count, latestAllocations?.count, isStable: true)
+    add("allocated bytes",
+        baselineAllocations?.bytes, latestAllocations?.bytes)
+    add("instructions",
+        baselineCounters?.instructions, latestCounters?.instructions,
+        isStable: true)
+    add("cycles",
+        baselineCounters?.cycles, latestCounters?.cycles)
+    add("branch misses",
+        baselineCounters?.branchMisses, latestCounters?.branchMisses)
+    add("L1D misses",
+        baselineCounters?.l1DataCacheMisses, latestCounters?.l1DataCacheMisses)
+    add("LLC misses",
+        baselineCounters?.lastLevelCacheMisses, latestCounters?.lastLevelCacheMisses)
+    return result
+  }
+
+  /// The counts that differ from the baseline.
+  var changedCounts: [CountChange] {
+    counts.filter { $0.latest != $0.baseline }
+  }
+
+  /// Returns a description of each measure that regressed by more than
+  /// `threshold` percent.
+  ///
+  /// Run times count only when the change is statistically significant.
+  /// Cycles and cache misses vary too much from run to run to gate on, so
+  /// only allocations and instructions are checked among the counts.
+  func regressions(threshold: Double) -> [String] {
+    var result: [String] = []
+    if let diff, diff.seconds > 0 {
+      let percentage = 100 * diff.seconds / baselineTime.seconds
+      if percentage > threshold {
+        result.append(
+          "\(name): run time \(latestTime) (baseline \(baselineTime), +\((percentage * 10).rounded() / 10)%)")
+      }
+    }
+    for count in counts where count.isStable && count.percentage > threshold {
+      result.append("\(name): \(count)")
+    }
+    return result
+  }
 }
 
 struct SuiteResult {
@@ -270,7 +422,11 @@ struct SuiteResult {
       if let otherVal = other.results[latest.key] {
         comparisons.append(
           .init(name: latest.key,
-                baseline: otherVal.runtime, latest: latest.value.runtime))
+                baseline: otherVal.runtime, latest: latest.value.runtime,
+                baselineAllocations: otherVal.allocations,
+                latestAllocations: latest.value.allocations,
+                baselineCounters: otherVal.counters,
+                latestCounters: latest.value.counters))
       }
     }
     return comparisons
@@ -289,6 +445,22 @@ struct SuiteResult {
     }
     return comparisons
   }
+
+  /// Compares the threaded code benchmarks generated by CrossBenchmark with
+  /// the interpreted ones
+  func compareWithThreadedCode() -> [BenchmarkResult.Comparison] {
+    var comparisons: [BenchmarkResult.Comparison] = []
+    for baseline in results {
+      let key = baseline.key + CrossBenchmark.threadedSuffix
+      if let threadedResult = results[key] {
+        comparisons.append(
+          .init(name: key,
+                baseline: baseline.value.runtime,
+                latest: threadedResult.runtime))
+      }
+    }
+    return comparisons
+  }
   
   func compareCompileTimes(
     with other: SuiteResult
@@ -321,10 +493,12 @@ extension SuiteResult: Codable {
     name,\
     runtime_median, runTime_stddev, runTime_samples,\
     compileTime_median, compileTime_stddev, compileTime_samples,\
-    parseTime_median, parseTime_stddev, parseTime_samples\n
+    parseTime_median, parseTime_stddev, parseTime_samples,\
+    \(Allocations.csvHeader), \(HardwareCounters.csvHeader), \
+    \(Throughput.csvHeader)\n
     """
     for (name, result) in output {
-      contents.append("\(name), \(result.asCSV))\n")
+      contents.append("\(name), \(result.asCSV)\n")
     }
     print("Saving result as .csv to \(url.path())")
     try contents.write(to: url, atomically: true, encoding: String.Encoding.utf8)
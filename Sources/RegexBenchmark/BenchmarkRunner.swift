@@ -70,6 +70,24 @@ struct BenchmarkRunner {
         type: .init(type),
         target: input))
 
+    var threaded = Benchmark(
+      name: nameBase + nameSuffix + CrossBenchmark.threadedSuffix,
+      regex: swiftRegex,
+      pattern: pattern,
+      type: type,
+      target: input)
+    threaded.enableThreadedCode()
+    register(threaded)
+
+    if type == .allMatches {
+      register(
+        MatchOffsetsBenchmark(
+          name: nameBase + nameSuffix + "_Offsets",
+          regex: swiftRegex,
+          pattern: pattern,
+          target: input))
+    }
+
     if alsoRunSimpleWordBoundaries {
       register(
         Benchmark(
@@ -111,6 +129,12 @@ struct BenchmarkRunner {
       pattern: pattern,
       targets: inputList
     ))
+    register(InputListContextBenchmark(
+      name: name + "_Context",
+      regex: swiftRegex,
+      pattern: pattern,
+      targets: inputList
+    ))
     register(InputListNSBenchmark(
       name: name + CrossBenchmark.nsSuffix,
       regex: pattern,
@@ -133,6 +157,97 @@ struct BenchmarkRunner {
 
   }
 
+  // Register a benchmark comparing a regex set against its regexes run one
+  // at a time
+  mutating func registerRegexSetBenchmark(
+    name: String,
+    inputList: [String],
+    patterns: [String]
+  ) {
+    let regexes = patterns.map { try! Regex($0) }
+    register(RegexSetBenchmark(
+      name: name,
+      regexSet: RegexSet(regexes),
+      targets: inputList))
+    register(RegexListBenchmark(
+      name: name + "_OneByOne",
+      regexes: regexes,
+      targets: inputList))
+  }
+
+  // Register a benchmark finding all matches with the input split across
+  // the available processors
+  mutating func registerParallelMatchesBenchmark(
+    name: String,
+    input: String,
+    pattern: String
+  ) {
+    register(ParallelMatchesBenchmark(
+      name: name,
+      regex: try! Regex(pattern),
+      target: input))
+  }
+
+  // Register a benchmark searching `input` after writing it to a file and
+  // mapping it into memory, and one streaming the mapped file instead. The
+  // file is written when one of them first runs
+  mutating func registerMappedFileBenchmark(
+    name: String,
+    input: @escaping () -> String,
+    pattern: String
+  ) {
+    let file = MappedInputFile(name: name, makeInput: input)
+    let regex = try! Regex(pattern)
+    register(MappedFileBenchmark(
+      name: name + "_String",
+      regex: regex,
+      pattern: pattern,
+      file: file,
+      isStreamed: false))
+    register(MappedFileBenchmark(
+      name: name + "_Streamed",
+      regex: regex,
+      pattern: pattern,
+      file: file,
+      isStreamed: true))
+  }
+
+  // Register a benchmark creating regexes from patterns, and one loading
+  // them from their compiled representations
+  mutating func registerStartupBenchmark(
+    name: String,
+    input: String,
+    patterns: [String]
+  ) {
+    register(RegexStartupBenchmark(
+      name: name + "_Compile",
+      patterns: patterns,
+      compiledRepresentations: nil,
+      target: input))
+    register(RegexStartupBenchmark(
+      name: name + "_Load",
+      patterns: patterns,
+      compiledRepresentations: patterns.map {
+        try! Regex($0).compiledRepresentation()
+      },
+      target: input))
+  }
+
+  // Register benchmarks that parse, lower, and generate code for a pattern,
+  // each timed separately
+  mutating func registerCompileStageBenchmarks(
+    name: String,
+    pattern: String
+  ) {
+    let stages = try! _CompilationStages(pattern: pattern)
+    for stage in CompileStageBenchmark.Stage.allCases {
+      register(CompileStageBenchmark(
+        name: name + stage.nameSuffix,
+        stages: stages,
+        stage: stage))
+    }
+  }
+
   // Register a swift-only benchmark
   mutating func register(
     nameBase: String,
@@ -182,6 +297,59 @@ struct BenchmarkRunner {
     suite.append(benchmark)
   }
 
+  private mutating func register(_ benchmark: RegexSetBenchmark) {
+    suite.append(benchmark)
+  }
+
+  private mutating func register(_ benchmark: RegexListBenchmark) {
+    suite.append(benchmark)
+  }
+
+  private mutating func register(_ benchmark: ParallelMatchesBenchmark) {
+    suite.append(benchmark)
+  }
+
+  private mutating func register(_ benchmark: RegexStartupBenchmark) {
+    suite.append(benchmark)
+  }
+
+  private mutating func register(_ benchmark: CompileStageBenchmark) {
+    suite.append(benchmark)
+  }
+
+  private mutating func register(_ benchmark: MappedFileBenchmark) {
+    var benchmark = benchmark
+    if enableTracing {
+      benchmark.enableTracing()
+    }
+    if enableMetrics {
+      benchmark.enableMetrics()
+    }
+    suite.append(benchmark)
+  }
+
+  private mutating func register(_ benchmark: MatchOffsetsBenchmark) {
+    var benchmark = benchmark
+    if enableTracing {
+      benchmark.enableTracing()
+    }
+    if enableMetrics {
+      benchmark.enableMetrics()
+    }
+    suite.append(benchmark)
+  }
+
+  private mutating func register(_ benchmark: InputListContextBenchmark) {
+    var benchmark = benchmark
+    if enableTracing {
+      benchmark.enableTracing()
+    }
+    if enableMetrics {
+      benchmark.enableMetrics()
+    }
+    suite.append(benchmark)
+  }
+
   private mutating func register(_ benchmark: InputListBenchmark) {
     var benchmark = benchmark
     if enableTracing {
@@ -234,11 +402,16 @@ struct BenchmarkRunner {
       parseTime = nil
     }
     
-    let runtime = medianMeasure(samples: samples) { benchmark.run() }
+    let (runtime, counters) = HardwareCounters.measure(runs: samples) {
+      medianMeasure(samples: samples) { benchmark.run() }
+    }
+    let allocations = Allocations.measure { benchmark.run() }
     return BenchmarkResult(
       runtime: runtime,
       compileTime: compileTime,
-      parseTime: parseTime)
+      parseTime: parseTime,
+      allocations: allocations,
+      counters: counters)
   }
   
   mutating func run() {
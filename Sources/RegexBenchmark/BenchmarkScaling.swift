@@ -0,0 +1,157 @@
+//===----------------------------------------------------------------------===//
+//
+// This source file is part of the Swift.org open source project
+//
+// Copyright (c) 2025 Apple Inc. and the Swift project authors
+// Licensed under Apache License v2.0 with Runtime Library Exception
+//
+// See https://swift.org/LICENSE.txt for license information
+//
+//===----------------------------------------------------------------------===//
+
+import Foundation
+@_spi(RegexBenchmark) import _StringProcessing
+
+extension Benchmark {
+  /// The number of matches found by a single run.
+  var matchCount: Int {
+    switch type {
+    case .whole: return target.wholeMatch(of: regex) == nil ? 0 : 1
+    case .first: return target.firstMatch(of: regex) == nil ? 0 : 1
+    case .allMatches: return target._matchCount(of: regex)
+    }
+  }
+}
+
+extension BenchmarkRunner {
+  /// The input sizes that searching benchmarks are scaled to, in bytes.
+  static var inputScalingSizes: [Size] {
+    [1 << 10, 32 << 10, 1 << 20, 32 << 20, 1 << 30].map { Size($0) }
+  }
+
+  /// The amount of input each thread searches in a sample when running on
+  /// several threads, so that the threads run long enough to overlap.
+  private static var bytesPerThread: Int { 1 << 20 }
+
+  /// Runs each benchmark that finds all matches on its input repeated up to
+  /// each size in `inputScalingSizes` no larger than `maxSize`, recording the
+  /// throughput at each size.
+  ///
+  /// Results are named after the benchmark and the input size, such as
+  /// `EmailLookahead_All_32kB`, so that they can be saved and compared like
+  /// any other.
+  mutating func runInputScaling(upTo maxSize: Size) {
+    print("Running on scaled inputs")
+    let sizes = Self.inputScalingSizes.filter { $0 <= maxSize }
+    for case let b as Benchmark in suite
+    where b.type == .allMatches && !b.target.isEmpty {
+      for size in sizes {
+        let targetBytes = b.target.utf8.count
+        let input = String(
+          repeating: b.target,
+          count: (size.rawValue + targetBytes - 1) / targetBytes)
+        let inputBytes = input.utf8.count
+
+        // Larger inputs take long enough to time with fewer samples.
+        let samples = max(3, min(
+          self.samples, self.samples * Self.bytesPerThread / inputBytes))
+        // Count the matches without collecting them, which would otherwise
+        // dominate the time and memory for the largest inputs.
+        var matches = 0
+        let runtime = medianMeasure(samples: samples) {
+          matches = input._matchCount(of: b.regex)
+        }
+        let result = BenchmarkResult(
+          runtime: runtime,
+          compileTime: nil,
+          parseTime: nil,
+          throughput: Throughput(
+            inputBytes: inputBytes, matches: matches, time: runtime.median))
+
+        let name = "\(b.name)_\(size)B"
+        if !quiet {
+          print("- \(name)\n\(result)")
+        }
+        results.add(name: name, result: result)
+      }
+    }
+  }
+
+  /// Runs each benchmark on each number of threads in `threadCounts` at
+  /// once, all sharing one regex, recording the throughput and how well it
+  /// scales compared to a single thread.
+  ///
+  /// Each sample starts from a copy of the regex that hasn't been compiled,
+  /// so that the threads race to compile it, and then each thread searches
+  /// the input repeatedly, retaining and releasing the shared program.
+  /// Threads beyond the number of active processors run in turn.
+  ///
+  /// Results are named after the benchmark and the number of threads, such
+  /// as `EmailLookahead_All_Threads4`.
+  mutating func runThreadScaling(threadCounts: [Int]) {
+    print("Running on shared regexes")
+    // The single-threaded run is the baseline for scaling efficiency.
+    let threadCounts = Set(threadCounts.filter { $0 > 0 } + [1]).sorted()
+    for case let b as Benchmark in suite {
+      let targetBytes = max(b.target.utf8.count, 1)
+      let repetitions = max(1, Self.bytesPerThread / targetBytes)
+      let matches = b.matchCount
+
+      var singleThreadTime: Time? = nil
+      for threads in threadCounts {
+        let runtime = measureShared(
+          b, threads: threads, repetitions: repetitions)
+        var throughput = Throughput(
+          inputBytes: b.target.utf8.count * repetitions,
+          matches: matches * repetitions,
+          threads: threads,
+          time: runtime.median)
+        if threads == 1 {
+          singleThreadTime = runtime.median
+        } else if let singleThreadTime {
+          // Each thread does the same work as the single thread, so perfect
+          // scaling takes the same time.
+          throughput.scalingEfficiency =
+            singleThreadTime.seconds / runtime.median.seconds
+        }
+        let result = BenchmarkResult(
+          runtime: runtime,
+          compileTime: nil,
+          parseTime: nil,
+          throughput: throughput)
+
+        let name = "\(b.name)_Threads\(threads)"
+        if !quiet {
+          print("- \(name)\n\(result)")
+        }
+        results.add(name: name, result: result)
+      }
+    }
+  }
+
+  /// Measures `threads` threads each running `benchmark` `repetitions`
+  /// times, sharing a single regex.
+  private func measureShared(
+    _ benchmark: Benchmark,
+    threads: Int,
+    repetitions: Int
+  ) -> Measurement {
+    var times: [Time] = []
+    for _ in 0..<samples {
+      // Copying the program discards its compiled form, including one shared
+      // through the regex cache.
+      var fresh = benchmark
+      let _ = fresh.regex._forceAction(.addOptions([]))
+      let shared = fresh
+
+      let start = Tick.now
+      DispatchQueue.concurrentPerform(iterations: threads) { _ in
+        for _ in 0..<repetitions {
+          shared.run()
+        }
+      }
+      times.append(Tick.now.elapsedTime(since: start))
+    }
+    return Measurement(results: times)
+  }
+}
@@ -31,6 +31,12 @@ struct Runner: ParsableCommand {
   @Option(help: "The result file to compare against")
   var compare: String?
 
+  @Option(help: """
+Exit with a failure if a benchmark's run time, allocation count, or \
+instruction count regressed by more than this percentage in --compare
+""")
+  var regressionThreshold: Double?
+
   @Option(help: "Compare compile times with the given results file")
   var compareCompileTime: String?
   
@@ -39,6 +45,9 @@ struct Runner: ParsableCommand {
   
   @Flag(help: "Compare with NSRegularExpression")
   var compareWithNS: Bool = false
+
+  @Flag(help: "Compare threaded code with the interpreter")
+  var compareThreadedCode: Bool = false
   
   @Option(help: "Save comparison results as csv")
   var saveComparison: String?
@@ -73,6 +82,18 @@ swift build -c release -Xswiftc -DPROCESSOR_MEASUREMENTS_ENABLED
 """)
   var enableMetrics: Bool = false
   
+  @Option(help: """
+Instead of the usual run, run each all-matches benchmark on its input \
+repeated to sizes from 1k up to this size (such as 1G), reporting throughput
+""")
+  var scaleInput: Size?
+
+  @Option(parsing: .upToNextOption, help: """
+Instead of the usual run, run each benchmark on these numbers of threads \
+sharing one regex, reporting throughput and scaling efficiency
+""")
+  var threads: [Int] = []
+
   @Flag(help: "Include firstMatch benchmarks in CrossBenchmark (off by default)")
   var includeFirst: Bool = false
 
@@ -114,23 +135,40 @@ swift build -c release -Xswiftc -DPROCESSOR_MEASUREMENTS_ENABLED
       if excludeNs {
         runner.suite = runner.suite.filter { b in !b.name.contains("_NS") }
       }
-      runner.run()
+      if scaleInput != nil || !threads.isEmpty {
+        if let scaleInput {
+          runner.runInputScaling(upTo: scaleInput)
+        }
+        if !threads.isEmpty {
+          runner.runThreadScaling(threadCounts: threads)
+        }
+      } else {
+        runner.run()
+      }
     }
     if let saveFile = save {
       try runner.save(to: saveFile)
     }
-    if saveComparison != nil && compareWithNS && compare != nil {
+    let comparisonCount = [compareWithNS, compareThreadedCode, compare != nil]
+      .filter { $0 }.count
+    if saveComparison != nil && comparisonCount > 1 {
       print("Unable to save both comparison results, specify only one compare operation")
       return
     }
     if compareWithNS {
       try runner.compareWithNS(showChart: showChart, saveTo: saveComparison)
     }
+    if compareThreadedCode {
+      try runner.compareWithThreadedCode(
+        showChart: showChart, saveTo: saveComparison)
+    }
+    var regressions: [String] = []
     if let compareFile = compare {
-      try runner.compare(
+      regressions = try runner.compare(
         against: compareFile,
         showChart: showChart,
-        saveTo: saveComparison)
+        saveTo: saveComparison,
+        regressionThreshold: regressionThreshold)
     }
     if let compareFile = compareCompileTime {
       try runner.compareCompileTimes(against: compareFile, showChart: showChart)
@@ -138,5 +176,12 @@ swift build -c release -Xswiftc -DPROCESSOR_MEASUREMENTS_ENABLED
     if let csvPath = saveCSV {
       try runner.saveCSV(to: csvPath)
     }
+    if !regressions.isEmpty {
+      print("=== Regressions over \(regressionThreshold!)% =====================================")
+      for regression in regressions {
+        print("- \(regression)")
+      }
+      throw ExitCode.failure
+    }
   }
 }
@@ -10,6 +10,7 @@
 //===----------------------------------------------------------------------===//
 
 import Foundation
+import _StringProcessing
 
 protocol Debug {
   func debug()
@@ -131,6 +132,71 @@ extension InputListBenchmark {
   }
 }
 
+extension InputListContextBenchmark {
+  func debug() {
+    var context = RegexMatchContext(regex)
+    var offsets = [Int](repeating: 0, count: 2 * (context.captureCount + 1))
+    var matched = 0
+    offsets.withUnsafeMutableBufferPointer { offsets in
+      for target in targets {
+        if (try? context.wholeMatch(in: target[...], offsets: offsets)) == true {
+          matched += 1
+        }
+      }
+    }
+    print("- Matched \(matched) elements of the input set")
+
+    // Once the context has seen every input, matching them again shouldn't
+    // allocate.
+    if let allocations = offsets.withUnsafeMutableBufferPointer({ offsets in
+      Allocations.measure {
+        for target in targets {
+          blackHole(try? context.wholeMatch(in: target[...], offsets: offsets))
+        }
+      }
+    }) {
+      print("- Allocations after warming up: \(allocations)")
+      if allocations.count != 0 {
+        print("- Warning: Matching with a warm context allocated")
+      }
+    }
+  }
+}
+
+extension MatchOffsetsBenchmark {
+  func debug() {
+    var context = RegexMatchContext(regex)
+    var offsets = [Int](repeating: 0, count: 2 * (context.captureCount + 1))
+    var count = 0
+    offsets.withUnsafeMutableBufferPointer { offsets in
+      try! context.forEachMatch(in: target[...], offsets: offsets) {
+        count += 1
+      }
+    }
+    let expected = target.matches(of: regex).count
+    print("- Total matches: \(count)")
+    if count != expected {
+      print("- Warning: Expected \(expected) matches")
+    }
+  }
+}
+
+extension MappedFileBenchmark {
+  func debug() {
+    let count = matchCount()
+    print("- Total matches: \(count) in \(Size(file.data.count))B")
+    let other = MappedFileBenchmark(
+      name: name,
+      regex: regex,
+      pattern: pattern,
+      file: file,
+      isStreamed: !isStreamed)
+    if count != other.matchCount() {
+      print("- Warning: Expected \(other.matchCount()) matches")
+    }
+  }
+}
+
 extension InputListNSBenchmark {
   func debug() {
     var matched = 0
@@ -147,3 +213,51 @@ extension InputListNSBenchmark {
     print("- Failed to match \(failed) elements of the input set")
   }
 }
+
+extension RegexSetBenchmark {
+  func debug() {
+    let matchCount = targets.reduce(0) {
+      $0 + (try! regexSet.matchingIndices(in: $1)).count
+    }
+    print("- Matched \(matchCount) regexes across \(targets.count) inputs")
+  }
+}
+
+extension RegexListBenchmark {
+  func debug() {
+    let matchCount = targets.reduce(0) { count, target in
+      count + regexes.filter { target.firstMatch(of: $0) != nil }.count
+    }
+    print("- Matched \(matchCount) regexes across \(targets.count) inputs")
+  }
+}
+
+extension ParallelMatchesBenchmark {
+  func debug() {
+    let matches = target.matches(
+      of: regex,
+      chunkCount: ProcessInfo.processInfo.activeProcessorCount,
+      concurrentPerform: DispatchQueue.concurrentPerform)
+    print("- Found \(matches.count) matches using \(ProcessInfo.processInfo.activeProcessorCount) chunks")
+  }
+}
+
+extension RegexStartupBenchmark {
+  func debug() {
+    let matchCount = patterns.filter {
+      target.firstMatch(of: try! Regex($0)) != nil
+    }.count
+    if let compiledRepresentations {
+      print("- Loaded \(compiledRepresentations.count) compiled representations")
+    }
+    print("- Matched \(matchCount) of \(patterns.count) regexes")
+  }
+}
+
+extension CompileStageBenchmark {
+  func debug() {
+    let start = Tick.now
+    run()
+    print("- Ran the \(stage) stage in \(Tick.now.elapsedTime(since: start))")
+  }
+}
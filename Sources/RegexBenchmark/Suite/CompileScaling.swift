@@ -0,0 +1,58 @@
+//===----------------------------------------------------------------------===//
+//
+// This source file is part of the Swift.org open source project
+//
+// Copyright (c) 2025 Apple Inc. and the Swift project authors
+// Licensed under Apache License v2.0 with Runtime Library Exception
+//
+// See https://swift.org/LICENSE.txt for license information
+//
+//===----------------------------------------------------------------------===//
+
+import _StringProcessing
+
+extension BenchmarkRunner {
+  mutating func addCompileScaling() {
+    // Generated patterns of the kind a service might build from its
+    // configuration, at sizes where any superlinear stage would stand out.
+    let sizes = [(1_000, "1k"), (10_000, "10k"), (100_000, "100k")]
+
+    // A list of five-letter keywords.
+    func keywords(atoms: Int) -> String {
+      (0..<(atoms / 5)).map { i in
+        var word = ""
+        var n = i
+        for _ in 0..<5 {
+          word.append(Character(Unicode.Scalar(UInt8(ascii: "a") + UInt8(n % 26))))
+          n /= 26
+        }
+        return word
+      }.joined(separator: "|")
+    }
+
+    // A long concatenation mixing literals, classes, and groups.
+    func mixed(atoms: Int) -> String {
+      let components = [
+        "a", #"\d"#, "[b-f]", #"\w+"#, "(?:g|h)", #"\s?"#, "(x)", "y{2,3}",
+      ]
+      return (0..<atoms).map { components[$0 % components.count] }.joined()
+    }
+
+    // Named captures, each followed by a reference to it.
+    func namedCaptures(atoms: Int) -> String {
+      (0..<(atoms / 2)).map { #"(?<g\#($0)>[a-z])\k<g\#($0)>"# }.joined()
+    }
+
+    for (atoms, suffix) in sizes {
+      registerCompileStageBenchmarks(
+        name: "CompileScalingKeywords\(suffix)",
+        pattern: keywords(atoms: atoms))
+      registerCompileStageBenchmarks(
+        name: "CompileScalingMixed\(suffix)",
+        pattern: mixed(atoms: atoms))
+      registerCompileStageBenchmarks(
+        name: "CompileScalingNamedCaptures\(suffix)",
+        pattern: namedCaptures(atoms: atoms))
+    }
+  }
+}
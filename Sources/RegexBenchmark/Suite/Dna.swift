@@ -32,5 +32,12 @@ extension BenchmarkRunner {
     
     dnaMatching.register(&self)
     sequenceEnds.register(&self)
+
+    // The same searches split across the available processors, for
+    // comparison with the `_All` benchmarks above
+    registerParallelMatchesBenchmark(
+      name: "DnaMatch_AllParallel", input: Inputs.dnaFASTA, pattern: dna)
+    registerParallelMatchesBenchmark(
+      name: "DnaEndsMatch_AllParallel", input: Inputs.dnaFASTA, pattern: ends)
   }
 }
@@ -24,6 +24,28 @@ extension BenchmarkRunner {
     benchmark.register(&self)
   }
 
+  mutating func addGraphemeBreakStepping() {
+    // Text whose characters are made of several scalars or aren't ASCII,
+    // which searching and `.` step through a character at a time
+    let input = String(repeating: """
+      Cafe\u{301} cre\u{300}me bru\u{302}le\u{301}e, 한국어 텍스트, \
+      👨‍👩‍👧‍👦 🇯🇵🇫🇷 👍🏽, and a plain ASCII tail for good measure\r
+
+      """, count: 500)
+
+    let lines = CrossBenchmark(
+      baseName: "GraphemeBreakDotLines",
+      regex: #"(?m)^.+$"#,
+      input: input)
+    let notFound = CrossBenchmark(
+      baseName: "GraphemeBreakSearchNotFound",
+      regex: #"\p{Lu}\d\d"#,
+      input: input)
+
+    lines.register(&self)
+    notFound.register(&self)
+  }
+
   mutating func addHangulSyllable() {
     let input = Inputs.graphemeBreakData
     let regex = #"HANGUL SYLLABLE [A-Z]+(?:\.\.HANGUL SYLLABLE [A-Z]+)?"#
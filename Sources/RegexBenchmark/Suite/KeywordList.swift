@@ -0,0 +1,50 @@
+//===----------------------------------------------------------------------===//
+//
+// This source file is part of the Swift.org open source project
+//
+// Copyright (c) 2025 Apple Inc. and the Swift project authors
+// Licensed under Apache License v2.0 with Runtime Library Exception
+//
+// See https://swift.org/LICENSE.txt for license information
+//
+//===----------------------------------------------------------------------===//
+
+import _StringProcessing
+
+extension BenchmarkRunner {
+  mutating func addKeywordList() {
+    let keywords = [
+      "associatedtype", "class", "deinit", "enum", "extension", "fileprivate",
+      "func", "import", "init", "inout", "internal", "let", "open", "operator",
+      "private", "protocol", "public", "rethrows", "static", "struct",
+      "subscript", "typealias", "var", "break", "case", "continue", "default",
+      "defer", "do", "else", "fallthrough", "for", "guard", "if", "in",
+      "repeat", "return", "switch", "where", "while", "as", "catch", "false",
+      "is", "nil", "super", "self", "throw", "throws", "true", "try", "type",
+      "member", "scope", "error", "note", "warning",
+    ]
+    let keywordList = CrossBenchmark(
+      baseName: "KeywordList",
+      regex: #"\b(?:\#(keywords.joined(separator: "|")))\b"#,
+      input: Inputs.compilerOutput)
+    let keywordListCaseInsensitive = CrossBenchmark(
+      baseName: "KeywordListCaseInsensitive",
+      regex: #"(?i)\b(?:\#(keywords.joined(separator: "|")))\b"#,
+      input: Inputs.compilerOutput)
+
+    // An allow-list of a few thousand hosts, of which the input mentions a
+    // handful among many that aren't listed.
+    let hosts = (0..<5_000).map { #"host\#($0)\.example\.com"# }
+    let domainAllowList = CrossBenchmark(
+      baseName: "DomainAllowList",
+      regex: #"\b(?:\#(hosts.joined(separator: "|")))\b"#,
+      input: (0..<2_000).map {
+        "GET https://host\($0 * 7 + 3).example.org/index.html from host\($0 * 131).example.com\n"
+      }.joined(),
+      alsoRunScalarSemantic: false)
+
+    keywordList.register(&self)
+    keywordListCaseInsensitive.register(&self)
+    domainAllowList.register(&self)
+  }
+}
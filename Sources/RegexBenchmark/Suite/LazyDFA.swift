@@ -0,0 +1,37 @@
+//===----------------------------------------------------------------------===//
+//
+// This source file is part of the Swift.org open source project
+//
+// Copyright (c) 2025 Apple Inc. and the Swift project authors
+// Licensed under Apache License v2.0 with Runtime Library Exception
+//
+// See https://swift.org/LICENSE.txt for license information
+//
+//===----------------------------------------------------------------------===//
+
+import _StringProcessing
+
+extension BenchmarkRunner {
+  mutating func addLazyDFA() {
+    // Many short matches, each found right away by backtracking, so the
+    // lazy DFA shouldn't scan the rest of the input for any of them.
+    let manyMatches = CrossBenchmark(
+      baseName: "LazyDFAManyMatches",
+      regex: #"[a-z]+[0-9]"#,
+      input: String(repeating: "abc1 ", count: 20_000),
+      includeFirst: true)
+    manyMatches.register(&self)
+
+    // Overlapping quantifiers without a match anywhere, which backtrack
+    // exponentially until the lazy DFA rules the input out. This is
+    // Swift-only, since NSRegularExpression doesn't finish it.
+    let noMatch = #"(a|aa)+b"#
+    register(
+      nameBase: "LazyDFANoMatch",
+      input: String(repeating: "a", count: 5_000),
+      pattern: noMatch,
+      try! Regex(noMatch),
+      .first,
+      alsoRunScalarSemantic: false)
+  }
+}
@@ -0,0 +1,33 @@
+//===----------------------------------------------------------------------===//
+//
+// This source file is part of the Swift.org open source project
+//
+// Copyright (c) 2025 Apple Inc. and the Swift project authors
+// Licensed under Apache License v2.0 with Runtime Library Exception
+//
+// See https://swift.org/LICENSE.txt for license information
+//
+//===----------------------------------------------------------------------===//
+
+import _StringProcessing
+
+extension BenchmarkRunner {
+  mutating func addMappedFile() {
+    // A log file searched for its errors. Copying the file into a string
+    // first allocates the whole file at once, while streaming it from the
+    // mapping only ever holds a chunk.
+    let lines = [
+      "2025-01-01T12:00:01Z INFO  request served in 12ms path=/index.html",
+      "2025-01-01T12:00:02Z DEBUG cache hit key=user:1234",
+      "2025-01-01T12:00:03Z ERROR upstream timed out after 30s host=caf\u{E9}",
+      "2025-01-01T12:00:04Z WARN  slow query took 1500ms table=orders",
+    ]
+    registerMappedFileBenchmark(
+      name: "MappedFileErrors",
+      input: {
+        String(
+          repeating: lines.joined(separator: "\n") + "\n", count: 25_000)
+      },
+      pattern: #"ERROR [^\n]+"#)
+  }
+}
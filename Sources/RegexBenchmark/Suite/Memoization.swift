@@ -0,0 +1,39 @@
+//===----------------------------------------------------------------------===//
+//
+// This source file is part of the Swift.org open source project
+//
+// Copyright (c) 2025 Apple Inc. and the Swift project authors
+// Licensed under Apache License v2.0 with Runtime Library Exception
+//
+// See https://swift.org/LICENSE.txt for license information
+//
+//===----------------------------------------------------------------------===//
+
+import _StringProcessing
+
+extension BenchmarkRunner {
+  mutating func addMemoization() {
+    // Overlapping and nested quantifiers that backtrack exponentially at each
+    // start position before the match at the end is found. These are
+    // Swift-only, since NSRegularExpression doesn't finish them.
+    let input = String(repeating: "a", count: 5_000) + "!"
+
+    let alternation = #"(a|aa)+b|!"#
+    register(
+      nameBase: "MemoizedAlternation",
+      input: input,
+      pattern: alternation,
+      try! Regex(alternation),
+      .first,
+      alsoRunScalarSemantic: false)
+
+    let nested = #"(?:a+)+b|!"#
+    register(
+      nameBase: "MemoizedNestedQuant",
+      input: input,
+      pattern: nested,
+      try! Regex(nested),
+      .first,
+      alsoRunScalarSemantic: false)
+  }
+}
@@ -0,0 +1,42 @@
+//===----------------------------------------------------------------------===//
+//
+// This source file is part of the Swift.org open source project
+//
+// Copyright (c) 2025 Apple Inc. and the Swift project authors
+// Licensed under Apache License v2.0 with Runtime Library Exception
+//
+// See https://swift.org/LICENSE.txt for license information
+//
+//===----------------------------------------------------------------------===//
+
+import _StringProcessing
+
+extension BenchmarkRunner {
+  mutating func addRegexSet() {
+    let lines = Inputs.compilerOutput
+      .split(separator: "\n")
+      .map(String.init)
+
+    // A few hundred rules, as for classifying log lines. Most look for an
+    // error code that never occurs; a handful match, and a few have no
+    // required literal, so they're run against every line.
+    var patterns = (0..<290).map { #"error E\#($0)\b: \w+"# }
+    patterns += [
+      #"error: cannot find type '(\w+)'"#,
+      #"\[\d+/\d+\] Compiling (\w+) (\w+)\.swift"#,
+      #"warning: .+"#,
+      #"/Sources/(\w+)/"#,
+      #"\.swift:\d+:\d+"#,
+      #"\b[A-Z][a-z]+[A-Z]\w*\b"#,
+      #"\d+/\d+"#,
+      #"(?i)planning"#,
+      #"^\s+\^~+"#,
+      #"[a-z]+\.[a-z]+\("#,
+    ]
+
+    registerRegexSetBenchmark(
+      name: "RegexSetCompilerOutput",
+      inputList: lines,
+      patterns: patterns)
+  }
+}
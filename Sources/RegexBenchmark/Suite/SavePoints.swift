@@ -0,0 +1,40 @@
+//===----------------------------------------------------------------------===//
+//
+// This source file is part of the Swift.org open source project
+//
+// Copyright (c) 2025 Apple Inc. and the Swift project authors
+// Licensed under Apache License v2.0 with Runtime Library Exception
+//
+// See https://swift.org/LICENSE.txt for license information
+//
+//===----------------------------------------------------------------------===//
+
+import _StringProcessing
+
+extension BenchmarkRunner {
+  mutating func addSavePoints() {
+    // Every trip through the alternation pushes save points and then writes
+    // a capture, so these measure the cost of pushing and restoring save
+    // points while captures and registers are changing.
+    let alternatingCaptures = CrossBenchmark(
+      baseName: "SavePointCaptures",
+      regex: #"(?:(a)|(b)|(c)|(d))+e"#,
+      input: String(repeating: "abcd", count: 25_000) + "e",
+      isWhole: true)
+    alternatingCaptures.register(&self)
+
+    let keyValues = CrossBenchmark(
+      baseName: "SavePointAlternation",
+      regex: #"(\w+)=(?:"([^"]*)"|(\d+)|(\w+));"#,
+      input: String(
+        repeating: #"name="alice";count=42;flag=on;"#, count: 5_000))
+    keyValues.register(&self)
+
+    // Counted repetition of a group keeps its trip count in an int register.
+    let countedGroup = CrossBenchmark(
+      baseName: "SavePointCountedGroup",
+      regex: #"(?:(\w)(\d)){2,4}x"#,
+      input: String(repeating: "a1b2c3x a1b2c3d4e5y ", count: 5_000))
+    countedGroup.register(&self)
+  }
+}
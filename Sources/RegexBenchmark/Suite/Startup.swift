@@ -0,0 +1,39 @@
+//===----------------------------------------------------------------------===//
+//
+// This source file is part of the Swift.org open source project
+//
+// Copyright (c) 2025 Apple Inc. and the Swift project authors
+// Licensed under Apache License v2.0 with Runtime Library Exception
+//
+// See https://swift.org/LICENSE.txt for license information
+//
+//===----------------------------------------------------------------------===//
+
+import _StringProcessing
+
+extension BenchmarkRunner {
+  mutating func addStartup() {
+    // The rules an app might set up at launch, each used once, so that
+    // creating the regexes dominates.
+    var patterns = (0..<40).map { #"error E\#($0)\b: (\w+)"# }
+    patterns += [
+      #"error: cannot find type '(\w+)'"#,
+      #"\[\d+/\d+\] Compiling (\w+) (\w+)\.swift"#,
+      #"warning: .+"#,
+      #"/Sources/(\w+)/"#,
+      #"\.swift:\d+:\d+"#,
+      #"\b[A-Z][a-z]+[A-Z]\w*\b"#,
+      #"(?i)planning"#,
+      #"^\s+\^~+"#,
+      #"[\w.+-]+@[\w-]+\.[\w.-]+"#,
+      #"(?:\d{1,3}\.){3}\d{1,3}"#,
+      #"https?://[^\s/$.?#].[^\s]*"#,
+      #"\p{Greek}+|\p{Han}+"#,
+    ]
+
+    registerStartupBenchmark(
+      name: "StartupManyRegexes",
+      input: Inputs.compilerOutput,
+      patterns: patterns)
+  }
+}
@@ -15,11 +15,11 @@ extension BenchmarkRunner {
   mutating func addUnicode() {
     // tagged unicode: unicode characters surrounded by html tags
     // use the same html regex, uses backreference + reluctant quantification
-//    let tags = #"<(\w*)\b[^>]*>(.*?)<\/\1>"# // disabled due to \b being unusably slow
-//    let taggedEmojis = CrossBenchmark(
-//      baseName: "TaggedEmojis",
-//      regex: tags,
-//      input: Inputs.taggedEmojis)
+    let tags = #"<(\w*)\b[^>]*>(.*?)<\/\1>"#
+    let taggedEmojis = CrossBenchmark(
+      baseName: "TaggedEmojis",
+      regex: tags,
+      input: Inputs.taggedEmojis)
 
     // Now actually matching emojis
     let emoji = #"(😃|😀|😳|😲|😦|😊|🙊|😘|😏|😳|😒){2,5}"#
@@ -29,7 +29,49 @@ extension BenchmarkRunner {
       regex: emoji,
       input: Inputs.taggedEmojis)
 
-    // taggedEmojis.register(&self)
+    taggedEmojis.register(&self)
     emojiRegex.register(&self)
+
+    // Script properties, as used by tokenizers for multilingual text
+    let multilingual = String(repeating: """
+      The quick brown fox 快速的棕色狐狸 быстрая коричневая лиса \
+      η γρήγορη καφέ αλεπού すばやい茶色のキツネ الثعلب البني السريع
+      
+      """, count: 200)
+
+    let han = CrossBenchmark(
+      baseName: "ScriptHan",
+      regex: #"\p{Han}+"#,
+      input: multilingual)
+    let cyrillic = CrossBenchmark(
+      baseName: "ScriptCyrillic",
+      regex: #"\p{Cyrillic}+"#,
+      input: multilingual)
+    let hiraganaExtensions = CrossBenchmark(
+      baseName: "ScriptExtensionsHiragana",
+      regex: #"\p{scx=Hiragana}+"#,
+      input: multilingual)
+
+    han.register(&self)
+    cyrillic.register(&self)
+    hiraganaExtensions.register(&self)
+
+    // Runs of general categories, as in word and number tokenizers
+    let letters = CrossBenchmark(
+      baseName: "PropertyRunLetters",
+      regex: #"\p{L}+"#,
+      input: multilingual)
+    let digitsAndConnectors = CrossBenchmark(
+      baseName: "PropertyRunDigitsAndConnectors",
+      regex: #"[\p{Nd}\p{Pc}]+"#,
+      input: multilingual)
+    let nonLetters = CrossBenchmark(
+      baseName: "PropertyRunNonLetters",
+      regex: #"\P{L}+"#,
+      input: multilingual)
+
+    letters.register(&self)
+    digitsAndConnectors.register(&self)
+    nonLetters.register(&self)
   }
 }
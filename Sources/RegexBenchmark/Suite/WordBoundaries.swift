@@ -0,0 +1,46 @@
+//===----------------------------------------------------------------------===//
+//
+// This source file is part of the Swift.org open source project
+//
+// Copyright (c) 2025 Apple Inc. and the Swift project authors
+// Licensed under Apache License v2.0 with Runtime Library Exception
+//
+// See https://swift.org/LICENSE.txt for license information
+//
+//===----------------------------------------------------------------------===//
+
+import _StringProcessing
+
+extension BenchmarkRunner {
+  mutating func addWordBoundaries() {
+    // Tokenizing into words tests a boundary at both ends of every word.
+    let words = #"\b\w+\b"#
+    let htmlWords = CrossBenchmark(
+      baseName: "WordTokensHtml",
+      regex: words,
+      input: Inputs.swiftOrgHTML,
+      alsoRunSimpleWordBoundaries: true)
+    let devanagariWords = CrossBenchmark(
+      baseName: "WordTokensDevanagari",
+      regex: words,
+      input: Inputs.taggedDevanagari,
+      alsoRunSimpleWordBoundaries: true)
+
+    // Searching for a whole word tests a boundary before each candidate.
+    let htmlSearch = CrossBenchmark(
+      baseName: "WholeWordSearchHtml",
+      regex: #"\bSwift\b"#,
+      input: Inputs.swiftOrgHTML,
+      alsoRunSimpleWordBoundaries: true)
+    let emojiSearch = CrossBenchmark(
+      baseName: "WholeWordSearchTaggedEmojis",
+      regex: #"\bdata\b"#,
+      input: Inputs.taggedEmojis,
+      alsoRunSimpleWordBoundaries: true)
+
+    htmlWords.register(&self)
+    devanagariWords.register(&self)
+    htmlSearch.register(&self)
+    emojiSearch.register(&self)
+  }
+}
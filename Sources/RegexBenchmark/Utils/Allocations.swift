@@ -0,0 +1,47 @@
+//===----------------------------------------------------------------------===//
+//
+// This source file is part of the Swift.org open source project
+//
+// Copyright (c) 2025 Apple Inc. and the Swift project authors
+// Licensed under Apache License v2.0 with Runtime Library Exception
+//
+// See https://swift.org/LICENSE.txt for license information
+//
+//===----------------------------------------------------------------------===//
+
+import CRegexBenchmark
+
+/// The heap allocations made by a run of a benchmark.
+struct Allocations: Codable, CustomStringConvertible {
+  /// The number of allocations, including reallocations.
+  let count: Int
+  /// The number of bytes requested.
+  let bytes: Int
+
+  /// Counts the allocations made while running `body`, or returns `nil` if
+  /// allocations can't be counted on this platform.
+  ///
+  /// Allocations made by other threads during the call are counted too.
+  static func measure(_ body: () -> Void) -> Allocations? {
+    guard regex_benchmark_canCountAllocations() else {
+      return nil
+    }
+    regex_benchmark_startCountingAllocations()
+    body()
+    let result = regex_benchmark_stopCountingAllocations()
+    return Allocations(count: Int(result.count), bytes: Int(result.bytes))
+  }
+
+  var description: String {
+    "\(count) (\(Size(bytes))B)"
+  }
+
+  /// The columns for allocations in CSV output.
+  static var csvHeader: String {
+    "allocations, allocated_bytes"
+  }
+
+  var asCSV: String {
+    "\(count), \(bytes)"
+  }
+}
@@ -0,0 +1,84 @@
+//===----------------------------------------------------------------------===//
+//
+// This source file is part of the Swift.org open source project
+//
+// Copyright (c) 2025 Apple Inc. and the Swift project authors
+// Licensed under Apache License v2.0 with Runtime Library Exception
+//
+// See https://swift.org/LICENSE.txt for license information
+//
+//===----------------------------------------------------------------------===//
+
+import CRegexBenchmark
+
+/// The hardware events counted during a run of a benchmark, averaged over
+/// the runs that were timed. Events the machine can't count are `nil`.
+struct HardwareCounters: Codable, CustomStringConvertible {
+  var instructions: Int?
+  var cycles: Int?
+  var branchMisses: Int?
+  var l1DataCacheMisses: Int?
+  var lastLevelCacheMisses: Int?
+
+  /// Whether the counters could be opened, checked once per process.
+  static let isAvailable = regex_benchmark_openPerfCounters()
+
+  /// Counts the hardware events while running `body`, dividing the counts by
+  /// `runs`, or returns `nil` if no events can be counted.
+  static func measure<T>(
+    runs: Int,
+    _ body: () -> T
+  ) -> (result: T, counters: HardwareCounters?) {
+    guard isAvailable else {
+      return (body(), nil)
+    }
+    regex_benchmark_startPerfCounters()
+    let result = body()
+    let counts = regex_benchmark_stopPerfCounters()
+
+    func perRun(_ count: Int64) -> Int? {
+      count < 0 ? nil : Int(count) / max(runs, 1)
+    }
+    return (result, HardwareCounters(
+      instructions: perRun(counts.instructions),
+      cycles: perRun(counts.cycles),
+      branchMisses: perRun(counts.branchMisses),
+      l1DataCacheMisses: perRun(counts.l1DataCacheMisses),
+      lastLevelCacheMisses: perRun(counts.lastLevelCacheMisses)))
+  }
+
+  /// Instructions per cycle.
+  var ipc: Double? {
+    guard let instructions, let cycles, cycles > 0 else { return nil }
+    return Double(instructions) / Double(cycles)
+  }
+
+  var description: String {
+    func format(_ count: Int?) -> String {
+      count.map(String.init) ?? "N/A"
+    }
+    var result = """
+      instructions: \(format(instructions)), cycles: \(format(cycles))
+      """
+    if let ipc {
+      result += " (IPC \((ipc * 100).rounded() / 100))"
+    }
+    result += """
+      , branch misses: \(format(branchMisses)), \
+      L1D misses: \(format(l1DataCacheMisses)), \
+      LLC misses: \(format(lastLevelCacheMisses))
+      """
+    return result
+  }
+
+  /// The columns for these counters in CSV output.
+  static var csvHeader: String {
+    "instructions, cycles, branch_misses, l1d_misses, llc_misses"
+  }
+
+  var asCSV: String {
+    [instructions, cycles, branchMisses, l1DataCacheMisses, lastLevelCacheMisses]
+      .map { $0.map(String.init) ?? "N/A" }
+      .joined(separator: ", ")
+  }
+}
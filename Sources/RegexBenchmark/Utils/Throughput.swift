@@ -0,0 +1,63 @@
+//===----------------------------------------------------------------------===//
+//
+// This source file is part of the Swift.org open source project
+//
+// Copyright (c) 2025 Apple Inc. and the Swift project authors
+// Licensed under Apache License v2.0 with Runtime Library Exception
+//
+// See https://swift.org/LICENSE.txt for license information
+//
+//===----------------------------------------------------------------------===//
+
+/// The rate at which a benchmark searched its input, across all the threads
+/// searching it at once.
+struct Throughput: Codable, CustomStringConvertible {
+  var bytesPerSecond: Double
+  var matchesPerSecond: Double
+  var threads: Int = 1
+  /// The throughput as a fraction of one thread's throughput multiplied by
+  /// `threads`, if measured.
+  var scalingEfficiency: Double? = nil
+
+  /// Creates the throughput of `threads` threads each searching `inputBytes`
+  /// bytes and finding `matches` matches, taking `time` overall.
+  init(inputBytes: Int, matches: Int, threads: Int = 1, time: Time) {
+    let seconds = max(time.seconds, Time.nanosecond.seconds)
+    self.bytesPerSecond = Double(inputBytes * threads) / seconds
+    self.matchesPerSecond = Double(matches * threads) / seconds
+    self.threads = threads
+  }
+
+  var megabytesPerSecond: Double {
+    bytesPerSecond / Double(1 << 20)
+  }
+
+  var description: String {
+    func rounded(_ value: Double) -> Double {
+      (value * 10).rounded() / 10
+    }
+    var result = """
+      \(rounded(megabytesPerSecond)) MB/s, \
+      \(rounded(matchesPerSecond)) matches/s
+      """
+    if threads > 1 {
+      result += " on \(threads) threads"
+      if let scalingEfficiency {
+        result += " (scaling efficiency \(rounded(scalingEfficiency * 100))%)"
+      }
+    }
+    return result
+  }
+
+  /// The columns for throughput in CSV output.
+  static var csvHeader: String {
+    "mb_per_second, matches_per_second, threads, scaling_efficiency"
+  }
+
+  var asCSV: String {
+    """
+    \(megabytesPerSecond), \(matchesPerSecond), \(threads), \
+    \(scalingEfficiency.map { String($0) } ?? "N/A")
+    """
+  }
+}
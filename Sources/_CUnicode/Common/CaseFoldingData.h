@@ -0,0 +1,508 @@
+//===----------------------------------------------------------------------===//
+//
+// This source file is part of the Swift.org open source project
+//
+// Copyright (c) 2025 Apple Inc. and the Swift project authors
+// Licensed under Apache License v2.0 with Runtime Library Exception
+//
+// See https://swift.org/LICENSE.txt for license information
+//
+//===----------------------------------------------------------------------===//
+
+// This was auto-generated by utils/gen-unicode-data/GenCaseFolding,
+// please do not edit this file yourself!
+
+#ifndef CASE_FOLDING_DATA_H
+#define CASE_FOLDING_DATA_H
+
+#include "stdint.h"
+
+#define CASE_FOLDING_TRIE_BLOCK_BITS 5
+#define CASE_FOLDING_TRIE_VALUE_BITS 4
+#define CASE_FOLDING_MAX_LENGTH 3
+
+
+static const int32_t _swift_stdlib_case_folding_distances[99] = {
+  0, -42319, -42315, -42308, -42307, -42305, -42282, -42280, -42261, -42258, -38864, -35384, -35332,
+  -10815, -10783, -10782, -10780, -10749, -10743, -10727, -8383, -8262, -7615, -7517, -7173, -6222,
+  -6221, -6212, -6211, -6210, -6204, -6180, -3814, -3008, -268, -195, -163, -130, -128, -126, -121,
+  -112, -100, -97, -86, -74, -64, -60, -58, -56, -54, -48, -30, -25, -22, -15, -9, -8, -7, 1, 2, 8,
+  15, 16, 26, 28, 32, 34, 37, 38, 39, 40, 48, 63, 64, 69, 71, 79, 80, 116, 202, 203, 205, 206, 207,
+  209, 210, 211, 213, 214, 217, 218, 219, 775, 928, 7264, 10792, 10795, 35267,
+};
+
+static const uint32_t _swift_stdlib_full_case_folding_data[312] = {
+  0x73, 0x73, 0x0, 0x69, 0x307, 0x0, 0x2BC, 0x6E, 0x0, 0x6A, 0x30C, 0x0, 0x3B9, 0x308, 0x301, 0x3C5,
+  0x308, 0x301, 0x565, 0x582, 0x0, 0x68, 0x331, 0x0, 0x74, 0x308, 0x0, 0x77, 0x30A, 0x0, 0x79,
+  0x30A, 0x0, 0x61, 0x2BE, 0x0, 0x73, 0x73, 0x0, 0x3C5, 0x313, 0x0, 0x3C5, 0x313, 0x300, 0x3C5,
+  0x313, 0x301, 0x3C5, 0x313, 0x342, 0x1F00, 0x3B9, 0x0, 0x1F01, 0x3B9, 0x0, 0x1F02, 0x3B9, 0x0,
+  0x1F03, 0x3B9, 0x0, 0x1F04, 0x3B9, 0x0, 0x1F05, 0x3B9, 0x0, 0x1F06, 0x3B9, 0x0, 0x1F07, 0x3B9,
+  0x0, 0x1F00, 0x3B9, 0x0, 0x1F01, 0x3B9, 0x0, 0x1F02, 0x3B9, 0x0, 0x1F03, 0x3B9, 0x0, 0x1F04,
+  0x3B9, 0x0, 0x1F05, 0x3B9, 0x0, 0x1F06, 0x3B9, 0x0, 0x1F07, 0x3B9, 0x0, 0x1F20, 0x3B9, 0x0,
+  0x1F21, 0x3B9, 0x0, 0x1F22, 0x3B9, 0x0, 0x1F23, 0x3B9, 0x0, 0x1F24, 0x3B9, 0x0, 0x1F25, 0x3B9,
+  0x0, 0x1F26, 0x3B9, 0x0, 0x1F27, 0x3B9, 0x0, 0x1F20, 0x3B9, 0x0, 0x1F21, 0x3B9, 0x0, 0x1F22,
+  0x3B9, 0x0, 0x1F23, 0x3B9, 0x0, 0x1F24, 0x3B9, 0x0, 0x1F25, 0x3B9, 0x0, 0x1F26, 0x3B9, 0x0,
+  0x1F27, 0x3B9, 0x0, 0x1F60, 0x3B9, 0x0, 0x1F61, 0x3B9, 0x0, 0x1F62, 0x3B9, 0x0, 0x1F63, 0x3B9,
+  0x0, 0x1F64, 0x3B9, 0x0, 0x1F65, 0x3B9, 0x0, 0x1F66, 0x3B9, 0x0, 0x1F67, 0x3B9, 0x0, 0x1F60,
+  0x3B9, 0x0, 0x1F61, 0x3B9, 0x0, 0x1F62, 0x3B9, 0x0, 0x1F63, 0x3B9, 0x0, 0x1F64, 0x3B9, 0x0,
+  0x1F65, 0x3B9, 0x0, 0x1F66, 0x3B9, 0x0, 0x1F67, 0x3B9, 0x0, 0x1F70, 0x3B9, 0x0, 0x3B1, 0x3B9, 0x0,
+  0x3AC, 0x3B9, 0x0, 0x3B1, 0x342, 0x0, 0x3B1, 0x342, 0x3B9, 0x3B1, 0x3B9, 0x0, 0x1F74, 0x3B9, 0x0,
+  0x3B7, 0x3B9, 0x0, 0x3AE, 0x3B9, 0x0, 0x3B7, 0x342, 0x0, 0x3B7, 0x342, 0x3B9, 0x3B7, 0x3B9, 0x0,
+  0x3B9, 0x308, 0x300, 0x3B9, 0x308, 0x301, 0x3B9, 0x342, 0x0, 0x3B9, 0x308, 0x342, 0x3C5, 0x308,
+  0x300, 0x3C5, 0x308, 0x301, 0x3C1, 0x313, 0x0, 0x3C5, 0x342, 0x0, 0x3C5, 0x308, 0x342, 0x1F7C,
+  0x3B9, 0x0, 0x3C9, 0x3B9, 0x0, 0x3CE, 0x3B9, 0x0, 0x3C9, 0x342, 0x0, 0x3C9, 0x342, 0x3B9, 0x3C9,
+  0x3B9, 0x0, 0x66, 0x66, 0x0, 0x66, 0x69, 0x0, 0x66, 0x6C, 0x0, 0x66, 0x66, 0x69, 0x66, 0x66, 0x6C,
+  0x73, 0x74, 0x0, 0x73, 0x74, 0x0, 0x574, 0x576, 0x0, 0x574, 0x565, 0x0, 0x574, 0x56B, 0x0, 0x57E,
+  0x576, 0x0, 0x574, 0x56D, 0x0,
+};
+
+static const uint8_t _swift_stdlib_case_folding_index[2176] = {
+  0x0, 0x1, 0x2, 0x3, 0x4, 0x5, 0x6, 0x7, 0x8, 0x9, 0xA, 0xB, 0xC, 0xD, 0xE, 0xF, 0x10, 0x11, 0x12,
+  0xA, 0xA, 0x13, 0x14, 0xA, 0x15, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA,
+  0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA,
+  0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA,
+  0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0x16, 0x17, 0x18, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
+  0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x1A, 0xA,
+  0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0x1B, 0x1C, 0xA, 0x1D,
+  0x1E, 0x1F, 0x20, 0xA, 0xA, 0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x27, 0x28, 0x29, 0x2A, 0xA, 0xA,
+  0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA,
+  0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0x2B, 0xA,
+  0x2C, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA,
+  0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA,
+  0xA, 0x2D, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0x2E, 0x2F, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA,
+  0x30, 0x31, 0xA, 0xA, 0x32, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA,
+  0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA,
+  0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA,
+  0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA,
+  0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA,
+  0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA,
+  0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA,
+  0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0x19, 0x33, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA,
+  0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA,
+  0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA,
+  0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA,
+  0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA,
+  0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA,
+  0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA,
+  0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA,
+  0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA,
+  0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA,
+  0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA,
+  0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA,
+  0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA,
+  0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA,
+  0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA,
+  0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA,
+  0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA,
+  0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA,
+  0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA,
+  0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA,
+  0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA,
+  0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA,
+  0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA,
+  0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA,
+  0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA,
+  0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA,
+  0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA,
+  0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA,
+  0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA,
+  0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA,
+  0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA,
+  0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA,
+  0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA,
+  0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA,
+  0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA,
+  0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA,
+  0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA,
+  0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA,
+  0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA,
+  0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA,
+  0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA,
+  0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA,
+  0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA,
+  0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA,
+  0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA,
+  0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA,
+  0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA,
+  0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA,
+  0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA,
+  0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA,
+  0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA,
+  0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA,
+  0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA,
+  0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA,
+  0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA,
+  0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA,
+  0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA,
+  0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA,
+  0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA,
+  0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA,
+  0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA,
+  0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA,
+  0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA,
+  0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA,
+  0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA,
+  0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA,
+  0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA,
+  0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA,
+  0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA,
+  0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA,
+  0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA,
+  0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA,
+  0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA,
+  0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA,
+  0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA,
+  0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA,
+  0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA,
+  0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA,
+  0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA,
+  0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA,
+  0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA,
+  0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA,
+  0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA,
+  0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA,
+  0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA,
+  0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA,
+  0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA,
+  0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA,
+  0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA,
+  0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA,
+  0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA,
+  0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA,
+  0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA,
+  0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA,
+  0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA,
+};
+
+static const uint16_t _swift_stdlib_case_folding_blocks[1664] = {
+  0x0, 0x0, 0x0, 0x0, 0x1, 0x2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0x4, 0x5, 0x6, 0x7, 0x8, 0x9, 0xA,
+  0xB, 0xC, 0xD, 0xA, 0xE, 0xF, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x8, 0x17, 0x18, 0x19,
+  0x1A, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1B, 0x1B, 0x1B, 0x1B, 0x1C, 0x1B,
+  0x1B, 0x1D, 0x1E, 0x1F, 0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x27, 0x28, 0x29, 0x0, 0x2A,
+  0x24, 0x2B, 0x2C, 0x24, 0x24, 0x24, 0x2D, 0x2E, 0x2F, 0x30, 0x24, 0x24, 0x24, 0x31, 0x32, 0x33,
+  0x0, 0x0, 0x34, 0x35, 0x1B, 0x36, 0x37, 0x0, 0x0, 0x0, 0x0, 0x38, 0x39, 0x0, 0x3A, 0x1B, 0x0,
+  0x3B, 0x0, 0x0, 0x0, 0x0, 0x3C, 0x3D, 0x3E, 0x0, 0x0, 0x3F, 0x0, 0x1B, 0x38, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x3A, 0x40, 0x0, 0x41, 0x42, 0x0, 0x0, 0x43, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x44, 0x45, 0x1B, 0x0, 0x0, 0x29, 0x46, 0x47, 0x48, 0x0, 0x0, 0x0, 0x0, 0x0, 0x49, 0x4A,
+  0x4B, 0x0, 0x4C, 0x0, 0x0, 0x0, 0x4D, 0x47, 0x4E, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4F, 0x47, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x49, 0x50, 0x51, 0x0, 0x0, 0x0, 0x52, 0x0, 0x4C, 0x53, 0x54, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x55, 0x56, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4F, 0x57, 0x56, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x58, 0x53, 0x54, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x59, 0x5A, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5B, 0x5C,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5B, 0x5C, 0x0, 0x0, 0x0, 0x0, 0x5D, 0x0, 0x5E, 0x5F, 0x60, 0x29,
+  0x61, 0x62, 0x5F, 0x60, 0x29, 0x63, 0x0, 0x0, 0x0, 0x0, 0x0, 0x64, 0x65, 0x0, 0x0, 0x0, 0x0, 0x47,
+  0x0, 0x66, 0x66, 0x67, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x35, 0x68, 0x0, 0x0, 0x69,
+  0x1B, 0x6A, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6B, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6C, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x52, 0x0, 0x52, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x6D, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x29, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x43, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x6E, 0x0, 0x0, 0x0, 0x0, 0x3B, 0x6F, 0x0, 0x0, 0x0, 0x36, 0x3B, 0x0, 0x0, 0x0, 0x70, 0x71,
+  0x0, 0x72, 0x73, 0x0, 0x3A, 0x74, 0x0, 0x0, 0x75, 0x0, 0x0, 0x0, 0x63, 0x76, 0x0, 0x0, 0x0, 0x54,
+  0x0, 0x0, 0x0, 0x0, 0x77, 0x78, 0x78, 0x79, 0x0, 0x7A, 0x7B, 0x7C, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1B, 0x1B, 0x1B, 0x7D, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8,
+  0x7E, 0x8, 0x8, 0x8, 0x8, 0x8, 0x7F, 0x80, 0x81, 0x80, 0x80, 0x81, 0x82, 0x80, 0x83, 0x84, 0x85,
+  0x86, 0x87, 0x88, 0x89, 0x8A, 0x8B, 0x8C, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x8D, 0x8E, 0x3B, 0x0, 0x0, 0x8F, 0x90, 0x0, 0x0, 0x91, 0x0, 0x92, 0x75, 0x4C, 0x0, 0x6B,
+  0x0, 0x0, 0x0, 0x93, 0x0, 0x94, 0x0, 0x95, 0x0, 0x96, 0x97, 0x97, 0x0, 0x98, 0x0, 0x0, 0x0, 0x99,
+  0x0, 0x0, 0x0, 0x9A, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9B, 0x9C, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x4F, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x32, 0x32, 0x32, 0x0, 0x0, 0x0, 0x9D, 0x9E, 0x24, 0x24, 0x24, 0x24,
+  0x24, 0x24, 0x9F, 0xA0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xA1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x1B, 0x1B, 0x0, 0x0, 0xA2, 0x0, 0x49, 0xA3, 0xA4, 0xA5, 0x0, 0xA6, 0x49, 0xA3, 0xA4, 0xA5, 0x0,
+  0xA7, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x24, 0x24, 0xA8, 0xA9, 0x24, 0xAA, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8C, 0x0, 0x0, 0xAB, 0xAB,
+  0x24, 0x24, 0x24, 0xAC, 0xAD, 0xAE, 0xAF, 0xB0, 0xB1, 0xB2, 0x0, 0xB3, 0x63, 0x0, 0x4F, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x52, 0x0, 0x1B, 0x8C, 0x0, 0x0, 0x4A, 0x0, 0x0, 0xB4, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0xB4, 0x3B, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0xB5, 0x3F, 0x0, 0x0, 0x63, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xB6, 0xB6, 0xB6, 0xB6, 0xB6,
+  0x0, 0x0, 0x47, 0x0, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B,
+  0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B,
+  0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B,
+  0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x74, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1B,
+  0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x83,
+  0xB7, 0xB8, 0x1B, 0x1B, 0x1B, 0x83, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0xB9, 0x0, 0x0, 0xBA,
+  0xBB, 0xA2, 0xBC, 0xBD, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1B,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0x2, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x47, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3B,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xBE, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xBF, 0xBF,
+  0xC0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xBF, 0xBF, 0xC1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0xC2, 0xC2, 0xC3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xC4, 0x0, 0x0, 0xC5, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x56, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xC6, 0xC6, 0xC6, 0xC7, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0xC8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xC9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0xCA, 0x3B, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x63, 0x0,
+  0x0, 0xA1, 0x0, 0xCB, 0xCC, 0x9A, 0x0, 0x0, 0x0, 0x0, 0x6A, 0x0, 0xCD, 0xCE, 0x0, 0x0, 0x0, 0xB4,
+  0x0, 0x0, 0x0, 0x0, 0xCF, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x56, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x9A, 0x0, 0x0, 0x0, 0x0, 0x58, 0x4A, 0x54, 0xD0, 0xD1, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xD2, 0x4C, 0x0, 0x0, 0x0, 0x0, 0x0, 0xD3, 0x76, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xA1, 0xD4, 0x3B, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0xA1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xD5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xCC, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9A, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x28, 0x28, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xD6, 0xB4, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x3B, 0x0, 0x0, 0x0, 0x0, 0x52, 0x54, 0x0, 0x0, 0x0, 0x0, 0x29, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0xA1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xD7,
+  0x0, 0x0, 0x0, 0x0, 0x54, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xD1, 0x0, 0x0, 0x0, 0xD8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x28, 0x28, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8C, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4C, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xD9, 0xDA, 0xDB, 0xDC, 0x0,
+  0x53, 0x3A, 0x3B, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xDD, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0xDE, 0xDF, 0xE0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0xD8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x98, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0xD8, 0x0, 0x0, 0xE1, 0xE1, 0xE2, 0x0, 0xE3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x1B, 0x83, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+};
+
+static const uint16_t _swift_stdlib_case_folding_values[3648] = {
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x42, 0x42,
+  0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42,
+  0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x5D, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8042, 0x8042, 0x8042, 0x8042, 0x8042,
+  0x8042, 0x42, 0x8042, 0x8042, 0x8042, 0x8042, 0x8042, 0x8042, 0x8042, 0x8042, 0x8042, 0x42,
+  0x8042, 0x8042, 0x8042, 0x8042, 0x8042, 0x8042, 0x0, 0x42, 0x8042, 0x8042, 0x8042, 0x8042, 0x8042,
+  0x42, 0x100, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x0, 0x8000, 0x8000, 0x8000, 0x8000,
+  0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x0, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x0,
+  0x0, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x0, 0x8000, 0x803B, 0x8000, 0x803B, 0x8000, 0x803B,
+  0x8000, 0x803B, 0x8000, 0x803B, 0x8000, 0x803B, 0x8000, 0x803B, 0x8000, 0x803B, 0x8000, 0x3B, 0x0,
+  0x803B, 0x8000, 0x803B, 0x8000, 0x803B, 0x8000, 0x803B, 0x8000, 0x803B, 0x8000, 0x803B, 0x8000,
+  0x803B, 0x8000, 0x803B, 0x8000, 0x803B, 0x8000, 0x803B, 0x8000, 0x3B, 0x0, 0x803B, 0x8000, 0x803B,
+  0x8000, 0x803B, 0x8000, 0x803B, 0x8000, 0x8200, 0x0, 0x3B, 0x0, 0x803B, 0x8000, 0x803B, 0x8000,
+  0x0, 0x803B, 0x8000, 0x803B, 0x8000, 0x803B, 0x8000, 0x3B, 0x0, 0x3B, 0x0, 0x803B, 0x8000, 0x803B,
+  0x8000, 0x803B, 0x8000, 0x300, 0x3B, 0x0, 0x803B, 0x8000, 0x803B, 0x8000, 0x803B, 0x8000, 0x3B,
+  0x0, 0x803B, 0x8000, 0x803B, 0x8000, 0x803B, 0x8000, 0x803B, 0x8000, 0x803B, 0x8000, 0x803B,
+  0x8000, 0x803B, 0x8000, 0x803B, 0x8000, 0x803B, 0x8000, 0x803B, 0x8000, 0x8028, 0x803B, 0x8000,
+  0x803B, 0x8000, 0x803B, 0x8000, 0x22, 0x0, 0x56, 0x3B, 0x0, 0x3B, 0x0, 0x53, 0x3B, 0x0, 0x52,
+  0x52, 0x3B, 0x0, 0x0, 0x4D, 0x50, 0x51, 0x3B, 0x0, 0x52, 0x54, 0x0, 0x57, 0x55, 0x3B, 0x0, 0x0,
+  0x0, 0x57, 0x58, 0x0, 0x59, 0x803B, 0x8000, 0x3B, 0x0, 0x3B, 0x0, 0x5B, 0x3B, 0x0, 0x5B, 0x0, 0x0,
+  0x3B, 0x0, 0x5B, 0x803B, 0x8000, 0x5A, 0x5A, 0x3B, 0x0, 0x3B, 0x0, 0x5C, 0x3B, 0x0, 0x0, 0x0,
+  0x3B, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3C, 0x3B, 0x0, 0x3C, 0x3B, 0x0, 0x3C, 0x3B, 0x0,
+  0x803B, 0x8000, 0x803B, 0x8000, 0x803B, 0x8000, 0x803B, 0x8000, 0x803B, 0x8000, 0x803B, 0x8000,
+  0x803B, 0x8000, 0x803B, 0x8000, 0x0, 0x803B, 0x8000, 0x803B, 0x8000, 0x803B, 0x8000, 0x3B, 0x0,
+  0x803B, 0x8000, 0x803B, 0x8000, 0x803B, 0x8000, 0x803B, 0x8000, 0x803B, 0x8000, 0x8400, 0x3C,
+  0x3B, 0x0, 0x803B, 0x8000, 0x2B, 0x31, 0x803B, 0x8000, 0x803B, 0x8000, 0x803B, 0x8000, 0x803B,
+  0x8000, 0x803B, 0x8000, 0x803B, 0x8000, 0x803B, 0x8000, 0x803B, 0x8000, 0x803B, 0x8000, 0x803B,
+  0x8000, 0x3B, 0x0, 0x803B, 0x8000, 0x25, 0x0, 0x3B, 0x0, 0x3B, 0x0, 0x803B, 0x8000, 0x803B,
+  0x8000, 0x803B, 0x8000, 0x803B, 0x8000, 0x803B, 0x8000, 0x803B, 0x8000, 0x803B, 0x8000, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x61, 0x3B, 0x0, 0x24, 0x60, 0x0, 0x0, 0x3B, 0x0, 0x23, 0x4B, 0x4C, 0x3B, 0x0,
+  0x3B, 0x0, 0x3B, 0x0, 0x3B, 0x0, 0x3B, 0x0, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000,
+  0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000,
+  0x8000, 0x8000, 0x8000, 0x804F, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000,
+  0x8000, 0x0, 0x3B, 0x0, 0x3B, 0x0, 0x8000, 0x0, 0x3B, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8000,
+  0x4F, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8000, 0x8045, 0x8000, 0x8044, 0x8044, 0x8044, 0x0, 0x804A, 0x0,
+  0x8049, 0x8049, 0x8500, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42,
+  0x42, 0x42, 0x42, 0x42, 0x42, 0x0, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x8042, 0x8042,
+  0x8000, 0x8000, 0x8000, 0x8000, 0x8600, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3B, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8000, 0x8000, 0x8000,
+  0x8000, 0x8000, 0x3D, 0x34, 0x35, 0x0, 0x8000, 0x8000, 0x37, 0x36, 0x0, 0x3B, 0x0, 0x3B, 0x0,
+  0x3B, 0x0, 0x3B, 0x0, 0x3B, 0x0, 0x3B, 0x0, 0x3B, 0x0, 0x3B, 0x0, 0x3B, 0x0, 0x3B, 0x0, 0x3B, 0x0,
+  0x3B, 0x0, 0x32, 0x33, 0x0, 0x0, 0x2F, 0x2E, 0x0, 0x3B, 0x0, 0x3A, 0x3B, 0x0, 0x0, 0x25, 0x25,
+  0x25, 0x804E, 0x804E, 0x4E, 0x804E, 0x4E, 0x4E, 0x4E, 0x804E, 0x4E, 0x4E, 0x4E, 0x4E, 0x804E,
+  0x804E, 0x804E, 0x4E, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x8042, 0x42, 0x42,
+  0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42,
+  0x42, 0x42, 0x42, 0x42, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8000, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x8000, 0x8000, 0x0, 0x8000, 0x0, 0x0, 0x0, 0x8000, 0x0, 0x0, 0x0, 0x0, 0x8000, 0x8000,
+  0x8000, 0x0, 0x3B, 0x0, 0x3B, 0x0, 0x3B, 0x0, 0x803B, 0x8000, 0x3B, 0x0, 0x3B, 0x0, 0x3B, 0x0,
+  0x3B, 0x0, 0x3B, 0x0, 0x0, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x0, 0x0, 0x3B, 0x0, 0x3B, 0x0,
+  0x3B, 0x0, 0x3E, 0x803B, 0x8000, 0x3B, 0x0, 0x3B, 0x0, 0x3B, 0x0, 0x3B, 0x0, 0x3B, 0x0, 0x3B, 0x0,
+  0x0, 0x803B, 0x8000, 0x803B, 0x8000, 0x3B, 0x0, 0x803B, 0x8000, 0x3B, 0x0, 0x803B, 0x8000, 0x803B,
+  0x8000, 0x803B, 0x8000, 0x3B, 0x0, 0x803B, 0x8000, 0x803B, 0x8000, 0x803B, 0x8000, 0x3B, 0x0,
+  0x803B, 0x8000, 0x803B, 0x8000, 0x803B, 0x8000, 0x803B, 0x8000, 0x803B, 0x8000, 0x803B, 0x8000,
+  0x3B, 0x0, 0x803B, 0x8000, 0x3B, 0x0, 0x3B, 0x0, 0x3B, 0x0, 0x0, 0x48, 0x48, 0x48, 0x48, 0x48,
+  0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48,
+  0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48,
+  0x48, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x700, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000,
+  0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000,
+  0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x0, 0x8000, 0x0,
+  0x8000, 0x8000, 0x0, 0x8000, 0x8000, 0x0, 0x8000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8000,
+  0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8000, 0x8000, 0x8000, 0x8000,
+  0x8000, 0x8000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8000,
+  0x0, 0x8000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x8000, 0x0, 0x0, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x0, 0x0, 0x8000,
+  0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x0, 0x0, 0x8000, 0x8000, 0x0, 0x8000, 0x8000, 0x8000,
+  0x8000, 0x0, 0x0, 0x0, 0x8000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x8000, 0x8000, 0x8000, 0x8000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8000, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8000, 0x8000, 0x8000, 0x8000, 0x0, 0x8000, 0x8000, 0x8000,
+  0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x0, 0x8000, 0x8000, 0x8000, 0x0, 0x8000, 0x8000,
+  0x8000, 0x8000, 0x8000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8000, 0x8000,
+  0x8000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000,
+  0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x0, 0x8000, 0x8000, 0x8000,
+  0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x0, 0x8000, 0x0,
+  0x0, 0x8000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8000, 0x0, 0x0, 0x0, 0x8000, 0x8000, 0x8000, 0x8000,
+  0x0, 0x0, 0x0, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8000, 0x0, 0x8000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x8000, 0x8000, 0x8000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x8000, 0x0, 0x0, 0x0, 0x0, 0x8000, 0x8000, 0x0, 0x8000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8000, 0x0, 0x0, 0x0, 0x0, 0x8000, 0x0, 0x0, 0x8000, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x8000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8000, 0x8000,
+  0x8000, 0x0, 0x0, 0x8000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8000,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8000, 0x0, 0x0, 0x8000, 0x8000, 0x8000,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8000, 0x8000, 0x0, 0x0, 0x0, 0x0, 0x8000, 0x8000, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x8000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8000, 0x8000, 0x8000, 0x8000, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x8000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x8000, 0x0, 0x0, 0x0, 0x0, 0x8000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8000, 0x8000,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8000, 0x0, 0x8000, 0x0, 0x0, 0x0, 0x0, 0x8000,
+  0x8000, 0x0, 0x8000, 0x8000, 0x0, 0x8000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x8000, 0x8000, 0x0, 0x8000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x8000, 0x0, 0x0, 0x0, 0x0, 0x8000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8000, 0x0,
+  0x8000, 0x8000, 0x8000, 0x8000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8000, 0x8000, 0x8000,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8000, 0x8000, 0x8000, 0x8000,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8000, 0x8000, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8000, 0x0, 0x8000, 0x0, 0x8000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x8000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8000, 0x0, 0x0, 0x0, 0x0,
+  0x8000, 0x0, 0x0, 0x0, 0x0, 0x8000, 0x0, 0x0, 0x0, 0x0, 0x8000, 0x0, 0x0, 0x0, 0x0, 0x8000,
+  0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x0, 0x8000, 0x0, 0x8000, 0x8000, 0x8000, 0x8000, 0x0,
+  0x0, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x0, 0x8000, 0x8000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x8000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8000, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x8000, 0x0, 0x8000, 0x8000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5F, 0x5F, 0x5F, 0x5F,
+  0x5F, 0x5F, 0x5F, 0x5F, 0x5F, 0x5F, 0x5F, 0x5F, 0x5F, 0x5F, 0x5F, 0x5F, 0x5F, 0x5F, 0x5F, 0x5F,
+  0x5F, 0x5F, 0x0, 0x5F, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5F, 0x0, 0x0, 0x8000, 0x8000, 0x8000, 0x8000,
+  0x8000, 0x8000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8000, 0x8000, 0x8000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x39, 0x39, 0x39, 0x39, 0x39, 0x39, 0x0, 0x0, 0x0, 0x0, 0x8000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x8000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8000, 0x8000, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000,
+  0x8000, 0x8000, 0x0, 0x0, 0x8000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8000, 0x0, 0x8000, 0x0, 0x8000,
+  0x0, 0x8000, 0x0, 0x8000, 0x0, 0x0, 0x0, 0x8000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8000, 0x8000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8000, 0x0, 0x8000,
+  0x0, 0x0, 0x8000, 0x8000, 0x0, 0x8000, 0x8000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x8000, 0x8000, 0x8000, 0x8000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8000, 0x8000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x8000, 0x8000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x19, 0x1A, 0x1B,
+  0x1D, 0x1D, 0x1C, 0x1E, 0x1F, 0x62, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x21, 0x21, 0x21, 0x21,
+  0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21,
+  0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x0, 0x0, 0x21, 0x21, 0x21, 0x8000, 0x8000, 0x8000, 0x0,
+  0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000,
+  0x8000, 0x0, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x0, 0x0, 0x0, 0x0, 0x8000,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8000, 0x0, 0x0, 0x0, 0x8000, 0x8000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x0, 0x8000,
+  0x8000, 0x8000, 0x8000, 0x8000, 0x803B, 0x8000, 0x803B, 0x8000, 0x803B, 0x8000, 0x8800, 0x8900,
+  0x8A00, 0x8B00, 0xC00, 0x8030, 0x0, 0x0, 0xD16, 0x0, 0x803B, 0x8000, 0x803B, 0x8000, 0x803B,
+  0x8000, 0x803B, 0x8000, 0x803B, 0x8000, 0x3B, 0x0, 0x3B, 0x0, 0x3B, 0x0, 0x8000, 0x8000, 0x8000,
+  0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8039, 0x8039, 0x8039, 0x8039, 0x8039, 0x8039, 0x8039,
+  0x8039, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x0, 0x0, 0x8039, 0x8039, 0x8039, 0x8039,
+  0x8039, 0x8039, 0x0, 0x0, 0x8E00, 0x8000, 0x8F00, 0x8000, 0x9000, 0x8000, 0x9100, 0x8000, 0x0,
+  0x8039, 0x0, 0x8039, 0x0, 0x8039, 0x0, 0x8039, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000,
+  0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x0, 0x0, 0x9200, 0x9300, 0x9400,
+  0x9500, 0x9600, 0x9700, 0x9800, 0x9900, 0x9A39, 0x9B39, 0x9C39, 0x9D39, 0x9E39, 0x9F39, 0xA039,
+  0xA139, 0xA200, 0xA300, 0xA400, 0xA500, 0xA600, 0xA700, 0xA800, 0xA900, 0xAA39, 0xAB39, 0xAC39,
+  0xAD39, 0xAE39, 0xAF39, 0xB039, 0xB139, 0xB200, 0xB300, 0xB400, 0xB500, 0xB600, 0xB700, 0xB800,
+  0xB900, 0xBA39, 0xBB39, 0xBC39, 0xBD39, 0xBE39, 0xBF39, 0xC039, 0xC139, 0x8000, 0x8000, 0xC200,
+  0xC300, 0xC400, 0x0, 0xC500, 0xC600, 0x8039, 0x8039, 0x802D, 0x802D, 0xC738, 0x0, 0x8018, 0x0,
+  0x0, 0x8000, 0xC800, 0xC900, 0xCA00, 0x0, 0xCB00, 0xCC00, 0x802C, 0x802C, 0x802C, 0x802C, 0xCD38,
+  0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0xCE00, 0xCF00, 0x0, 0x0, 0xD000, 0xD100, 0x8039, 0x8039,
+  0x802A, 0x802A, 0x0, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0xD200, 0xD300, 0xD400, 0x8000,
+  0xD500, 0xD600, 0x8039, 0x8039, 0x8029, 0x8029, 0x803A, 0x8000, 0x8000, 0x8000, 0x0, 0x0, 0xD700,
+  0xD800, 0xD900, 0x0, 0xDA00, 0xDB00, 0x8026, 0x8026, 0x8027, 0x8027, 0xDC38, 0x8000, 0x0, 0x0,
+  0x8000, 0x8000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8000,
+  0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000,
+  0x0, 0x0, 0x0, 0x0, 0x8000, 0x0, 0x0, 0x0, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000,
+  0x8000, 0x8000, 0x8000, 0x8000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8017, 0x0, 0x0, 0x0, 0x8014,
+  0x8015, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x41, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F,
+  0x3F, 0x3F, 0x0, 0x0, 0x0, 0x3B, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x8000, 0x0, 0x0, 0x0, 0x0, 0x8000, 0x0, 0x0, 0x8000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x8000, 0x0, 0x8000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8000, 0x0, 0x0,
+  0x8000, 0x0, 0x0, 0x8000, 0x0, 0x8000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8000, 0x0, 0x8000, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x0, 0x0,
+  0x8000, 0x8000, 0x0, 0x0, 0x8000, 0x8000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8000, 0x8000, 0x8000, 0x8000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x8000, 0x8000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x40,
+  0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40,
+  0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x3B, 0x0, 0x12, 0x20, 0x13, 0x0, 0x0, 0x3B,
+  0x0, 0x3B, 0x0, 0x3B, 0x0, 0x10, 0x11, 0xE, 0xF, 0x0, 0x3B, 0x0, 0x0, 0x3B, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0xD, 0xD, 0x3B, 0x0, 0x3B, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3B, 0x0,
+  0x3B, 0x0, 0x8000, 0x8000, 0x8000, 0x3B, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8000, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000,
+  0x8000, 0x0, 0x8000, 0x0, 0x8000, 0x0, 0x8000, 0x0, 0x8000, 0x0, 0x8000, 0x0, 0x8000, 0x0, 0x8000,
+  0x0, 0x8000, 0x0, 0x8000, 0x0, 0x0, 0x8000, 0x0, 0x8000, 0x0, 0x8000, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x8000, 0x8000, 0x0, 0x8000, 0x8000, 0x0, 0x8000, 0x8000, 0x0, 0x8000, 0x8000, 0x0, 0x8000,
+  0x8000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8000, 0x0, 0x0, 0x0, 0x0, 0x8000, 0x8000, 0x0, 0x0, 0x0,
+  0x8000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8000, 0x0, 0x0, 0x8000, 0x8000, 0x8000, 0x8000, 0x0, 0x0, 0x0,
+  0x8000, 0x0, 0x3B, 0x0, 0x3B, 0x0, 0x3B, 0x0, 0x3B, 0x0, 0x3B, 0x0, 0x3B, 0x0, 0x3B, 0x0, 0x0,
+  0x8000, 0x0, 0x0, 0x0, 0x0, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000,
+  0x8000, 0x8000, 0x0, 0x0, 0x3B, 0x0, 0x3B, 0x0, 0x3B, 0x0, 0x3B, 0x0, 0x3B, 0x0, 0x3B, 0x0, 0x0,
+  0x0, 0x8000, 0x8000, 0x0, 0x0, 0x3B, 0x0, 0x3B, 0x0, 0x3B, 0x0, 0x3B, 0x0, 0x3B, 0x0, 0x3B, 0x0,
+  0x3B, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3B, 0x0, 0x3B, 0x0, 0xC, 0x3B, 0x0,
+  0x3B, 0x0, 0x3B, 0x0, 0x3B, 0x0, 0x3B, 0x0, 0x0, 0x0, 0x0, 0x3B, 0x0, 0x7, 0x0, 0x0, 0x3B, 0x0,
+  0x3B, 0x0, 0x0, 0x0, 0x3B, 0x0, 0x3B, 0x0, 0x3B, 0x0, 0x3B, 0x0, 0x3B, 0x0, 0x3B, 0x0, 0x3B, 0x0,
+  0x3B, 0x0, 0x3B, 0x0, 0x3B, 0x0, 0x3, 0x1, 0x2, 0x5, 0x3, 0x0, 0x9, 0x6, 0x8, 0x5E, 0x3B, 0x0,
+  0x3B, 0x0, 0x3B, 0x0, 0x3B, 0x0, 0x3B, 0x0, 0x3B, 0x0, 0x3B, 0x0, 0x3B, 0x0, 0x33, 0x4, 0xB, 0x3B,
+  0x0, 0x3B, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3B, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3B, 0x0, 0x3B, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3B, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x8000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x8000, 0x0, 0x8000, 0x8000, 0x8000, 0x0, 0x0, 0x8000, 0x8000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8000,
+  0x8000, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0x8000,
+  0x0, 0x8000, 0x0, 0x0, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000,
+  0x8000, 0x0, 0x8000, 0x0, 0x8000, 0x0, 0x0, 0x8000, 0x8000, 0x0, 0x0, 0x0, 0x8000, 0x8000, 0x8000,
+  0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000,
+  0x8000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5D00, 0x5E00, 0x5F00, 0x6000, 0x6100, 0x6200, 0x6300, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6400, 0x6500, 0x6600, 0x6700, 0x6800,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000,
+  0x8000, 0x0, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x0, 0x8000, 0x0, 0x8000, 0x8000, 0x0,
+  0x8000, 0x8000, 0x0, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x47, 0x47, 0x47, 0x47, 0x47, 0x47, 0x47, 0x47, 0x47, 0x47, 0x47, 0x47, 0x47, 0x47, 0x47, 0x47,
+  0x47, 0x47, 0x47, 0x47, 0x47, 0x47, 0x47, 0x47, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x47,
+  0x47, 0x47, 0x47, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x46, 0x46, 0x46,
+  0x46, 0x46, 0x46, 0x46, 0x46, 0x46, 0x46, 0x46, 0x0, 0x46, 0x46, 0x46, 0x46, 0x46, 0x46, 0x46,
+  0x0, 0x46, 0x46, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8000, 0x0, 0x8000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x8000, 0x8000, 0x8000, 0x0, 0x0, 0x0, 0x0, 0x8000, 0x4A, 0x4A, 0x4A, 0x4A, 0x4A, 0x4A, 0x4A,
+  0x4A, 0x4A, 0x4A, 0x4A, 0x4A, 0x4A, 0x4A, 0x4A, 0x4A, 0x4A, 0x4A, 0x4A, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8000, 0x8000, 0x8000, 0x8000, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8000,
+  0x8000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000,
+  0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8000,
+  0x0, 0x8000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8000, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8000,
+  0x8000, 0x0, 0x0, 0x0, 0x8000, 0x8000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x8000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x0, 0x0, 0x0, 0x8000,
+  0x8000, 0x8000, 0x8000, 0x8000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x8000, 0x0, 0x0, 0x0, 0x8000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8000, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8000, 0x8000, 0x0, 0x0, 0x0, 0x8000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x8000, 0x8000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x8000, 0x0, 0x0, 0x0, 0x0, 0x8000, 0x8000, 0x0, 0x0, 0x0, 0x8000, 0x0, 0x8000, 0x8000, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000,
+  0x8000, 0x8000, 0x8000, 0x0, 0x0, 0x0, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x0,
+  0x0, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8000,
+  0x8000, 0x8000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8000, 0x8000, 0x8000,
+  0x8000, 0x8000, 0x8000, 0x8000, 0x0, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000,
+  0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x0, 0x0, 0x8000,
+  0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x0, 0x8000, 0x8000, 0x0, 0x8000, 0x8000, 0x8000,
+  0x8000, 0x8000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43,
+  0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000,
+  0x8000, 0x0, 0x0, 0x0, 0x0, 0x0,
+};
+
+#endif // #ifndef CASE_FOLDING_DATA_H
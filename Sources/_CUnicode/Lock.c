@@ -0,0 +1,75 @@
+//===----------------------------------------------------------------------===//
+//
+// This source file is part of the Swift.org open source project
+//
+// Copyright (c) 2025 Apple Inc. and the Swift project authors
+// Licensed under Apache License v2.0 with Runtime Library Exception
+//
+// See https://swift.org/LICENSE.txt for license information
+//
+//===----------------------------------------------------------------------===//
+
+#include "include/UnicodeData.h"
+
+#include <stdlib.h>
+
+#if defined(__APPLE__)
+#include <os/lock.h>
+typedef os_unfair_lock PlatformLock;
+#elif defined(_WIN32)
+#define WIN32_LEAN_AND_MEAN
+#include <windows.h>
+typedef SRWLOCK PlatformLock;
+#else
+#include <pthread.h>
+typedef pthread_mutex_t PlatformLock;
+#endif
+
+SWIFT_CC
+void *_swift_string_processing_createLock(void) {
+  PlatformLock *lock = malloc(sizeof(PlatformLock));
+  if (lock == NULL) {
+    return NULL;
+  }
+#if defined(__APPLE__)
+  *lock = OS_UNFAIR_LOCK_INIT;
+#elif defined(_WIN32)
+  InitializeSRWLock(lock);
+#else
+  if (pthread_mutex_init(lock, NULL) != 0) {
+    free(lock);
+    return NULL;
+  }
+#endif
+  return lock;
+}
+
+SWIFT_CC
+void _swift_string_processing_destroyLock(void *lock) {
+#if !defined(__APPLE__) && !defined(_WIN32)
+  pthread_mutex_destroy((PlatformLock *)lock);
+#endif
+  free(lock);
+}
+
+SWIFT_CC
+void _swift_string_processing_lock(void *lock) {
+#if defined(__APPLE__)
+  os_unfair_lock_lock((PlatformLock *)lock);
+#elif defined(_WIN32)
+  AcquireSRWLockExclusive((PlatformLock *)lock);
+#else
+  pthread_mutex_lock((PlatformLock *)lock);
+#endif
+}
+
+SWIFT_CC
+void _swift_string_processing_unlock(void *lock) {
+#if defined(__APPLE__)
+  os_unfair_lock_unlock((PlatformLock *)lock);
+#elif defined(_WIN32)
+  ReleaseSRWLockExclusive((PlatformLock *)lock);
+#else
+  pthread_mutex_unlock((PlatformLock *)lock);
+#endif
+}
@@ -0,0 +1,75 @@
+//===----------------------------------------------------------------------===//
+//
+// This source file is part of the Swift.org open source project
+//
+// Copyright (c) 2025 Apple Inc. and the Swift project authors
+// Licensed under Apache License v2.0 with Runtime Library Exception
+//
+// See https://swift.org/LICENSE.txt for license information
+//
+//===----------------------------------------------------------------------===//
+
+#include "Common/CaseFoldingData.h"
+#include "include/UnicodeData.h"
+
+// Returns the case folding data of `scalar` from the three-stage trie; see
+// `emitCaseFolding` in utils/gen-unicode-data for its layout.
+static inline uint16_t getCaseFoldingData(uint32_t scalar) {
+  const uint32_t valueMask = (1 << CASE_FOLDING_TRIE_VALUE_BITS) - 1;
+  const uint32_t blockMask = (1 << CASE_FOLDING_TRIE_BLOCK_BITS) - 1;
+
+  // Scalars past 0x10FFFF aren't in the table, and don't change.
+  if (scalar > 0x10FFFF) {
+    return 0;
+  }
+
+  uint32_t indexIdx = scalar >> (CASE_FOLDING_TRIE_VALUE_BITS
+                                 + CASE_FOLDING_TRIE_BLOCK_BITS);
+  uint32_t blockIdx = (_swift_stdlib_case_folding_index[indexIdx]
+                         << CASE_FOLDING_TRIE_BLOCK_BITS)
+                    | ((scalar >> CASE_FOLDING_TRIE_VALUE_BITS) & blockMask);
+  intptr_t valueIdx = ((intptr_t) _swift_stdlib_case_folding_blocks[blockIdx]
+                         << CASE_FOLDING_TRIE_VALUE_BITS)
+                    | (scalar & valueMask);
+
+  return _swift_stdlib_case_folding_values[valueIdx];
+}
+
+SWIFT_CC
+uint32_t _swift_string_processing_getSimpleCaseFolding(uint32_t scalar) {
+  uint16_t data = getCaseFoldingData(scalar);
+
+  return scalar + _swift_stdlib_case_folding_distances[data & 0xFF];
+}
+
+SWIFT_CC
+intptr_t _swift_string_processing_getFullCaseFolding(uint32_t scalar,
+                                                     uint32_t *folding) {
+  uint16_t data = getCaseFoldingData(scalar);
+  uint16_t fullIdx = (data >> 8) & 0x7F;
+
+  // A zero index means that the full case folding is the simple one.
+  if (fullIdx == 0) {
+    folding[0] = scalar + _swift_stdlib_case_folding_distances[data & 0xFF];
+    return 1;
+  }
+
+  const uint32_t *fullData = _swift_stdlib_full_case_folding_data
+                           + (fullIdx - 1) * CASE_FOLDING_MAX_LENGTH;
+  intptr_t count = 0;
+
+  // Shorter foldings are padded with zeros.
+  while (count != CASE_FOLDING_MAX_LENGTH && fullData[count] != 0) {
+    folding[count] = fullData[count];
+    count += 1;
+  }
+
+  return count;
+}
+
+SWIFT_CC
+bool _swift_string_processing_isCaseFoldingNormalizationSensitive(
+  uint32_t scalar
+) {
+  return (getCaseFoldingData(scalar) & 0x8000) != 0;
+}
@@ -0,0 +1,298 @@
+//===----------------------------------------------------------------------===//
+//
+// This source file is part of the Swift.org open source project
+//
+// Copyright (c) 2025 Apple Inc. and the Swift project authors
+// Licensed under Apache License v2.0 with Runtime Library Exception
+//
+// See https://swift.org/LICENSE.txt for license information
+//
+//===----------------------------------------------------------------------===//
+
+#include <string.h>
+
+#include "Common/GraphemeBreakData.h"
+#include "include/UnicodeData.h"
+
+// The classes in the low bits of the grapheme break table; see
+// `GraphemeBreakClass` in utils/gen-unicode-data.
+enum GraphemeBreakClass {
+  GBC_Any = 0,
+  GBC_CR = 1,
+  GBC_LF = 2,
+  GBC_Control = 3,
+  GBC_Extend = 4,
+  GBC_ZWJ = 5,
+  GBC_RegionalIndicator = 6,
+  GBC_Prepend = 7,
+  GBC_SpacingMark = 8,
+  GBC_L = 9,
+  GBC_V = 10,
+  GBC_T = 11,
+  GBC_LV = 12,
+  GBC_LVT = 13,
+  GBC_ExtendedPictographic = 14,
+};
+
+#define GRAPHEME_BREAK_CLASS_MASK 0x0F
+
+// Set on scalars whose breaks are left to the standard library.
+#define GRAPHEME_BREAK_DEFERRED 0x10
+
+static inline uint8_t getGraphemeBreakData(uint32_t scalar) {
+  const uint32_t valueMask = (1 << GRAPHEME_BREAK_TRIE_VALUE_BITS) - 1;
+  const uint32_t blockMask = (1 << GRAPHEME_BREAK_TRIE_BLOCK_BITS) - 1;
+
+  uint32_t indexIdx = scalar >> (GRAPHEME_BREAK_TRIE_VALUE_BITS
+                                 + GRAPHEME_BREAK_TRIE_BLOCK_BITS);
+  uint32_t blockIdx = (_swift_stdlib_grapheme_break_index[indexIdx]
+                         << GRAPHEME_BREAK_TRIE_BLOCK_BITS)
+                    | ((scalar >> GRAPHEME_BREAK_TRIE_VALUE_BITS) & blockMask);
+  intptr_t valueIdx = ((intptr_t) _swift_stdlib_grapheme_break_blocks[blockIdx]
+                         << GRAPHEME_BREAK_TRIE_VALUE_BITS)
+                    | (scalar & valueMask);
+
+  return _swift_stdlib_grapheme_break_values[valueIdx];
+}
+
+// Decodes the scalar at `utf8[i]`, which must start a scalar of valid UTF-8,
+// and stores its length in `length`.
+static inline uint32_t decodeScalar(const uint8_t *utf8, intptr_t i,
+                                    intptr_t *length) {
+  uint8_t lead = utf8[i];
+
+  if (lead < 0x80) {
+    *length = 1;
+    return lead;
+  }
+  if (lead < 0xE0) {
+    *length = 2;
+    return ((uint32_t) (lead & 0x1F) << 6) | (utf8[i + 1] & 0x3F);
+  }
+  if (lead < 0xF0) {
+    *length = 3;
+    return ((uint32_t) (lead & 0x0F) << 12)
+         | ((uint32_t) (utf8[i + 1] & 0x3F) << 6)
+         | (utf8[i + 2] & 0x3F);
+  }
+  *length = 4;
+  return ((uint32_t) (lead & 0x07) << 18)
+       | ((uint32_t) (utf8[i + 1] & 0x3F) << 12)
+       | ((uint32_t) (utf8[i + 2] & 0x3F) << 6)
+       | (utf8[i + 3] & 0x3F);
+}
+
+// What's known about the scalars since the last break, for the rules that
+// look further back than the previous scalar.
+typedef struct {
+  uint8_t previous;
+
+  // Whether the previous scalars are `ExtPict Extend*` (1), or
+  // `ExtPict Extend* ZWJ` (2), for GB11.
+  uint8_t emojiSequence;
+
+  // Whether an odd number of regional indicators precede the next scalar,
+  // for GB12 and GB13.
+  bool hasOddRegionalIndicators;
+} GraphemeBreakState;
+
+static inline void initState(GraphemeBreakState *state, uint8_t gbc) {
+  state->previous = gbc;
+  state->emojiSequence = gbc == GBC_ExtendedPictographic;
+  state->hasOddRegionalIndicators = gbc == GBC_RegionalIndicator;
+}
+
+// Returns whether there's a break between the previous scalar and one of
+// class `next`, following the rules of UAX #29 other than GB9c, and then
+// moves `state` past it.
+static inline bool shouldBreak(GraphemeBreakState *state, uint8_t next) {
+  uint8_t previous = state->previous;
+  bool result;
+
+  switch (previous) {
+  case GBC_CR:
+    // GB3, GB4
+    result = next != GBC_LF;
+    break;
+  case GBC_LF:
+  case GBC_Control:
+    // GB4
+    result = true;
+    break;
+  default:
+    switch (next) {
+    case GBC_CR:
+    case GBC_LF:
+    case GBC_Control:
+      // GB5
+      result = true;
+      break;
+    case GBC_Extend:
+    case GBC_ZWJ:
+    case GBC_SpacingMark:
+      // GB9, GB9a
+      result = false;
+      break;
+    default:
+      if (previous == GBC_Prepend) {
+        // GB9b
+        result = false;
+      } else if (previous == GBC_L) {
+        // GB6
+        result = !(next == GBC_L || next == GBC_V || next == GBC_LV
+                   || next == GBC_LVT);
+      } else if (previous == GBC_LV || previous == GBC_V) {
+        // GB7
+        result = !(next == GBC_V || next == GBC_T);
+      } else if (previous == GBC_LVT || previous == GBC_T) {
+        // GB8
+        result = next != GBC_T;
+      } else if (previous == GBC_ZWJ && next == GBC_ExtendedPictographic) {
+        // GB11
+        result = state->emojiSequence != 2;
+      } else if (previous == GBC_RegionalIndicator
+                 && next == GBC_RegionalIndicator) {
+        // GB12, GB13
+        result = !state->hasOddRegionalIndicators;
+      } else {
+        // GB999
+        result = true;
+      }
+    }
+  }
+
+  state->previous = next;
+  if (next == GBC_ExtendedPictographic) {
+    state->emojiSequence = 1;
+  } else if (next == GBC_Extend && state->emojiSequence == 1) {
+    state->emojiSequence = 1;
+  } else if (next == GBC_ZWJ && state->emojiSequence == 1) {
+    state->emojiSequence = 2;
+  } else {
+    state->emojiSequence = 0;
+  }
+  state->hasOddRegionalIndicators = next == GBC_RegionalIndicator
+    && !(previous == GBC_RegionalIndicator && state->hasOddRegionalIndicators);
+
+  return result;
+}
+
+// Returns whether all eight bytes of `word` are ASCII other than CR, between
+// any two of which there's always a break.
+static inline bool isASCIIWithoutCR(uint64_t word) {
+  const uint64_t lows = 0x0101010101010101;
+  const uint64_t highs = 0x8080808080808080;
+  uint64_t cr = word ^ (0x0D * lows);
+
+  // The usual "has zero byte" trick finds any CR.
+  return ((word | ((cr - lows) & ~cr)) & highs) == 0;
+}
+
+SWIFT_CC
+intptr_t _swift_string_processing_getGraphemeBreaks(const uint8_t *utf8,
+                                                    intptr_t count,
+                                                    intptr_t start,
+                                                    intptr_t *breaks,
+                                                    intptr_t capacity) {
+  if (start >= count || capacity <= 0 || (utf8[start] & 0xC0) == 0x80) {
+    return 0;
+  }
+
+  intptr_t length;
+  uint8_t data = getGraphemeBreakData(decodeScalar(utf8, start, &length));
+  if (data & GRAPHEME_BREAK_DEFERRED) {
+    return 0;
+  }
+  uint8_t gbc = data & GRAPHEME_BREAK_CLASS_MASK;
+
+  // Check that `start` is a break, as far as that's possible without any
+  // context before the previous scalar.
+  if (start > 0) {
+    intptr_t previousStart = start - 1;
+    while ((utf8[previousStart] & 0xC0) == 0x80) {
+      previousStart -= 1;
+    }
+
+    intptr_t previousLength;
+    uint8_t previousData = getGraphemeBreakData(
+      decodeScalar(utf8, previousStart, &previousLength));
+    if (previousData & GRAPHEME_BREAK_DEFERRED) {
+      return 0;
+    }
+
+    // GB11 and GB12 depend on the scalars before the previous one.
+    GraphemeBreakState state;
+    initState(&state, previousData & GRAPHEME_BREAK_CLASS_MASK);
+    if ((state.previous == GBC_ZWJ && gbc == GBC_ExtendedPictographic)
+        || (state.previous == GBC_RegionalIndicator
+            && gbc == GBC_RegionalIndicator)
+        || !shouldBreak(&state, gbc)) {
+      return 0;
+    }
+
+    // GB9c joins a virama to the next consonant through any extending
+    // scalars between them.
+    while ((previousData & GRAPHEME_BREAK_CLASS_MASK) == GBC_Extend
+           || (previousData & GRAPHEME_BREAK_CLASS_MASK) == GBC_ZWJ) {
+      if (previousStart == 0) {
+        break;
+      }
+      previousStart -= 1;
+      while ((utf8[previousStart] & 0xC0) == 0x80) {
+        previousStart -= 1;
+      }
+      previousData = getGraphemeBreakData(
+        decodeScalar(utf8, previousStart, &previousLength));
+      if (previousData & GRAPHEME_BREAK_DEFERRED) {
+        return 0;
+      }
+    }
+  }
+
+  GraphemeBreakState state;
+  initState(&state, gbc);
+  bool previousIsASCIIWithoutCR = utf8[start] < 0x80 && utf8[start] != '\r';
+  intptr_t written = 0;
+  intptr_t i = start + length;
+
+  while (i < count) {
+    // Skip a word of ASCII at a time, which is only ever broken up by CR-LF.
+    if (previousIsASCIIWithoutCR && count - i >= 8 && capacity - written >= 8) {
+      uint64_t word;
+      memcpy(&word, utf8 + i, sizeof(word));
+
+      if (isASCIIWithoutCR(word)) {
+        for (intptr_t j = 0; j != 8; ++j) {
+          breaks[written++] = i + j;
+        }
+        i += 8;
+        initState(&state,
+                  getGraphemeBreakData(utf8[i - 1]) & GRAPHEME_BREAK_CLASS_MASK);
+        if (written == capacity) {
+          return written;
+        }
+        continue;
+      }
+    }
+
+    uint32_t scalar = decodeScalar(utf8, i, &length);
+    data = getGraphemeBreakData(scalar);
+    if (data & GRAPHEME_BREAK_DEFERRED) {
+      return written;
+    }
+
+    if (shouldBreak(&state, data & GRAPHEME_BREAK_CLASS_MASK)) {
+      breaks[written++] = i;
+      if (written == capacity) {
+        return written;
+      }
+    }
+
+    previousIsASCIIWithoutCR = scalar < 0x80 && scalar != '\r';
+    i += length;
+  }
+
+  // GB2
+  breaks[written++] = count;
+  return written;
+}
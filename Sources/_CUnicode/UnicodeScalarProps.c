@@ -12,75 +12,253 @@
 #include "Common/ScriptData.h"
 #include "include/UnicodeData.h"
 
+#if defined(__SSSE3__)
+#include <tmmintrin.h>
+#elif defined(__aarch64__)
+#include <arm_neon.h>
+#endif
+
+// Returns the position of `scalar`'s value in a three-stage trie's values
+// array.
+//
+// The top bits of the scalar select a block of block indices in `index`, the
+// middle bits select the index of a block of values within it, and the low
+// bits select the value within that block. Identical blocks are shared, which
+// keeps the tables small while a lookup is always three loads.
+static inline intptr_t getScriptTrieIdx(uint32_t scalar,
+                                        const uint8_t *index,
+                                        const uint16_t *blocks) {
+  const uint32_t valueMask = (1 << SCRIPT_TRIE_VALUE_BITS) - 1;
+  const uint32_t blockMask = (1 << SCRIPT_TRIE_BLOCK_BITS) - 1;
+
+  uint32_t indexIdx = scalar >> (SCRIPT_TRIE_VALUE_BITS + SCRIPT_TRIE_BLOCK_BITS);
+  uint32_t blockIdx = (index[indexIdx] << SCRIPT_TRIE_BLOCK_BITS)
+                    | ((scalar >> SCRIPT_TRIE_VALUE_BITS) & blockMask);
+
+  return ((intptr_t) blocks[blockIdx] << SCRIPT_TRIE_VALUE_BITS)
+       | (scalar & valueMask);
+}
+
 SWIFT_CC
 uint8_t _swift_string_processing_getScript(uint32_t scalar) {
-  int lowerBoundIndex = 0;
-  int endIndex = SCRIPTS_COUNT;
-  int upperBoundIndex = endIndex - 1;
-  
-  while (upperBoundIndex >= lowerBoundIndex) {
-    int index = lowerBoundIndex + (upperBoundIndex - lowerBoundIndex) / 2;
-    
-    const uint32_t entry = _swift_stdlib_scripts[index];
-    
-    // Shift the enum value out of the scalar.
-    uint32_t lowerBoundScalar = (entry << 11) >> 11;
-    
-    uint32_t upperBoundScalar = 0;
-    
-    // If we're not at the end of the array, the range count is simply the
-    // distance to the next element.
-    if (index != endIndex - 1) {
-      const uint32_t nextEntry = _swift_stdlib_scripts[index + 1];
-      
-      uint32_t nextLower = (nextEntry << 11) >> 11;
-      
-      upperBoundScalar = nextLower - 1;
-    } else {
-      // Otherwise, the range count is the distance to 0x10FFFF
-      upperBoundScalar = 0x10FFFF;
-    }
-    
-    // Shift the scalar out and get the enum value.
-    uint8_t script = entry >> 21;
-    
-    if (scalar >= lowerBoundScalar && scalar <= upperBoundScalar) {
-      return script;
-    }
-    
-    if (scalar > upperBoundScalar) {
-      lowerBoundIndex = index + 1;
-      continue;
-    }
-    
-    if (scalar < lowerBoundScalar) {
-      upperBoundIndex = index - 1;
-      continue;
-    }
+  // Scalars past 0x10FFFF aren't in the table, so report a failure.
+  if (scalar > 0x10FFFF) {
+    return UINT8_MAX;
+  }
+
+  intptr_t valueIdx = getScriptTrieIdx(scalar, _swift_stdlib_scripts_index,
+                                       _swift_stdlib_scripts_blocks);
+  return _swift_stdlib_scripts_values[valueIdx];
+}
+
+SWIFT_CC
+void _swift_string_processing_getScripts(const uint32_t *scalars,
+                                         intptr_t count,
+                                         uint8_t *scripts) {
+  for (intptr_t i = 0; i != count; i += 1) {
+    scripts[i] = _swift_string_processing_getScript(scalars[i]);
   }
-  
-  // If we make it out of this loop, then it means the scalar was not found at
-  // all in the array. This should never happen because the array represents all
-  // scalars from 0x0 to 0x10FFFF, but if somehow this branch gets reached,
-  // return 255 to indicate a failure.
-  return UINT8_MAX;
 }
 
 SWIFT_CC
 const uint8_t *_swift_string_processing_getScriptExtensions(uint32_t scalar,
                                                             uint8_t *count) {
-  intptr_t dataIdx = _swift_string_processing_getScalarBitArrayIdx(scalar,
-                                                _swift_stdlib_script_extensions,
-                                         _swift_stdlib_script_extensions_ranks);
-  
-  // If we don't have an index into the data indices, then this scalar has no
-  // script extensions
-  if (dataIdx == INTPTR_MAX) {
+  if (scalar > 0x10FFFF) {
+    return 0;
+  }
+
+  intptr_t valueIdx = getScriptTrieIdx(scalar,
+                                       _swift_stdlib_script_extensions_index,
+                                       _swift_stdlib_script_extensions_blocks);
+  uint16_t scalarDataIdx = _swift_stdlib_script_extensions_values[valueIdx];
+
+  // A zero entry means that this scalar has no script extensions; every other
+  // entry has a nonzero count.
+  if (scalarDataIdx == 0) {
     return 0;
   }
-  
-  uint16_t scalarDataIdx = _swift_stdlib_script_extensions_data_indices[dataIdx];
+
   *count = scalarDataIdx >> 11;
-  
+
   return _swift_stdlib_script_extensions_data + (scalarDataIdx & 0x7FF);
 }
+
+static inline bool scalarSetHasBit(const uint64_t *words, uint32_t bit) {
+  return (words[bit >> 6] >> (bit & 63)) & 1;
+}
+
+// Returns whether a scalar from U+0800 on is in a set with scripts.
+static inline bool scalarSetHasScriptOf(uint32_t scalar, const uint64_t *set) {
+  const uint64_t *scripts = set + SCALAR_SET_SCRIPTS_WORD;
+  uint64_t flags = set[SCALAR_SET_FLAGS_WORD];
+  bool isMember = false;
+
+  if (flags & SCALAR_SET_USES_EXTENSIONS) {
+    uint8_t count = 0;
+    const uint8_t *extensions =
+      _swift_string_processing_getScriptExtensions(scalar, &count);
+
+    if (extensions) {
+      for (uint8_t i = 0; i != count && !isMember; i += 1) {
+        isMember = scalarSetHasBit(scripts, extensions[i]);
+      }
+
+      return isMember != ((flags & SCALAR_SET_IS_INVERTED) != 0);
+    }
+  }
+
+  intptr_t valueIdx = getScriptTrieIdx(scalar, _swift_stdlib_scripts_index,
+                                       _swift_stdlib_scripts_blocks);
+  isMember = scalarSetHasBit(scripts, _swift_stdlib_scripts_values[valueIdx]);
+  return isMember != ((flags & SCALAR_SET_IS_INVERTED) != 0);
+}
+
+// Returns the length of the prefix of `bytes` made of ASCII bytes in `set`,
+// looking at 16 bytes at a time. Bytes past the last full block of 16 are
+// left to the caller.
+static inline intptr_t asciiRunLength(const uint8_t *bytes, intptr_t count,
+                                      const uint64_t *set) {
+  intptr_t i = 0;
+
+#if defined(__SSSE3__)
+  // Each byte's low nibble selects a row of the nibble table, and its high
+  // nibble selects a bit within that row. High nibbles of 8 and up, which are
+  // the non-ASCII bytes, select no bit at all.
+  const __m128i nibbles =
+    _mm_loadu_si128((const __m128i *)(set + SCALAR_SET_NIBBLES_WORD));
+  const __m128i highBits = _mm_setr_epi8(1, 2, 4, 8, 16, 32, 64, -128,
+                                         0, 0, 0, 0, 0, 0, 0, 0);
+  const __m128i lowMask = _mm_set1_epi8(0x0F);
+
+  for (; i + 16 <= count; i += 16) {
+    __m128i block = _mm_loadu_si128((const __m128i *)(bytes + i));
+    __m128i rows = _mm_shuffle_epi8(nibbles, _mm_and_si128(block, lowMask));
+    __m128i bits = _mm_shuffle_epi8(
+      highBits, _mm_and_si128(_mm_srli_epi16(block, 4), lowMask));
+    __m128i misses = _mm_cmpeq_epi8(_mm_and_si128(rows, bits),
+                                    _mm_setzero_si128());
+    int missMask = _mm_movemask_epi8(misses);
+
+    if (missMask != 0) {
+      return i + __builtin_ctz(missMask);
+    }
+  }
+#elif defined(__aarch64__)
+  const uint8x16_t nibbles =
+    vld1q_u8((const uint8_t *)(set + SCALAR_SET_NIBBLES_WORD));
+  const uint8_t highBitValues[16] = {1, 2, 4, 8, 16, 32, 64, 128};
+  const uint8x16_t highBits = vld1q_u8(highBitValues);
+  const uint8x16_t lowMask = vdupq_n_u8(0x0F);
+
+  for (; i + 16 <= count; i += 16) {
+    uint8x16_t block = vld1q_u8(bytes + i);
+    uint8x16_t rows = vqtbl1q_u8(nibbles, vandq_u8(block, lowMask));
+    uint8x16_t bits = vqtbl1q_u8(highBits, vshrq_n_u8(block, 4));
+    uint8x16_t hits = vtstq_u8(rows, bits);
+
+    if (vminvq_u8(hits) == 0) {
+      // Let the byte-at-a-time loop find the first miss.
+      return i;
+    }
+  }
+#else
+  // Skip eight bytes at a time while they're all ASCII and in the set.
+  for (; i + 8 <= count; i += 8) {
+    uint64_t block;
+    __builtin_memcpy(&block, bytes + i, 8);
+
+    if (block & 0x8080808080808080) {
+      return i;
+    }
+
+    for (int j = 0; j != 8; j += 1) {
+      if (!scalarSetHasBit(set, bytes[i + j])) {
+        return i + j;
+      }
+    }
+  }
+#endif
+
+  return i;
+}
+
+SWIFT_CC
+intptr_t _swift_string_processing_scalarRunLength(const uint8_t *bytes,
+                                                  intptr_t count,
+                                                  const uint64_t *set) {
+  bool hasScripts = (set[SCALAR_SET_FLAGS_WORD] & SCALAR_SET_HAS_SCRIPTS) != 0;
+  intptr_t i = 0;
+
+  while (i < count) {
+    uint8_t byte = bytes[i];
+
+    if (byte < 0x80) {
+      if (!scalarSetHasBit(set, byte)) {
+        break;
+      }
+
+      i += 1;
+
+      // Runs of ASCII are usually long, so look at the following bytes in
+      // blocks.
+      if (i < count && bytes[i] < 0x80) {
+        i += asciiRunLength(bytes + i, count - i, set);
+      }
+
+      continue;
+    }
+
+    // The input is valid UTF-8 starting on a scalar boundary, but a scan
+    // can't begin at a continuation byte.
+    if (byte < 0xC0) {
+      break;
+    }
+
+    if (byte < 0xE0) {
+      if (i + 2 > count) {
+        break;
+      }
+
+      uint32_t scalar = ((uint32_t)(byte & 0x1F) << 6)
+                      | (bytes[i + 1] & 0x3F);
+
+      if (!scalarSetHasBit(set, scalar)) {
+        break;
+      }
+
+      i += 2;
+      continue;
+    }
+
+    if (!hasScripts) {
+      break;
+    }
+
+    intptr_t length = byte < 0xF0 ? 3 : 4;
+
+    if (i + length > count) {
+      break;
+    }
+
+    uint32_t scalar;
+
+    if (length == 3) {
+      scalar = ((uint32_t)(byte & 0x0F) << 12)
+             | ((uint32_t)(bytes[i + 1] & 0x3F) << 6)
+             | (bytes[i + 2] & 0x3F);
+    } else {
+      scalar = ((uint32_t)(byte & 0x07) << 18)
+             | ((uint32_t)(bytes[i + 1] & 0x3F) << 12)
+             | ((uint32_t)(bytes[i + 2] & 0x3F) << 6)
+             | (bytes[i + 3] & 0x3F);
+    }
+
+    if (!scalarSetHasScriptOf(scalar, set)) {
+      break;
+    }
+
+    i += length;
+  }
+
+  return i;
+}
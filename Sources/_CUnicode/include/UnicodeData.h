@@ -38,8 +38,108 @@ intptr_t _swift_string_processing_getScalarBitArrayIdx(uint32_t scalar,
 SWIFT_CC
 uint8_t _swift_string_processing_getScript(uint32_t scalar);
 
+SWIFT_CC
+void _swift_string_processing_getScripts(const uint32_t *scalars,
+                                         intptr_t count,
+                                         uint8_t *scripts);
+
 SWIFT_CC
 const uint8_t *_swift_string_processing_getScriptExtensions(uint32_t scalar,
                                                             uint8_t *count);
 
+//===----------------------------------------------------------------------===//
+// Case Folding
+//===----------------------------------------------------------------------===//
+
+// Returns the simple case folding of `scalar`, or `scalar` itself if it
+// doesn't change when case folded.
+SWIFT_CC
+uint32_t _swift_string_processing_getSimpleCaseFolding(uint32_t scalar);
+
+// Writes the full case folding of `scalar` to `folding`, which must have room
+// for three scalars, and returns the number of scalars written.
+SWIFT_CC
+intptr_t _swift_string_processing_getFullCaseFolding(uint32_t scalar,
+                                                     uint32_t *folding);
+
+// Returns whether `scalar` or its full case folding takes part in canonical
+// normalization, so that comparing case foldings scalar by scalar can differ
+// from comparing them under canonical equivalence.
+SWIFT_CC
+bool _swift_string_processing_isCaseFoldingNormalizationSensitive(
+  uint32_t scalar);
+
+//===----------------------------------------------------------------------===//
+// Grapheme Breaking
+//===----------------------------------------------------------------------===//
+
+// Writes the UTF-8 offsets of up to `capacity` grapheme breaks after `start`
+// in `utf8[0..<count]` to `breaks`, in increasing order, and returns the
+// number written. `count` itself is written when the end of the text is
+// reached.
+//
+// Breaking stops early before any scalar that the standard library may break
+// differently around, or that depends on context before `start`, leaving the
+// rest of the text to the standard library. Nothing is written if `start`
+// isn't known to be a break.
+SWIFT_CC
+intptr_t _swift_string_processing_getGraphemeBreaks(const uint8_t *utf8,
+                                                    intptr_t count,
+                                                    intptr_t start,
+                                                    intptr_t *breaks,
+                                                    intptr_t capacity);
+
+//===----------------------------------------------------------------------===//
+// Scalar Runs
+//===----------------------------------------------------------------------===//
+
+// A set of scalars for `_swift_string_processing_scalarRunLength`, stored as
+// an array of `SCALAR_SET_WORD_COUNT` words:
+//
+// - Words 0 through 31 are a bitmap of the scalars below U+0800.
+// - Words 32 through 35 are a bitmap of script values. When the set has the
+//   `SCALAR_SET_HAS_SCRIPTS` flag, a scalar from U+0800 on is in the set when
+//   its script (or one of its script extensions, with the
+//   `SCALAR_SET_USES_EXTENSIONS` flag) is in this bitmap, unless the set has
+//   the `SCALAR_SET_IS_INVERTED` flag. Otherwise, these scalars are undecided.
+// - Word 36 holds the flags.
+// - Words 37 and 38 hold the ASCII part of the bitmap again, as 16 bytes
+//   indexed by a byte's low nibble, with a bit set for each high nibble.
+#define SCALAR_SET_SCRIPTS_WORD 32
+#define SCALAR_SET_FLAGS_WORD 36
+#define SCALAR_SET_NIBBLES_WORD 37
+#define SCALAR_SET_WORD_COUNT 39
+
+#define SCALAR_SET_HAS_SCRIPTS 1
+#define SCALAR_SET_USES_EXTENSIONS 2
+#define SCALAR_SET_IS_INVERTED 4
+
+// Returns the length in bytes of the longest prefix of the UTF-8 in `bytes`
+// made of whole scalars that are in `set`. The scan stops early at a scalar
+// that the set leaves undecided.
+SWIFT_CC
+intptr_t _swift_string_processing_scalarRunLength(const uint8_t *bytes,
+                                                  intptr_t count,
+                                                  const uint64_t *set);
+
+//===----------------------------------------------------------------------===//
+// Locks
+//===----------------------------------------------------------------------===//
+
+// A mutual exclusion lock backed by the platform's lock: `os_unfair_lock` on
+// Apple platforms, an SRW lock on Windows, and a pthread mutex elsewhere.
+// Threads waiting for the lock block rather than spin. Returns NULL if the
+// lock can't be allocated.
+SWIFT_CC
+void *_swift_string_processing_createLock(void);
+
+SWIFT_CC
+void _swift_string_processing_destroyLock(void *lock);
+
+SWIFT_CC
+void _swift_string_processing_lock(void *lock);
+
+SWIFT_CC
+void _swift_string_processing_unlock(void *lock);
+
 #endif // SWIFT_STDLIB_SHIMS_UNICODEDATA_H
@@ -14,6 +14,8 @@
 fileprivate struct RegexValidator {
   let ast: AST
   let captures: CaptureList
+  /// The names of the captures, for checking named references.
+  var captureNames = Set<String>()
   var diags = Diagnostics()
 
   init(_ ast: AST) {
@@ -78,10 +80,9 @@ extension RegexValidator {
 
   mutating func validateCaptures() {
     // TODO: Should this be validated when creating the capture list?
-    var usedNames = Set<String>()
     for capture in captures.captures {
       guard let name = capture.name else { continue }
-      if !usedNames.insert(name).inserted {
+      if !captureNames.insert(name).inserted {
         error(.duplicateNamedCapture(name), at: capture.location)
       }
     }
@@ -104,7 +105,7 @@ extension RegexValidator {
     case .named(let name):
       // An empty name is already invalid, so don't bother validating.
       guard !name.isEmpty else { break }
-      if !captures.hasCapture(named: name) {
+      if !captureNames.contains(name) {
         error(.invalidNamedReference(name), at: ref.innerLoc)
       }
     case .relative(let num):
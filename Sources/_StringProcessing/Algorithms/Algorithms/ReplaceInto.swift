@@ -0,0 +1,177 @@
+//===----------------------------------------------------------------------===//
+//
+// This source file is part of the Swift.org open source project
+//
+// Copyright (c) 2025 Apple Inc. and the Swift project authors
+// Licensed under Apache License v2.0 with Runtime Library Exception
+//
+// See https://swift.org/LICENSE.txt for license information
+//
+//===----------------------------------------------------------------------===//
+
+// MARK: Regex algorithms
+
+@available(SwiftStdlib 6.1, *)
+extension BidirectionalCollection where SubSequence == Substring {
+  /// Writes the UTF-8 of this collection to `output`, with all occurrences
+  /// of a sequence matching the given regex replaced by another string.
+  ///
+  /// Unlike `replacing(_:with:maxReplacements:)`, this method doesn't
+  /// create a new collection. The text between matches is passed to `output`
+  /// directly from the collection's storage, as the matches are found, so
+  /// replacing in a large string only uses memory for the output:
+  ///
+  ///     try log.replacing(ssnRegex, with: "***-**-****", into: { bytes in
+  ///         try file.write(contentsOf: bytes)
+  ///     })
+  ///
+  /// - Parameters:
+  ///   - regex: A regex describing the sequence to replace.
+  ///   - replacement: The string to write in place of each match.
+  ///   - maxReplacements: A number specifying how many occurrences of the
+  ///     sequence matching `regex` to replace. Default is `Int.max`.
+  ///   - output: A closure that's called with successive chunks of the
+  ///     result's UTF-8 code units. The buffer is only valid for the
+  ///     duration of the call.
+  /// - Throws: An error thrown by `output`, or the error that stopped a
+  ///   search for the next match, such as `RegexStepLimitExceeded`. The
+  ///   input after the last replaced match isn't written when a search
+  ///   throws.
+  public func replacing(
+    _ regex: some RegexComponent,
+    with replacement: some StringProtocol,
+    maxReplacements: Int = .max,
+    into output: (UnsafeBufferPointer<UInt8>) throws -> Void
+  ) throws {
+    try _replacing(
+      regex.regex,
+      maxReplacements: maxReplacements,
+      into: output,
+      with: { _ in replacement })
+  }
+
+  /// Writes the UTF-8 of this collection to `output`, with all occurrences
+  /// of a sequence matching the given regex replaced by a string created
+  /// from each match.
+  ///
+  /// - Parameters:
+  ///   - regex: A regex describing the sequence to replace.
+  ///   - maxReplacements: A number specifying how many occurrences of the
+  ///     sequence matching `regex` to replace. Default is `Int.max`.
+  ///   - output: A closure that's called with successive chunks of the
+  ///     result's UTF-8 code units. The buffer is only valid for the
+  ///     duration of the call.
+  ///   - replacement: A closure that receives the full match information,
+  ///     including captures, and returns a replacement string.
+  /// - Throws: An error thrown by `output` or `replacement`, or the error
+  ///   that stopped a search for the next match, such as
+  ///   `RegexStepLimitExceeded`. The input after the last replaced match
+  ///   isn't written when a search throws.
+  public func replacing<Output, Replacement: StringProtocol>(
+    _ regex: some RegexComponent<Output>,
+    maxReplacements: Int = .max,
+    into output: (UnsafeBufferPointer<UInt8>) throws -> Void,
+    with replacement: (Regex<Output>.Match) throws -> Replacement
+  ) throws {
+    try _replacing(
+      regex.regex,
+      maxReplacements: maxReplacements,
+      into: output,
+      with: replacement)
+  }
+
+  /// Writes the UTF-8 of this collection to `buffer`, with all occurrences
+  /// of a sequence matching the given regex replaced by another string.
+  ///
+  /// - Parameters:
+  ///   - regex: A regex describing the sequence to replace.
+  ///   - replacement: The string to write in place of each match.
+  ///   - maxReplacements: A number specifying how many occurrences of the
+  ///     sequence matching `regex` to replace. Default is `Int.max`.
+  ///   - buffer: The buffer to write the result's UTF-8 code units to.
+  /// - Returns: The number of code units written to `buffer`, or `nil` if
+  ///   the result doesn't fit. Matching stops as soon as the result is
+  ///   known not to fit.
+  /// - Throws: The error that stopped a search for the next match, such as
+  ///   `RegexStepLimitExceeded`.
+  public func replacing(
+    _ regex: some RegexComponent,
+    with replacement: some StringProtocol,
+    maxReplacements: Int = .max,
+    into buffer: UnsafeMutableBufferPointer<UInt8>
+  ) throws -> Int? {
+    struct BufferFull: Error {}
+
+    var count = 0
+    do {
+      try replacing(
+        regex,
+        with: replacement,
+        maxReplacements: maxReplacements,
+        into: { bytes in
+          guard bytes.count <= buffer.count - count else {
+            throw BufferFull()
+          }
+          guard let source = bytes.baseAddress else { return }
+          (buffer.baseAddress! + count).initialize(
+            from: source, count: bytes.count)
+          count += bytes.count
+        })
+    } catch is BufferFull {
+      return nil
+    }
+    return count
+  }
+
+  func _replacing<Output, Replacement: StringProtocol>(
+    _ regex: Regex<Output>,
+    maxReplacements: Int,
+    into output: (UnsafeBufferPointer<UInt8>) throws -> Void,
+    with replacement: (Regex<Output>.Match) throws -> Replacement
+  ) throws {
+    precondition(maxReplacements >= 0)
+
+    // Unlike `replacing(_:with:)`, a search that throws isn't treated as
+    // the last match, which would write the rest of the input unreplaced.
+    var index = startIndex
+    var replacements = 0
+    var matches = _matches(of: regex).makeIterator()
+    while replacements < maxReplacements,
+          let match = try matches.nextMatch() {
+      try self[index..<match.range.lowerBound]._withUTF8Chunks(output)
+      try replacement(match)._withUTF8Chunks(output)
+      index = match.range.upperBound
+      replacements += 1
+    }
+    try self[index...]._withUTF8Chunks(output)
+  }
+}
+
+extension StringProtocol {
+  /// Calls `body` with the UTF-8 code units of this string, in one or more
+  /// chunks, without copying them if the string's storage is contiguous.
+  func _withUTF8Chunks(
+    _ body: (UnsafeBufferPointer<UInt8>) throws -> Void
+  ) rethrows {
+    if isEmpty {
+      return
+    }
+    if try utf8.withContiguousStorageIfAvailable(body) != nil {
+      return
+    }
+
+    // Bridged strings are copied a chunk at a time.
+    let chunkSize = 4096
+    var chunk: [UInt8] = []
+    chunk.reserveCapacity(chunkSize)
+    var i = utf8.startIndex
+    while i < utf8.endIndex {
+      let end = utf8.index(i, offsetBy: chunkSize, limitedBy: utf8.endIndex)
+        ?? utf8.endIndex
+      chunk.removeAll(keepingCapacity: true)
+      chunk.append(contentsOf: utf8[i..<end])
+      try chunk.withUnsafeBufferPointer(body)
+      i = end
+    }
+  }
+}
@@ -258,3 +258,55 @@ extension BidirectionalCollection where SubSequence == Substring {
     return result
   }
 }
+
+@available(SwiftStdlib 6.1, *)
+extension BidirectionalCollection where SubSequence == Substring {
+  /// Calls the given closure with the range of each of the longest possible
+  /// subsequences of the collection, in order, around elements matching the
+  /// given separator.
+  ///
+  /// Unlike `split(separator:maxSplits:omittingEmptySubsequences:)`, this
+  /// method doesn't create an array of substrings. Each separator is found
+  /// just before `body` is called with the range that precedes it, using a
+  /// single instance of the matching engine for the whole collection:
+  ///
+  ///     try log.forEachSplitRange(separator: /\n/) { range in
+  ///         process(log[range])
+  ///     }
+  ///
+  /// - Parameters:
+  ///   - separator: A regex describing elements to be split upon.
+  ///   - maxSplits: The maximum number of times to split the collection.
+  ///   - omittingEmptySubsequences: If `false`, a range is included for
+  ///     each pair of consecutive separators and for separators at the
+  ///     start or end of the collection.
+  ///   - body: A closure that's called with the range of each subsequence
+  ///     between matches of `separator`.
+  /// - Throws: An error thrown by `body`, or the error that stopped a search
+  ///   for the next separator, such as `RegexStepLimitExceeded`. The rest of
+  ///   the collection isn't passed to `body` when a search throws.
+  public func forEachSplitRange(
+    separator: some RegexComponent,
+    maxSplits: Int = .max,
+    omittingEmptySubsequences: Bool = true,
+    _ body: (Range<Index>) throws -> Void
+  ) throws {
+    precondition(maxSplits >= 0, "Must take zero or more splits")
+    var separators = _matches(of: separator).makeIterator()
+    var subSequenceStart = startIndex
+    var remainingSplits = isEmpty ? 0 : maxSplits
+    while remainingSplits > 0, let match = try separators.nextMatch() {
+      let range = subSequenceStart..<match.range.lowerBound
+      subSequenceStart = match.range.upperBound
+      if range.isEmpty && omittingEmptySubsequences {
+        continue
+      }
+      remainingSplits -= 1
+      try body(range)
+    }
+
+    if subSequenceStart != endIndex || !omittingEmptySubsequences {
+      try body(subSequenceStart..<endIndex)
+    }
+  }
+}
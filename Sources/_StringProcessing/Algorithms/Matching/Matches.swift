@@ -44,4 +44,16 @@ extension BidirectionalCollection where SubSequence == Substring {
     }
     return result
   }
+
+  /// Returns the number of matches of the specified regex, without
+  /// collecting them, for measuring throughput on large inputs.
+  @_spi(RegexBenchmark)
+  @available(SwiftStdlib 5.7, *)
+  public func _matchCount(of r: some RegexComponent) -> Int {
+    var count = 0
+    for _ in _matches(of: r) {
+      count += 1
+    }
+    return count
+  }
 }
@@ -0,0 +1,295 @@
+//===----------------------------------------------------------------------===//
+//
+// This source file is part of the Swift.org open source project
+//
+// Copyright (c) 2025 Apple Inc. and the Swift project authors
+// Licensed under Apache License v2.0 with Runtime Library Exception
+//
+// See https://swift.org/LICENSE.txt for license information
+//
+//===----------------------------------------------------------------------===//
+
+internal import _RegexParser
+
+// MARK: Parallel matching
+//
+// The search bounds are split into chunks, preferably just after a newline,
+// and each chunk finds the matches that begin within it as though a search
+// had just resumed at the chunk's start. Matches can run past the end of a
+// chunk. Whether a match is found at a given position doesn't depend on
+// where the search resumed (except for `\G`, which isn't supported here), so
+// a chunk's matches are exactly the sequential ones as long as the previous
+// chunk's last match didn't run into it. When one did, the sequential search
+// is resumed from the end of that match until it reaches a match that the
+// chunk also found, after which the two agree.
+
+@available(SwiftStdlib 5.7, *)
+extension Executor {
+  /// The minimum number of UTF-8 code units worth searching in a chunk of
+  /// its own.
+  static var _minimumChunkLength: Int { 4096 }
+
+  static func parallelMatches(
+    _ program: MEProgram,
+    _ input: String,
+    subjectBounds: Range<String.Index>,
+    searchBounds: Range<String.Index>,
+    chunkCount: Int,
+    concurrentPerform: (Int, (Int) -> Void) -> Void
+  ) -> [Regex<Output>.Match] {
+    let boundaries = _canSearchInParallel(program, input, searchBounds)
+      ? _chunkBoundaries(input, searchBounds, chunkCount: chunkCount)
+      : [searchBounds.lowerBound, searchBounds.upperBound]
+    let lastChunk = boundaries.count - 2
+
+    var chains = Array(
+      repeating: [Regex<Output>.Match](), count: lastChunk + 1)
+    chains.withUnsafeMutableBufferPointer { buffer in
+      // Each chunk writes only its own element.
+      let results = buffer
+      concurrentPerform(results.count) { k in
+        results[k] = _chunkMatches(
+          program, input,
+          subjectBounds: subjectBounds,
+          searchBounds: searchBounds,
+          from: boundaries[k],
+          startLimit: boundaries[k + 1],
+          isLastChunk: k == lastChunk)
+      }
+    }
+
+    // Merge the chunks, resuming the sequential search where a match ran
+    // into the next chunk.
+    var result: [Regex<Output>.Match] = []
+    var cursor: String.Index? = searchBounds.lowerBound
+    for (k, chain) in chains.enumerated() {
+      guard let position = cursor else { break }
+      if position <= boundaries[k] {
+        result += chain
+        if let last = chain.last {
+          cursor = _nextSearchIndex(
+            after: last.range, program, input, subjectBounds)
+        }
+        continue
+      }
+      // A match that ran past this whole chunk leaves no starts in it to try.
+      if position >= boundaries[k + 1] && k != lastChunk {
+        continue
+      }
+
+      var chainIndex = 0
+      var resumed = position
+      while true {
+        let found = _chunkMatches(
+          program, input,
+          subjectBounds: subjectBounds,
+          searchBounds: searchBounds,
+          from: resumed,
+          startLimit: boundaries[k + 1],
+          isLastChunk: k == lastChunk,
+          maxCount: 1)
+        guard let match = found.first else {
+          cursor = resumed
+          break
+        }
+        while chainIndex < chain.count
+                && chain[chainIndex].range.lowerBound < match.range.lowerBound {
+          chainIndex += 1
+        }
+        if chainIndex < chain.count && chain[chainIndex].range == match.range {
+          result += chain[chainIndex...]
+          cursor = _nextSearchIndex(
+            after: chain.last!.range, program, input, subjectBounds)
+          break
+        }
+        result.append(match)
+        cursor = _nextSearchIndex(
+          after: match.range, program, input, subjectBounds)
+        guard let next = cursor, next < boundaries[k + 1] || k == lastChunk
+        else { break }
+        resumed = next
+      }
+    }
+    return result
+  }
+
+  /// Returns whether matches found by starting the search partway through
+  /// `searchBounds` can be combined into the sequential result.
+  static func _canSearchInParallel(
+    _ program: MEProgram,
+    _ input: String,
+    _ searchBounds: Range<String.Index>
+  ) -> Bool {
+    if program.canOnlyMatchAtStart {
+      return false
+    }
+    // A chunk's positions are only the same as the sequential search's when
+    // the search begins on a character boundary.
+    if program.initialOptions.semanticLevel == .graphemeCluster
+        && !input.isOnGraphemeClusterBoundary(searchBounds.lowerBound) {
+      return false
+    }
+    // `\G` matches where the search resumed, which differs between chunks
+    // and the sequential search.
+    return !program.instructions.contains { inst in
+      inst.opcode == .assertBy
+        && inst.payload.assertion.kind == .firstMatchingPositionInSubject
+    }
+  }
+
+  /// Returns the positions at which to split `searchBounds` into at most
+  /// `chunkCount` chunks, including both of its bounds.
+  ///
+  /// Each split is placed just after the first newline following an even
+  /// split, so line-oriented patterns rarely have a match that spans two
+  /// chunks, or on the next character boundary if there's no newline nearby.
+  static func _chunkBoundaries(
+    _ input: String,
+    _ searchBounds: Range<String.Index>,
+    chunkCount: Int
+  ) -> [String.Index] {
+    let utf8 = input.utf8
+    let length = utf8.distance(
+      from: searchBounds.lowerBound, to: searchBounds.upperBound)
+    let chunkCount = Swift.min(chunkCount, length / _minimumChunkLength)
+    guard chunkCount > 1 else {
+      return [searchBounds.lowerBound, searchBounds.upperBound]
+    }
+
+    let chunkLength = length / chunkCount
+    var boundaries = [searchBounds.lowerBound]
+    for k in 1..<chunkCount {
+      var i = utf8.index(searchBounds.lowerBound, offsetBy: k * chunkLength)
+      guard i > boundaries.last! else { continue }
+      let newlineLimit = utf8.index(
+        i, offsetBy: chunkLength / 2, limitedBy: searchBounds.upperBound)
+        ?? searchBounds.upperBound
+      if let newline = utf8[i..<newlineLimit].firstIndex(of: 0x0A) {
+        // A line feed always ends a grapheme cluster.
+        i = utf8.index(after: newline)
+      } else {
+        while i < searchBounds.upperBound
+                && !input.isOnGraphemeClusterBoundary(i) {
+          utf8.formIndex(after: &i)
+        }
+      }
+      if i < searchBounds.upperBound {
+        boundaries.append(i)
+      }
+    }
+    boundaries.append(searchBounds.upperBound)
+    return boundaries
+  }
+
+  /// Returns the matches that a sequential search would produce after
+  /// resuming at `start`, up to the first one that begins at or after
+  /// `startLimit`, which is excluded unless this is the last chunk.
+  static func _chunkMatches(
+    _ program: MEProgram,
+    _ input: String,
+    subjectBounds: Range<String.Index>,
+    searchBounds: Range<String.Index>,
+    from start: String.Index,
+    startLimit: String.Index,
+    isLastChunk: Bool,
+    maxCount: Int = .max
+  ) -> [Regex<Output>.Match] {
+    var cpu = Processor(
+      program: program,
+      input: input,
+      subjectBounds: subjectBounds,
+      searchBounds: start..<searchBounds.upperBound,
+      matchMode: .partialFromFront)
+    // Searches with a start limit don't check with the lazy DFA, which
+    // would scan to the end of the search bounds.
+    var lazyDFA: LazyDFA? = nil
+
+    var result: [Regex<Output>.Match] = []
+    while result.count < maxCount {
+      guard let match = try? Executor._firstMatch(
+        program, using: &cpu, lazyDFA: &lazyDFA, startLimit: startLimit),
+        match.range.lowerBound < startLimit || isLastChunk
+      else { break }
+      result.append(match)
+
+      guard let next = _nextSearchIndex(
+        after: match.range, program, input, subjectBounds),
+        next < startLimit || (isLastChunk && next <= startLimit)
+      else { break }
+      cpu.reset(
+        currentPosition: next,
+        searchBounds: next..<searchBounds.upperBound)
+    }
+    return result
+  }
+}
+
+// MARK: Regex algorithms
+
+extension BidirectionalCollection where SubSequence == Substring {
+  /// Returns all matches of the specified regex, searching separate parts
+  /// of the collection concurrently.
+  ///
+  /// The result is the same as `matches(of:)`. The collection is split into
+  /// up to `chunkCount` parts, preferably just after a newline, and each
+  /// part is searched in a separate call to `body` of `concurrentPerform`.
+  /// Pass a function that runs its iterations in parallel, such as
+  /// `DispatchQueue.concurrentPerform(iterations:execute:)`:
+  ///
+  ///     let matches = log.matches(
+  ///       of: /ERROR: [^\n]+/,
+  ///       chunkCount: ProcessInfo.processInfo.activeProcessorCount,
+  ///       concurrentPerform: DispatchQueue.concurrentPerform)
+  ///
+  /// Small collections are searched in a single part, as are collections
+  /// searched with a regex that uses `\G`, which depends on where each
+  /// search begins.
+  ///
+  /// - Parameters:
+  ///   - regex: The regex to search for.
+  ///   - chunkCount: The maximum number of parts to search concurrently.
+  ///   - concurrentPerform: A function that calls its second argument once
+  ///     for each integer from zero up to its first argument, possibly in
+  ///     parallel, and returns once every call has finished.
+  /// - Returns: The matches of `regex`, in order.
+  @available(SwiftStdlib 6.1, *)
+  public func matches<Output>(
+    of regex: some RegexComponent<Output>,
+    chunkCount: Int,
+    concurrentPerform: (Int, (Int) -> Void) -> Void
+  ) -> [Regex<Output>.Match] {
+    let bounds = startIndex..<endIndex
+    return Executor<Output>.parallelMatches(
+      regex.regex.program.loweredProgram,
+      self[...].base,
+      subjectBounds: bounds,
+      searchBounds: bounds,
+      chunkCount: chunkCount,
+      concurrentPerform: concurrentPerform)
+  }
+
+  /// Returns the ranges of all matches of the specified regex, searching
+  /// separate parts of the collection concurrently.
+  ///
+  /// The result is the same as `ranges(of:)`. See
+  /// `matches(of:chunkCount:concurrentPerform:)` for how the collection is
+  /// split.
+  ///
+  /// - Parameters:
+  ///   - regex: The regex to search for.
+  ///   - chunkCount: The maximum number of parts to search concurrently.
+  ///   - concurrentPerform: A function that calls its second argument once
+  ///     for each integer from zero up to its first argument, possibly in
+  ///     parallel, and returns once every call has finished.
+  /// - Returns: The ranges of the matches of `regex`, in order.
+  @available(SwiftStdlib 6.1, *)
+  public func ranges(
+    of regex: some RegexComponent,
+    chunkCount: Int,
+    concurrentPerform: (Int, (Int) -> Void) -> Void
+  ) -> [Range<Index>] {
+    matches(
+      of: regex, chunkCount: chunkCount, concurrentPerform: concurrentPerform
+    ).map(\.range)
+  }
+}
@@ -24,7 +24,15 @@ extension Compiler.ByteCodeGen {
     }
     
     if optimizationsEnabled {
+      // Checked before auto-possessification, which introduces possessive
+      // quantifiers that don't change what the regex matches.
+      builder.canUseLazyDFA = canUseLazyDFA(in: root)
       root.autoPossessify()
+      builder.prefilter = root.prefilter(options: options)
+    }
+    if let locations = root.validSourceLocations {
+      sourceLocations = locations
+      builder.instructionLocations = []
     }
     
     var list = root.nodes[...]
@@ -163,6 +171,79 @@ fileprivate extension Compiler.ByteCodeGen {
     return _canOnlyMatchAtStartImpl(&list) ?? false
   }
 
+  /// Implementation for `canUseLazyDFA`, which maintains the option state.
+  private mutating func _canUseLazyDFAImpl(
+    _ list: inout ArraySlice<DSLTree.Node>
+  ) -> Bool {
+    guard let node = list.popFirst() else { return true }
+    switch node {
+    case .atom(.backreference), .atom(.symbolicReference):
+      return false
+    case .atom(.changeMatchingOptions(let sequence)):
+      options.apply(sequence.ast)
+      return true
+    case .atom, .customCharacterClass, .quotedLiteral, .trivia, .empty:
+      return true
+
+    case .orderedChoice(let count), .concatenation(let count):
+      for _ in 0..<count {
+        guard _canUseLazyDFAImpl(&list) else { return false }
+      }
+      return true
+
+    // Transformed captures run arbitrary code on each match.
+    case .capture(_, _, let transform):
+      guard transform == nil else { return false }
+      options.beginScope()
+      defer { options.endScope() }
+      return _canUseLazyDFAImpl(&list)
+
+    // Atomic groups and lookarounds depend on backtracking order.
+    case .nonCapturingGroup(let kind):
+      options.beginScope()
+      defer { options.endScope() }
+      switch kind.ast {
+      case .nonCapture:
+        return _canUseLazyDFAImpl(&list)
+      case .changeMatchingOptions(let sequence):
+        options.apply(sequence)
+        return _canUseLazyDFAImpl(&list)
+      default:
+        return false
+      }
+
+    case .ignoreCapturesInTypedOutput, .limitCaptureNesting:
+      return _canUseLazyDFAImpl(&list)
+
+    // Possessive quantifiers can reject a match that a different number of
+    // trips would find.
+    case .quantification(_, let kind):
+      guard kind.applying(options: options) != .possessive else {
+        return false
+      }
+      return _canUseLazyDFAImpl(&list)
+
+    case .conditional, .consumer, .matcher, .characterPredicate,
+        .absentFunction:
+      return false
+    }
+  }
+
+  /// Returns a Boolean value indicating whether the regex with this node as
+  /// the root only uses features that a `LazyDFA` can simulate.
+  ///
+  /// Code generation can still produce instructions that the lazy DFA
+  /// doesn't support, which is checked separately when the program is
+  /// assembled.
+  mutating func canUseLazyDFA(in list: DSLList) -> Bool {
+    let currentOptions = options
+    options = MatchingOptions()
+    defer { options = currentOptions }
+
+    var list = list.nodes[...]
+    return _canUseLazyDFAImpl(&list)
+  }
+
   mutating func emitAlternationGen<T>(
     _ elements: inout ArraySlice<T>,
     alternationCount: Int,
@@ -200,10 +281,81 @@ fileprivate extension Compiler.ByteCodeGen {
     builder.label(done)
   }
   
+  /// The fewest alternatives for which an alternation of literals is
+  /// matched with a trie instead of save points.
+  static var literalTrieThreshold: Int { 3 }
+
+  /// Appends the literal matched by the node at the start of `list` to
+  /// `literal`, returning `false` if the node matches anything else.
+  private func _appendLiteral(
+    _ list: inout ArraySlice<DSLTree.Node>,
+    to literal: inout String
+  ) -> Bool {
+    guard let node = list.popFirst() else { return false }
+    switch node {
+    case .quotedLiteral(let s, _):
+      literal += s
+    case .atom(.char(let c)):
+      literal.append(c)
+    case .atom(.scalar(let s)):
+      literal.unicodeScalars.append(s)
+    case .concatenation(let count):
+      for _ in 0..<count {
+        guard _appendLiteral(&list, to: &literal) else { return false }
+      }
+    case .empty, .trivia:
+      break
+    default:
+      return false
+    }
+    return true
+  }
+
+  /// Returns the UTF-8 of each alternative of the alternation whose children
+  /// begin `list`, if they're all literals that a `LiteralTrie` matches the
+  /// same way as the instructions emitted for them.
+  ///
+  /// Under grapheme cluster semantics, only ASCII literals without a CR
+  /// qualify, since they're normalization-invariant and have a grapheme
+  /// boundary between each scalar, so only the end of a match needs to be
+  /// checked. Case-insensitive literals must be ASCII too.
+  func literalAlternatives(
+    _ list: ArraySlice<DSLTree.Node>,
+    alternationCount count: Int
+  ) -> [[UInt8]]? {
+    var list = list
+    var result: [[UInt8]] = []
+    for _ in 0..<count {
+      var literal = ""
+      guard _appendLiteral(&list, to: &literal) else { return nil }
+      let utf8 = Array(literal.utf8)
+      if options.semanticLevel == .graphemeCluster {
+        guard utf8.allSatisfy({ $0._isASCII && $0 != ._carriageReturn })
+        else { return nil }
+      } else if options.isCaseInsensitive {
+        guard utf8.allSatisfy(\._isASCII) else { return nil }
+      }
+      result.append(utf8)
+    }
+    return result
+  }
+
   mutating func emitAlternation(
     _ list: inout ArraySlice<DSLTree.Node>,
     alternationCount count: Int
   ) throws {
+    if optimizationsEnabled && count >= Self.literalTrieThreshold,
+       let literals = literalAlternatives(list, alternationCount: count) {
+      builder.buildMatchLiteralTrie(
+        literals,
+        isCaseInsensitive: options.isCaseInsensitive,
+        boundaryCheck: options.semanticLevel == .graphemeCluster)
+      for _ in 0..<count {
+        try skipNode(&list)
+      }
+      return
+    }
+
     try emitAlternationGen(&list, alternationCount: count, withBacktracking: true) {
       try $0.emitNode(&$1)
     }
@@ -653,6 +805,7 @@ fileprivate extension Compiler.ByteCodeGen {
   /// - ascii .customCharacterClass
   /// - single grapheme consumgin built in character classes
   /// - .any, .anyNonNewline, .dot
+  /// - single-scalar properties, and custom character classes of them
   mutating func tryEmitFastQuant(
     _ list: inout ArraySlice<DSLTree.Node>,
     _ kind: AST.Quantification.Kind,
@@ -671,10 +824,14 @@ fileprivate extension Compiler.ByteCodeGen {
     switch child {
     case .customCharacterClass(let ccc):
       // ascii only custom character class
-      guard let bitset = ccc.asAsciiBitset(options) else {
+      if let bitset = ccc.asAsciiBitset(options) {
+        builder.buildQuantify(bitset: bitset, kind, minTrips, maxExtraTrips, isScalarSemantics: isScalarSemantics)
+      } else if let set = ccc.asScalarRunSet() {
+        // custom character class of single-scalar properties
+        builder.buildQuantify(scalarRun: set, kind, minTrips, maxExtraTrips, isScalarSemantics: isScalarSemantics)
+      } else {
         return false
       }
-      builder.buildQuantify(bitset: bitset, kind, minTrips, maxExtraTrips, isScalarSemantics: isScalarSemantics)
 
     case .atom(let atom):
       switch atom {
@@ -712,6 +869,14 @@ fileprivate extension Compiler.ByteCodeGen {
           minTrips,
           maxExtraTrips,
           isScalarSemantics: isScalarSemantics)
+
+      case .unconverted(let a):
+        // Single-scalar property, e.g. `\p{L}`
+        guard case .property(let p) = a.ast.kind,
+              let set = ScalarRunSet([p], isInverted: false) else {
+          return false
+        }
+        builder.buildQuantify(scalarRun: set, kind, minTrips, maxExtraTrips, isScalarSemantics: isScalarSemantics)
       default:
         return false
       }
@@ -750,7 +915,15 @@ fileprivate extension Compiler.ByteCodeGen {
 
   @discardableResult
   mutating func emitNode(_ list: inout ArraySlice<DSLTree.Node>) throws -> ValueRegister? {
+    let position = list.startIndex
     guard let node = list.popFirst() else { return nil }
+    let firstInstruction = builder.instructions.count
+    defer {
+      if let sourceLocations, position < sourceLocations.count {
+        builder.recordLocation(
+          sourceLocations[position], ofInstructionsFrom: firstInstruction)
+      }
+    }
     switch node {
       
     case let .orderedChoice(n):
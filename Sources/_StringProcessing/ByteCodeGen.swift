@@ -21,6 +21,9 @@ extension Compiler {
     /// A Boolean indicating whether the first matchable atom has been emitted.
     /// This is used to determine whether to apply initial options.
     var hasEmittedFirstMatchableAtom = false
+    /// The source location of each node in the list being emitted, if
+    /// recorded, which the emitted instructions are attributed to.
+    var sourceLocations: [SourceLocation?]? = nil
 
     private let compileOptions: _CompileOptions
     internal var optimizationsEnabled: Bool {
@@ -37,6 +40,10 @@ extension Compiler {
       self.builder.captureList = captureList
       self.builder.enableTracing = compileOptions.contains(.enableTracing)
       self.builder.enableMetrics = compileOptions.contains(.enableMetrics)
+      self.builder.enableThreadedCode =
+        compileOptions.contains(.enableThreadedCode)
+      self.builder.enableOptimizationPasses = optimizationsEnabled
+        && !compileOptions.contains(.disableOptimizationPasses)
     }
   }
 }
@@ -111,14 +118,20 @@ extension Compiler.ByteCodeGen {
 
       // Longer content will be matched against UTF-8 in contiguous
       // memory
-      //
-      // TODO: case-insensitive variant (just add/subtract from
-      // ASCII value)
       if s.utf8.count >= longThreshold, !options.isCaseInsensitive {
         let boundaryCheck = options.semanticLevel == .graphemeCluster
         builder.buildMatchUTF8(Array(s.utf8), boundaryCheck: boundaryCheck)
         return
       }
+
+      // Case-insensitive ASCII content is matched against the case-folded
+      // UTF-8 of the input
+      if s.utf8.count >= longThreshold, s.utf8.allSatisfy(\._isASCII) {
+        let boundaryCheck = options.semanticLevel == .graphemeCluster
+        builder.buildMatchUTF8CaseInsensitive(
+          Array(s.utf8), boundaryCheck: boundaryCheck)
+        return
+      }
     }
 
     guard options.semanticLevel == .graphemeCluster else {
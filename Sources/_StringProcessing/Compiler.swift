@@ -93,7 +93,8 @@ enum RegexCompilationError: Error, Hashable, CustomStringConvertible {
 func _compileRegex(
   _ regex: String,
   _ syntax: SyntaxOptions = .traditional,
-  _ semanticLevel: RegexSemanticLevel? = nil
+  _ semanticLevel: RegexSemanticLevel? = nil,
+  compileOptions: _CompileOptions = .default
 ) throws -> MEProgram {
   var ast = try parse(regex, syntax)
   let dsl: DSLList
@@ -110,7 +111,7 @@ func _compileRegex(
   case .none:
     dsl = DSLList(ast: ast)
   }
-  let program = try Compiler(list: dsl).emit()
+  let program = try Compiler(tree: dsl, compileOptions: compileOptions).emit()
   return program
 }
 
@@ -124,5 +125,39 @@ public struct _CompileOptions: OptionSet {
   public static let disableOptimizations = _CompileOptions(rawValue: 1 << 0)
   public static let enableTracing = _CompileOptions(rawValue: 1 << 1)
   public static let enableMetrics = _CompileOptions(rawValue: 1 << 2)
+  public static let disableOptimizationPasses = _CompileOptions(rawValue: 1 << 3)
+  public static let enableThreadedCode = _CompileOptions(rawValue: 1 << 4)
   public static let `default`: _CompileOptions = []
 }
+
+/// The stages of compiling a regex from a pattern, which can be run
+/// separately to measure how each one scales with the size of the pattern.
+@_spi(RegexBenchmark)
+public struct _CompilationStages {
+  let pattern: String
+  let ast: AST
+  let list: DSLList
+
+  /// Parses and lowers `pattern`, keeping each stage's result as the input
+  /// to the next.
+  public init(pattern: String) throws {
+    self.pattern = pattern
+    self.ast = try _RegexParser.parse(pattern, .traditional)
+    self.list = DSLList(ast: ast)
+  }
+
+  /// Parses and validates the pattern.
+  public func parse() throws {
+    _ = try _RegexParser.parse(pattern, .traditional)
+  }
+
+  /// Lowers the parsed pattern to a list of nodes.
+  public func lower() {
+    _ = DSLList(ast: ast)
+  }
+
+  /// Generates the program for the lowered pattern.
+  public func emit() throws {
+    _ = try Compiler(tree: list, compileOptions: .default).emit()
+  }
+}
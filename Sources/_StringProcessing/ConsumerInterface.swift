@@ -61,7 +61,7 @@ extension String {
         continue
       }
       
-      if self[index] != other[otherIndex] && self[index].lowercased() != other[otherIndex].lowercased() {
+      if self[index] != other[otherIndex] && !self[index].caseFoldedEquals(other[otherIndex]) {
         return false
       }
 
@@ -274,6 +274,24 @@ extension DSLTree.CustomCharacterClass {
       }
     )
   }
+
+  /// Returns a set matching the same scalars as this class, if its members
+  /// are all properties that each look at a single scalar.
+  func asScalarRunSet() -> ScalarRunSet? {
+    var properties: [AST.Atom.CharacterProperty] = []
+    for member in members {
+      switch member {
+      case .atom(.unconverted(let a)):
+        guard case .property(let p) = a.ast.kind else { return nil }
+        properties.append(p)
+      case .trivia:
+        continue
+      default:
+        return nil
+      }
+    }
+    return ScalarRunSet(properties, isInverted: isInverted)
+  }
 }
 
 // NOTE: Conveniences, though not most performant
@@ -285,6 +303,9 @@ private func scriptScalarPredicate(_ s: Unicode.Script) -> ScalarPredicate {
 private func scriptExtensionScalarPredicate(_ s: Unicode.Script) -> ScalarPredicate {
   { Unicode.Script.extensions(for: $0).contains(s) }
 }
+private func assignedScalarPredicate() -> ScalarPredicate {
+  { $0.properties.generalCategory != .unassigned }
+}
 private func categoryScalarPredicate(_ gc: Unicode.GeneralCategory) -> ScalarPredicate {
   { gc == $0.properties.generalCategory }
 }
@@ -369,9 +390,7 @@ extension AST.Atom.CharacterProperty {
           return input.index(after: bounds.lowerBound)
         }
       case .assigned:
-        return consume {
-          $0.properties.generalCategory != .unassigned
-        }
+        return consume(assignedScalarPredicate())
       case .ascii:
         // Note: ASCII must look at the whole character, not just the first
         // scalar. That is, "e\u{301}" is not an ASCII character, even though
@@ -446,6 +465,27 @@ extension AST.Atom.CharacterProperty {
     if !isInverted { return preInversion }
     return invert(preInversion)
   }
+
+  /// The predicate that a scalar must satisfy to match this property, with
+  /// any inversion applied, if the property only looks at a single scalar
+  /// (in grapheme semantics, a character's leading scalar).
+  var scalarPredicate: ScalarPredicate? {
+    let predicate: ScalarPredicate
+    switch kind {
+    case .assigned:
+      predicate = assignedScalarPredicate()
+    case .generalCategory(let p):
+      predicate = p.scalarPredicate
+    case .script(let s):
+      predicate = scriptScalarPredicate(s)
+    case .scriptExtension(let s):
+      predicate = scriptExtensionScalarPredicate(s)
+    default:
+      return nil
+    }
+    if !isInverted { return predicate }
+    return { !predicate($0) }
+  }
 }
 
 extension Unicode.BinaryProperty {
@@ -677,115 +717,118 @@ extension Unicode.ExtendedGeneralCategory {
   func generateConsumer(
     _ opts: MatchingOptions
   ) throws -> MEProgram.ConsumeFunction {
-    let consume = consumeFunction(for: opts)
+    consumeFunction(for: opts)(scalarPredicate)
+  }
 
+  /// The predicate that a scalar must satisfy to be in this category.
+  var scalarPredicate: ScalarPredicate {
     switch self {
     case .letter:
-      return consume(categoriesScalarPredicate([
+      return categoriesScalarPredicate([
         .uppercaseLetter, .lowercaseLetter,
         .titlecaseLetter, .modifierLetter,
         .otherLetter
-      ]))
+      ])
 
     case .mark:
-      return consume(categoriesScalarPredicate([
+      return categoriesScalarPredicate([
         .nonspacingMark, .spacingMark, .enclosingMark
-      ]))
+      ])
 
     case .number:
-      return consume(categoriesScalarPredicate([
+      return categoriesScalarPredicate([
         .decimalNumber, .letterNumber, .otherNumber
-      ]))
+      ])
 
     case .symbol:
-      return consume(categoriesScalarPredicate([
+      return categoriesScalarPredicate([
         .mathSymbol, .currencySymbol, .modifierSymbol,
         .otherSymbol
-      ]))
+      ])
 
     case .punctuation:
-      return consume(categoriesScalarPredicate([
+      return categoriesScalarPredicate([
         .connectorPunctuation, .dashPunctuation,
         .openPunctuation, .closePunctuation,
         .initialPunctuation, .finalPunctuation,
         .otherPunctuation
-      ]))
+      ])
 
     case .separator:
-      return consume(categoriesScalarPredicate([
+      return categoriesScalarPredicate([
         .spaceSeparator, .lineSeparator, .paragraphSeparator
-      ]))
+      ])
 
     case .other:
-      return consume(categoriesScalarPredicate([
+      return categoriesScalarPredicate([
         .control, .format, .surrogate, .privateUse, .unassigned
-      ]))
+      ])
 
     case .casedLetter:
-      return consume(categoriesScalarPredicate([
+      return categoriesScalarPredicate([
         .uppercaseLetter, .lowercaseLetter, .titlecaseLetter
-      ]))
+      ])
 
     case .control:
-      return consume(categoryScalarPredicate(.control))
+      return categoryScalarPredicate(.control)
     case .format:
-      return consume(categoryScalarPredicate(.format))
+      return categoryScalarPredicate(.format)
     case .unassigned:
-      return consume(categoryScalarPredicate(.unassigned))
+      return categoryScalarPredicate(.unassigned)
     case .privateUse:
-      return consume(categoryScalarPredicate(.privateUse))
+      return categoryScalarPredicate(.privateUse)
     case .surrogate:
-      return consume(categoryScalarPredicate(.surrogate))
+      return categoryScalarPredicate(.surrogate)
     case .lowercaseLetter:
-      return consume(categoryScalarPredicate(.lowercaseLetter))
+      return categoryScalarPredicate(.lowercaseLetter)
     case .modifierLetter:
-      return consume(categoryScalarPredicate(.modifierLetter))
+      return categoryScalarPredicate(.modifierLetter)
     case .otherLetter:
-      return consume(categoryScalarPredicate(.otherLetter))
+      return categoryScalarPredicate(.otherLetter)
     case .titlecaseLetter:
-      return consume(categoryScalarPredicate(.titlecaseLetter))
+      return categoryScalarPredicate(.titlecaseLetter)
     case .uppercaseLetter:
-      return consume(categoryScalarPredicate(.uppercaseLetter))
+      return categoryScalarPredicate(.uppercaseLetter)
     case .spacingMark:
-      return consume(categoryScalarPredicate(.spacingMark))
+      return categoryScalarPredicate(.spacingMark)
     case .enclosingMark:
-      return consume(categoryScalarPredicate(.enclosingMark))
+      return categoryScalarPredicate(.enclosingMark)
     case .nonspacingMark:
-      return consume(categoryScalarPredicate(.nonspacingMark))
+      return categoryScalarPredicate(.nonspacingMark)
     case .decimalNumber:
-      return consume(categoryScalarPredicate(.decimalNumber))
+      return categoryScalarPredicate(.decimalNumber)
     case .letterNumber:
-      return consume(categoryScalarPredicate(.letterNumber))
+      return categoryScalarPredicate(.letterNumber)
     case .otherNumber:
-      return consume(categoryScalarPredicate(.otherNumber))
+      return categoryScalarPredicate(.otherNumber)
     case .connectorPunctuation:
-      return consume(categoryScalarPredicate(.connectorPunctuation))
+      return categoryScalarPredicate(.connectorPunctuation)
     case .dashPunctuation:
-      return consume(categoryScalarPredicate(.dashPunctuation))
+      return categoryScalarPredicate(.dashPunctuation)
     case .closePunctuation:
-      return consume(categoryScalarPredicate(.closePunctuation))
+      return categoryScalarPredicate(.closePunctuation)
     case .finalPunctuation:
-      return consume(categoryScalarPredicate(.finalPunctuation))
+      return categoryScalarPredicate(.finalPunctuation)
     case .initialPunctuation:
-      return consume(categoryScalarPredicate(.initialPunctuation))
+      return categoryScalarPredicate(.initialPunctuation)
     case .otherPunctuation:
-      return consume(categoryScalarPredicate(.otherPunctuation))
+      return categoryScalarPredicate(.otherPunctuation)
     case .openPunctuation:
-      return consume(categoryScalarPredicate(.openPunctuation))
+      return categoryScalarPredicate(.openPunctuation)
     case .currencySymbol:
-      return consume(categoryScalarPredicate(.currencySymbol))
+      return categoryScalarPredicate(.currencySymbol)
     case .modifierSymbol:
-      return consume(categoryScalarPredicate(.modifierSymbol))
+      return categoryScalarPredicate(.modifierSymbol)
     case .mathSymbol:
-      return consume(categoryScalarPredicate(.mathSymbol))
+      return categoryScalarPredicate(.mathSymbol)
     case .otherSymbol:
-      return consume(categoryScalarPredicate(.otherSymbol))
+      return categoryScalarPredicate(.otherSymbol)
     case .lineSeparator:
-      return consume(categoryScalarPredicate(.lineSeparator))
+      return categoryScalarPredicate(.lineSeparator)
     case .paragraphSeparator:
-      return consume(categoryScalarPredicate(.paragraphSeparator))
+      return categoryScalarPredicate(.paragraphSeparator)
     case .spaceSeparator:
-      return consume(categoryScalarPredicate(.spaceSeparator))
+      return categoryScalarPredicate(.spaceSeparator)
 
     #if RESILIENT_LIBRARIES
     @unknown default:
@@ -10,6 +10,12 @@
 //===----------------------------------------------------------------------===//
 
 extension Processor {
+  /// A point to resume from when matching fails.
+  ///
+  /// Save points are fixed-size and don't retain any storage, so pushing one
+  /// is cheap. Rather than copying the captures and registers, a save point
+  /// records the height of the processor's `trail`; any changes made after
+  /// the save point was pushed are undone from the trail when resuming.
   struct SavePoint {
     var pc: InstructionAddress
     var pos: Position?
@@ -21,25 +27,8 @@ extension Processor {
     //        points. We should try to separate out the concerns better.
     var isScalarSemantics: Bool
 
-    // FIXME: Save minimal info (e.g. stack position and
-    // perhaps current start)
-    var captureEnds: [_StoredCapture]
-
-    // The int registers store values that can be relevant to
-    // backtracking, such as the number of trips in a quantification.
-    var intRegisters: [Int]
-    // Same with position registers
-    var posRegisters: [Input.Index]
-
-    var destructure: (
-      pc: InstructionAddress,
-      pos: Position?,
-      captureEnds: [_StoredCapture],
-      intRegisters: [Int],
-      PositionRegister: [Input.Index]
-    ) {
-      return (pc, pos, captureEnds, intRegisters, posRegisters)
-    }
+    /// The number of entries in the trail when this save point was pushed.
+    var trailHeight: Int
 
     // Whether this save point is quantified, meaning it has a range of
     // possible positions to explore.
@@ -63,12 +52,21 @@ extension Processor {
       if isScalarSemantics {
         newUpper = input.unicodeScalars.index(before: range.upperBound)
       } else {
-        newUpper = input.index(before: range.upperBound)
+        newUpper = input._quickIndex(beforeCharacterEndingAt: range.upperBound)
+          ?? input.index(before: range.upperBound)
       }
       quantifiedRange = range.lowerBound..<newUpper
     }
   }
 
+  /// A value overwritten while a save point was live, which is restored when
+  /// backtracking to that save point.
+  enum TrailEntry {
+    case capture(Int, _StoredCapture)
+    case int(IntRegister, Int)
+    case position(PositionRegister, Position)
+  }
+
   func makeSavePoint(
     resumingAt pc: InstructionAddress
   ) -> SavePoint {
@@ -77,9 +75,7 @@ extension Processor {
       pos: currentPosition,
       quantifiedRange: nil,
       isScalarSemantics: false,
-      captureEnds: storedCaptures,
-      intRegisters: registers.ints,
-      posRegisters: registers.positions)
+      trailHeight: trail.count)
   }
 
   func makeAddressOnlySavePoint(
@@ -90,9 +86,7 @@ extension Processor {
       pos: nil,
       quantifiedRange: nil,
       isScalarSemantics: false,
-      captureEnds: storedCaptures,
-      intRegisters: registers.ints,
-      posRegisters: registers.positions)
+      trailHeight: trail.count)
   }
 
   func makeQuantifiedSavePoint(
@@ -104,10 +98,85 @@ extension Processor {
       pos: nil,
       quantifiedRange: range,
       isScalarSemantics: isScalarSemantics,
-      captureEnds: storedCaptures,
-      intRegisters: registers.ints,
-      posRegisters: registers.positions)
+      trailHeight: trail.count)
   }
 }
 
+extension Processor {
+  // MARK: Trailed state
+  //
+  // Captures and int/position registers must only be modified after calling
+  // these methods, so that the previous value is recorded if a save point
+  // could need it. Nothing is recorded when there are no save points.
+
+  /// Records the current value of capture `capNum` before modifying it.
+  mutating func trailCapture(_ capNum: Int) {
+    if !savePoints.isEmpty {
+      trail.append(.capture(capNum, storedCaptures[capNum]))
+    }
+  }
+
+  mutating func setRegister(_ reg: IntRegister, to value: Int) {
+    if !savePoints.isEmpty {
+      trail.append(.int(reg, registers[reg]))
+    }
+    registers[reg] = value
+  }
+
+  mutating func setRegister(_ reg: PositionRegister, to value: Position) {
+    if !savePoints.isEmpty {
+      trail.append(.position(reg, registers[reg]))
+    }
+    registers[reg] = value
+  }
 
+  /// Undoes the changes recorded in the trail above `height`.
+  ///
+  /// When `preservingCaptures` is true, only registers are restored. The
+  /// capture entries are kept on the trail, since an earlier save point
+  /// still needs them to undo the preserved captures.
+  mutating func unwindTrail(to height: Int, preservingCaptures: Bool) {
+    assert(height <= trail.count)
+    guard preservingCaptures else {
+      while trail.count > height {
+        switch trail.removeLast() {
+        case let .capture(capNum, capture):
+          storedCaptures[capNum] = capture
+        case let .int(reg, value):
+          registers[reg] = value
+        case let .position(reg, value):
+          registers[reg] = value
+        }
+      }
+      return
+    }
+
+    // Restore registers newest-first, so the oldest value wins...
+    for i in (height..<trail.count).reversed() {
+      switch trail[i] {
+      case .capture:
+        break
+      case let .int(reg, value):
+        registers[reg] = value
+      case let .position(reg, value):
+        registers[reg] = value
+      }
+    }
+    // ...then compact the capture entries, keeping their order.
+    var kept = height
+    for i in height..<trail.count {
+      if case .capture = trail[i] {
+        trail.swapAt(kept, i)
+        kept += 1
+      }
+    }
+    trail.removeLast(trail.count - kept)
+  }
+
+  /// Discards the trail if no save point can refer to it anymore.
+  mutating func trimTrail() {
+    if savePoints.isEmpty && !trail.isEmpty {
+      trail.removeAll(keepingCapacity: true)
+    }
+  }
+}
@@ -168,12 +168,14 @@ extension Instruction.Payload {
     return (scalar, caseInsensitive: caseInsensitive, boundaryCheck: boundaryCheck)
   }
 
-  init(utf8: UTF8Register, boundaryCheck: Bool) {
-    self.init(boundaryCheck ? 1 : 0, utf8)
+  init(utf8: UTF8Register, boundaryCheck: Bool, isCaseInsensitive: Bool) {
+    self.init((boundaryCheck ? 1 : 0) | (isCaseInsensitive ? 2 : 0), utf8)
   }
-  var matchUTF8Payload: (UTF8Register, boundaryCheck: Bool) {
+  var matchUTF8Payload: (
+    UTF8Register, boundaryCheck: Bool, isCaseInsensitive: Bool
+  ) {
     let pair: (UInt64, UTF8Register) = interpretPair()
-    return (pair.1, pair.0 == 1)
+    return (pair.1, pair.0 & 1 != 0, pair.0 & 2 != 0)
   }
 
   init(utf8: UTF8Register) {
@@ -242,6 +244,13 @@ extension Instruction.Payload {
     return (isScalar: pair.0 == 1, pair.1)
   }
 
+  init(literalTrie: LiteralTrieRegister) {
+    self.init(literalTrie)
+  }
+  var literalTrie: LiteralTrieRegister {
+    interpret()
+  }
+
   init(consumer: ConsumeFunctionRegister) {
     self.init(consumer)
   }
@@ -390,6 +399,7 @@ struct QuantifyPayload: RawRepresentable {
     case asciiChar = 1
     case any = 2
     case builtinCC = 4
+    case scalarRun = 5
   }
 
   // TODO: figure out how to better organize this...
@@ -398,7 +408,7 @@ struct QuantifyPayload: RawRepresentable {
   // The top 8 bits are reserved for the opcode so we have 56 bits to work with
   // b55-b39 - Unused
   // b39-b38 - isScalarSemantics
-  // b38-b35 - Payload type (one of 4 types, stored on 3 bits)
+  // b38-b35 - Payload type (one of 5 types, stored on 3 bits)
   // b35-b27 - minTrips (8 bit int)
   // b27-b18 - maxExtraTrips (8 bit value, one bit for nil)
   // b18-b16 - Quantification type (one of three types)
@@ -471,6 +481,18 @@ struct QuantifyPayload: RawRepresentable {
       + QuantifyPayload.packInfoValues(kind, minTrips, maxExtraTrips, .asciiBitset, isScalarSemantics: isScalarSemantics)
   }
 
+  init(
+    scalarRun: ScalarRunSetRegister,
+    _ kind: AST.Quantification.Kind,
+    _ minTrips: Int,
+    _ maxExtraTrips: Int?,
+    isScalarSemantics: Bool
+  ) {
+    assert(scalarRun.bits <= _payloadMask)
+    self.rawValue = scalarRun.bits
+      + QuantifyPayload.packInfoValues(kind, minTrips, maxExtraTrips, .scalarRun, isScalarSemantics: isScalarSemantics)
+  }
+
   init(
     asciiChar: UInt8,
     _ kind: AST.Quantification.Kind,
@@ -543,6 +565,10 @@ struct QuantifyPayload: RawRepresentable {
     TypedInt(self.rawValue & payloadMask)
   }
 
+  var scalarRun: ScalarRunSetRegister {
+    TypedInt(self.rawValue & payloadMask)
+  }
+
   var asciiChar: UInt8 {
     UInt8(asserting: self.rawValue & payloadMask)
   }
@@ -123,6 +123,17 @@ extension Instruction {
     ///     matchUTF8(_: UTF8Register, boundaryCheck: Bool)
     case matchUTF8
 
+    /// Match any of an alternation of literals, stored in a trie
+    ///
+    ///     matchLiteralTrie(_: LiteralTrieRegister)
+    ///
+    /// Operand: Literal trie register containing the alternatives
+    ///
+    /// Continues with the first alternative that matches, and pushes a save
+    /// point resuming at the next instruction for each of the others, in
+    /// alternative order.
+    case matchLiteralTrie
+
     /// Match a character or a scalar against a set of valid ascii values stored in a bitset
     ///
     ///     matchBitset(_: AsciiBitsetRegister, isScalar: Bool)
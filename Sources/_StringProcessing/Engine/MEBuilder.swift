@@ -18,11 +18,21 @@ extension MEProgram {
     // Tracing
     var enableTracing = false
     var enableMetrics = false
+    var enableThreadedCode = false
+
+    // Run `optimizationPasses` over the assembled instructions
+    var enableOptimizationPasses = false
+
+    // The pattern location each instruction was emitted for, recorded when
+    // the regex is profiled
+    var instructionLocations: [SourceLocation?]? = nil
 
     var elements = TypedSetVector<Input.Element, _ElementRegister>()
     var utf8Contents = TypedSetVector<[UInt8], _UTF8Register>()
 
     var asciiBitsets: [DSLTree.CustomCharacterClass.AsciiBitset] = []
+    var scalarRunSets: [ScalarRunSet] = []
+    var literalTries: [LiteralTrie] = []
     var consumeFunctions: [ConsumeFunction] = []
     var transformFunctions: [TransformFunction] = []
     var matcherFunctions: [MatcherFunction] = []
@@ -48,11 +58,25 @@ extension MEProgram {
     // Special addresses or instructions
     var failAddressToken: AddressToken? = nil
 
-    var captureList = CaptureList()
+    var captureList = CaptureList() {
+      didSet {
+        captureIndicesByName = [:]
+        for (i, capture) in captureList.captures.enumerated() {
+          if let name = capture.name, captureIndicesByName[name] == nil {
+            captureIndicesByName[name] = i
+          }
+        }
+      }
+    }
+    // The index in `captureList` of each named capture, so that resolving a
+    // name doesn't search the list.
+    var captureIndicesByName: [String: Int] = [:]
     var initialOptions = MatchingOptions()
 
     // Starting constraint
     var canOnlyMatchAtStart = false
+    var prefilter: MEProgram.Prefilter? = nil
+    var canUseLazyDFA = false
     
     // Symbolic reference resolution
     var unresolvedReferences: [ReferenceID: [InstructionAddress]] = [:]
@@ -81,7 +105,7 @@ extension MEProgram.Builder {
 
   // Maps the AST's named capture offset to a capture register
   func captureRegister(named name: String) throws -> CaptureRegister {
-    guard let index = captureList.indexOfCapture(named: name) else {
+    guard let index = captureIndicesByName[name] else {
       throw RegexCompilationError.uncapturedReference
     }
     return .init(index - 1)
@@ -200,7 +224,35 @@ extension MEProgram.Builder {
 
   mutating func buildMatchUTF8(_ utf8: Array<UInt8>, boundaryCheck: Bool) {
     instructions.append(.init(.matchUTF8, .init(
-      utf8: utf8Contents.store(utf8), boundaryCheck: boundaryCheck)))
+      utf8: utf8Contents.store(utf8),
+      boundaryCheck: boundaryCheck,
+      isCaseInsensitive: false)))
+  }
+
+  /// Builds a case-insensitive match of an ASCII literal, which is stored
+  /// case-folded so that only the input needs folding when matching.
+  mutating func buildMatchUTF8CaseInsensitive(
+    _ utf8: Array<UInt8>,
+    boundaryCheck: Bool
+  ) {
+    assert(utf8.allSatisfy(\._isASCII))
+    instructions.append(.init(.matchUTF8, .init(
+      utf8: utf8Contents.store(utf8.map(\._asciiLowercased)),
+      boundaryCheck: boundaryCheck,
+      isCaseInsensitive: true)))
+  }
+
+  mutating func buildMatchLiteralTrie(
+    _ literals: [[UInt8]],
+    isCaseInsensitive: Bool,
+    boundaryCheck: Bool
+  ) {
+    let trie = LiteralTrie(
+      literals,
+      isCaseInsensitive: isCaseInsensitive,
+      boundaryCheck: boundaryCheck)
+    instructions.append(.init(
+      .matchLiteralTrie, .init(literalTrie: makeLiteralTrie(trie))))
   }
 
   mutating func buildMatchScalar(_ s: Unicode.Scalar, boundaryCheck: Bool) {
@@ -280,6 +332,18 @@ extension MEProgram.Builder {
       .init(quantify: .init(asciiChar: asciiChar, kind, minTrips, maxExtraTrips, isScalarSemantics: isScalarSemantics))))
   }
 
+  mutating func buildQuantify(
+    scalarRun set: ScalarRunSet,
+    _ kind: AST.Quantification.Kind,
+    _ minTrips: Int,
+    _ maxExtraTrips: Int?,
+    isScalarSemantics: Bool
+  ) {
+    instructions.append(.init(
+      .quantify,
+      .init(quantify: .init(scalarRun: makeScalarRunSet(set), kind, minTrips, maxExtraTrips, isScalarSemantics: isScalarSemantics))))
+  }
+
   mutating func buildQuantifyAny(
     matchesNewlines: Bool,
     _ kind: AST.Quantification.Kind,
@@ -419,10 +483,19 @@ extension MEProgram.Builder {
         inst.opcode, payload)
     }
 
+    if instructionLocations != nil {
+      recordLocation(nil, ofInstructionsFrom: instructions.count)
+    }
+    if enableOptimizationPasses {
+      runOptimizationPasses(&instructions)
+    }
+
     let regs = Processor.Registers(
       elements: elements.stored,
       utf8Contents: utf8Contents.stored,
       bitsets: asciiBitsets,
+      scalarRunSets: scalarRunSets,
+      literalTries: literalTries,
       consumeFunctions: consumeFunctions,
       transformFunctions: transformFunctions,
       matcherFunctions: matcherFunctions,
@@ -434,8 +507,9 @@ extension MEProgram.Builder {
     let storedCaps = Array(
       repeating: Processor._StoredCapture(), count: nextCaptureRegister.rawValue)
 
-    let meProgram = MEProgram(
-      instructions: InstructionList(instructions),
+    let instructionList = InstructionList(instructions)
+    var meProgram = MEProgram(
+      instructions: instructionList,
       wholeMatchValueRegister: wholeMatchValue,
       enableTracing: enableTracing,
       enableMetrics: enableMetrics,
@@ -443,12 +517,43 @@ extension MEProgram.Builder {
       referencedCaptureOffsets: referencedCaptureOffsets,
       initialOptions: initialOptions,
       canOnlyMatchAtStart: canOnlyMatchAtStart,
+      prefilter: prefilter,
+      canUseLazyDFA: canUseLazyDFA
+        && LazyDFA.canSimulate(instructionList, registers: regs),
+      memoRows: MEProgram.memoizationRows(instructionList),
+      instructionLocations: instructionLocations,
       registers: regs,
       storedCaptures: storedCaps)
+    if meProgram.canUseLazyDFA {
+      meProgram.lazyDFAs = LazyDFACache()
+    }
+
+    // Tracing and metrics are recorded by the interpreter.
+    if enableThreadedCode && !enableTracing && !enableMetrics {
+      meProgram.threadedCode = ThreadedCode(instructionList, registers: regs)
+    }
     return meProgram
   }
 
   mutating func reset() { self = Self() }
+
+  /// Records `location` for the instructions from `start` on that don't
+  /// have a location yet, if locations are being recorded.
+  mutating func recordLocation(
+    _ location: SourceLocation?,
+    ofInstructionsFrom start: Int
+  ) {
+    guard instructionLocations != nil else { return }
+    let count = instructions.count
+    if instructionLocations!.count < count {
+      instructionLocations!.append(contentsOf:
+        repeatElement(nil, count: count - instructionLocations!.count))
+    }
+    guard let location, location.isReal else { return }
+    for pc in start..<count where instructionLocations![pc] == nil {
+      instructionLocations![pc] = location
+    }
+  }
 }
 
 // Address-agnostic interfaces for label-like support
@@ -583,6 +688,20 @@ extension MEProgram.Builder {
     defer { asciiBitsets.append(b) }
     return AsciiBitsetRegister(asciiBitsets.count)
   }
+
+  mutating func makeScalarRunSet(
+    _ s: ScalarRunSet
+  ) -> ScalarRunSetRegister {
+    defer { scalarRunSets.append(s) }
+    return ScalarRunSetRegister(scalarRunSets.count)
+  }
+
+  mutating func makeLiteralTrie(
+    _ t: LiteralTrie
+  ) -> LiteralTrieRegister {
+    defer { literalTries.append(t) }
+    return LiteralTrieRegister(literalTries.count)
+  }
   
   mutating func makeConsumeFunction(
     _ f: @escaping MEProgram.ConsumeFunction
@@ -0,0 +1,741 @@
+//===----------------------------------------------------------------------===//
+//
+// This source file is part of the Swift.org open source project
+//
+// Copyright (c) 2025 Apple Inc. and the Swift project authors
+// Licensed under Apache License v2.0 with Runtime Library Exception
+//
+// See https://swift.org/LICENSE.txt for license information
+//
+//===----------------------------------------------------------------------===//
+
+internal import _RegexParser
+
+/// A lazily built DFA that decides whether a program matches, without
+/// backtracking.
+///
+/// The program's instructions are read as an NFA: save points fork a thread,
+/// and instructions that only manage backtracking state do nothing. Every
+/// thread advances through the input in lockstep, so the time taken is linear
+/// in the length of the input no matter how much backtracking the program
+/// would otherwise need.
+///
+/// Each distinct set of threads is interned as a state. Consuming a
+/// standalone ASCII byte can't depend on the surrounding input, so those
+/// transitions are cached per state, and scanning ASCII input becomes a table
+/// lookup per byte once the cache is warm. Everything else (non-ASCII input,
+/// assertions, multi-unit consumers) is stepped through the same `String`
+/// matching functions that `Processor` uses.
+///
+/// The cache is bounded, and is discarded and rebuilt when it fills up. An
+/// `MEProgram` is shared between threads, so a search takes a `LazyDFA` out
+/// of the program's `LazyDFACache` while it runs, and puts it back after.
+struct LazyDFA {
+  /// Where a match can begin.
+  enum Mode {
+    /// Only at the processor's current position.
+    case anchored
+    /// At the processor's current position, or any later position that
+    /// `Executor._firstMatch` would try.
+    case search
+  }
+
+  /// An NFA thread, with the address of the instruction it's stopped at in
+  /// the upper 32 bits and a counter in the lower 32 bits.
+  ///
+  /// The counter is the number of trips taken by a `quantify` instruction,
+  /// the number of bytes of a `matchUTF8` instruction matched so far, or the
+  /// node reached in the trie of a `matchLiteralTrie` instruction.
+  typealias Thread = UInt64
+
+  /// Set in the counter of a `matchLiteralTrie` thread when the literal
+  /// ending at its node doesn't end on a grapheme cluster boundary, so the
+  /// thread can only continue in the trie.
+  private static var missedBoundaryFlag: UInt64 { 1 << 31 }
+
+  private struct State {
+    /// The threads in this state, each stopped at a consuming instruction,
+    /// an assertion, or `accept`, in sorted order.
+    var threads: [Thread]
+
+    /// The threads stopped at a consuming instruction.
+    var consumers: [Thread] = []
+
+    /// The threads stopped at an assertion, which must be evaluated at a
+    /// specific position before the state can consume input.
+    var assertions: [Thread] = []
+
+    /// Whether a thread has reached `accept`.
+    var accepts = false
+
+    /// Whether every consumer matches a standalone ASCII character by looking
+    /// at its byte alone, so transitions can be cached by byte.
+    var isByteLocal = true
+
+    /// The state reached by consuming each ASCII byte, or `-1` if not yet
+    /// computed. Empty until the first transition is cached.
+    var transitions: [Int32] = []
+
+    /// The states produced by `expand`, keyed by the outcomes of
+    /// `assertions`.
+    var expansions: [UInt64: Int] = [:]
+  }
+
+  /// The maximum number of states held in the cache.
+  static var maxCachedStates: Int { 512 }
+
+  let mode: Mode
+
+  private let instructions: InstructionList<Instruction>
+  private let registers: Processor.Registers
+  private let isScalarSemantics: Bool
+
+  private var states: [State] = []
+  private var stateIDs: [[Thread]: Int] = [:]
+
+  /// Incremented each time the cache is discarded, which invalidates any
+  /// state IDs held across a call to `intern`.
+  private var generation = 0
+
+  /// The threads that begin a match, computed on first use.
+  private var startThreads: [Thread]? = nil
+
+  // Scratch storage for `closure(of:)`.
+  private var visited: Set<Thread> = []
+  private var stack: [Thread] = []
+
+  /// Creates a lazy DFA for `program`, or returns `nil` if the program uses
+  /// features that can't be simulated without backtracking.
+  init?(_ program: MEProgram, mode: Mode) {
+    guard program.canUseLazyDFA else { return nil }
+    self.mode = mode
+    self.instructions = program.instructions
+    self.registers = program.registers
+    self.isScalarSemantics =
+      program.initialOptions.semanticLevel == .unicodeScalar
+  }
+}
+
+/// The lazy DFAs of a program, kept between searches so that the states and
+/// transitions one search caches are there for the next.
+///
+/// A search takes a DFA out of the cache while it runs, so searches on
+/// different threads never share one. A search that finds the cache empty
+/// creates a DFA, and the last one to finish keeps its DFA in the cache.
+final class LazyDFACache {
+  private let lock = Lock()
+  private var anchored: LazyDFA? = nil
+  private var searching: LazyDFA? = nil
+
+  /// Removes and returns the cached DFA with the given mode, if any.
+  func take(_ mode: LazyDFA.Mode) -> LazyDFA? {
+    lock.withLock {
+      switch mode {
+      case .anchored:
+        defer { anchored = nil }
+        return anchored
+      case .search:
+        defer { searching = nil }
+        return searching
+      }
+    }
+  }
+
+  /// Stores `dfa` for the next search that uses its mode.
+  func putBack(_ dfa: LazyDFA) {
+    lock.withLock {
+      switch dfa.mode {
+      case .anchored: anchored = dfa
+      case .search: searching = dfa
+      }
+    }
+  }
+}
+
+extension LazyDFA {
+  /// Returns whether `instructions` can be simulated by a lazy DFA.
+  ///
+  /// Save points are read as forks, so instructions that discard them are
+  /// only allowed in the shape emitted for possessive quantification. Regexes
+  /// that ask for possessive quantification or atomic groups are rejected
+  /// before code generation, so these only come from auto-possessification,
+  /// which doesn't change whether a regex matches.
+  static func canSimulate(
+    _ instructions: InstructionList<Instruction>,
+    registers: Processor.Registers
+  ) -> Bool {
+    for pc in instructions.indices {
+      let (opcode, payload) = instructions[pc].destructure
+      switch opcode {
+      case .branch, .save, .splitSaving, .condBranchSamePosition,
+          .moveCurrentPosition, .beginCapture, .endCapture,
+          .match, .matchScalar, .matchBitset, .matchBuiltin,
+          .matchAnyNonNewline, .matchLiteralTrie, .quantify, .assertBy,
+          .accept, .fail:
+        continue
+      case .matchUTF8:
+        let (reg, _, isCaseInsensitive) = payload.matchUTF8Payload
+        guard !registers[reg].isEmpty else {
+          return false
+        }
+        // Case-insensitive literals are matched a byte at a time, so can't
+        // include `k` or `s`, which the multi-byte KELVIN SIGN and LONG S
+        // also match.
+        if isCaseInsensitive && registers[reg].contains(where: {
+          $0 == UInt8(ascii: "k") || $0 == UInt8(ascii: "s")
+        }) {
+          return false
+        }
+      case .advance:
+        guard payload.distance.1.rawValue > 0 else { return false }
+      case .saveAddress:
+        guard instructions[payload.addr].opcode == .fail else { return false }
+      case .clear:
+        guard pc + 1 < instructions.endIndex,
+              instructions[pc + 1].opcode == .splitSaving
+        else { return false }
+      default:
+        return false
+      }
+    }
+    return true
+  }
+}
+
+extension LazyDFA {
+  /// Returns whether the program matches, beginning at the processor's
+  /// current position or, in `.search` mode, at a later position.
+  ///
+  /// The processor is used to evaluate assertions, and its position is
+  /// restored before returning.
+  mutating func matchExists(_ cpu: inout Processor) -> Bool {
+    let input = cpu.input
+    let start = cpu.currentPosition
+    let end = cpu.end
+    let matchesWholeString = cpu.matchMode == .wholeString
+    defer { cpu.currentPosition = start }
+
+    if startThreads == nil {
+      startThreads = closure(of: [Self.thread(InstructionAddress(0))])
+    }
+
+    // The last position at which the start threads were added, in `.search`
+    // mode.
+    var lastStart: String.Index? = mode == .search ? start : nil
+    // Threads that have consumed past `position`, in order of the position
+    // they've reached.
+    var pending: [(position: String.Index, threads: [Thread])] = []
+    var position = start
+    var state = intern(startThreads!)
+
+    while true {
+      cpu.currentPosition = position
+      let current = expand(state, &cpu)
+      if states[current].accepts && (!matchesWholeString || position == end) {
+        return true
+      }
+      if lastStart == nil && pending.isEmpty
+          && states[current].consumers.isEmpty {
+        return false
+      }
+
+      if position < end {
+        // Fast path: all threads are at a standalone ASCII byte, so the
+        // transition can come from the cache.
+        if pending.isEmpty && states[current].isByteLocal
+            && (lastStart == nil || lastStart == position),
+           let byte = input._standaloneASCIIByte(at: position) {
+          state = transition(
+            from: current, on: byte, at: position, in: input, limitedBy: end)
+          position = input.utf8.index(after: position)
+          if lastStart != nil {
+            lastStart = position
+          }
+          continue
+        }
+
+        for t in states[current].consumers {
+          if let advanced = step(t, at: position, in: input, limitedBy: end) {
+            Self.enqueue(advanced.successor, at: advanced.next, into: &pending)
+          }
+        }
+      }
+
+      // Move to the next position that either has threads waiting or is
+      // a position where the backtracking search would start over.
+      var nextStart: String.Index? = nil
+      if let s = lastStart, s < end {
+        let i = isScalarSemantics
+          ? input.unicodeScalars.index(after: s)
+          : input.index(after: s)
+        if i <= end {
+          nextStart = i
+        }
+      }
+      let nextPending = pending.first?.position
+      let next: String.Index
+      switch (nextPending, nextStart) {
+      case let (p?, s?): next = Swift.min(p, s)
+      case let (p?, nil): next = p
+      case let (nil, s?): next = s
+      case (nil, nil): return false
+      }
+
+      var threads: [Thread] = []
+      if nextPending == next {
+        threads = closure(of: pending.removeFirst().threads)
+      }
+      if nextStart == next {
+        threads = Self.sortedUnion(threads, startThreads!)
+        lastStart = next
+      }
+      state = intern(threads)
+      position = next
+    }
+  }
+}
+
+extension LazyDFA {
+  private static func thread(
+    _ pc: InstructionAddress,
+    _ counter: UInt64 = 0
+  ) -> Thread {
+    UInt64(truncatingIfNeeded: pc.rawValue) &<< 32 | counter
+  }
+
+  private static func pc(_ t: Thread) -> InstructionAddress {
+    InstructionAddress(Int(truncatingIfNeeded: t &>> 32))
+  }
+
+  private static func counter(_ t: Thread) -> UInt64 {
+    t & 0xFFFF_FFFF
+  }
+
+  private static func sortedUnion(_ a: [Thread], _ b: [Thread]) -> [Thread] {
+    var result = a + b
+    result.sort()
+    return result.isEmpty ? result : Self.removingAdjacentDuplicates(result)
+  }
+
+  private static func removingAdjacentDuplicates(
+    _ sorted: [Thread]
+  ) -> [Thread] {
+    var result: [Thread] = []
+    result.reserveCapacity(sorted.count)
+    for t in sorted where result.last != t {
+      result.append(t)
+    }
+    return result
+  }
+
+  private static func enqueue(
+    _ t: Thread,
+    at position: String.Index,
+    into pending: inout [(position: String.Index, threads: [Thread])]
+  ) {
+    var i = 0
+    while i < pending.count && pending[i].position < position {
+      i += 1
+    }
+    if i < pending.count && pending[i].position == position {
+      pending[i].threads.append(t)
+    } else {
+      pending.insert((position, [t]), at: i)
+    }
+  }
+
+  /// Returns the threads reachable from `seeds` without consuming input,
+  /// each stopped at a consuming instruction, an assertion, or `accept`, in
+  /// sorted order.
+  private mutating func closure(of seeds: [Thread]) -> [Thread] {
+    var result: [Thread] = []
+    visited.removeAll(keepingCapacity: true)
+    stack.removeAll(keepingCapacity: true)
+    stack.append(contentsOf: seeds)
+
+    while let t = stack.popLast() {
+      guard visited.insert(t).inserted else { continue }
+      let pc = Self.pc(t)
+      let (opcode, payload) = instructions[pc].destructure
+      switch opcode {
+      case .branch:
+        stack.append(Self.thread(payload.addr))
+      case .save:
+        stack.append(Self.thread(pc + 1))
+        stack.append(Self.thread(payload.addr))
+      case .splitSaving:
+        let (nextPC, resumeAddr) = payload.pairedAddrAddr
+        stack.append(Self.thread(nextPC))
+        stack.append(Self.thread(resumeAddr))
+      case .condBranchSamePosition:
+        // This only exits loops whose body matched nothing, so following
+        // both branches reaches the same states.
+        stack.append(Self.thread(payload.pairedAddrPos.0))
+        stack.append(Self.thread(pc + 1))
+      case .saveAddress, .clear, .moveCurrentPosition,
+          .beginCapture, .endCapture:
+        stack.append(Self.thread(pc + 1))
+      case .quantify:
+        let quantify = payload.quantify
+        let trips = Self.counter(t)
+        if trips >= quantify.minTrips {
+          stack.append(Self.thread(pc + 1))
+        }
+        if trips < quantify.maxTrips {
+          result.append(t)
+        }
+      case .matchLiteralTrie:
+        let trie = registers[payload.literalTrie]
+        let counter = Self.counter(t)
+        let node = Int(counter & ~Self.missedBoundaryFlag)
+        if counter & Self.missedBoundaryFlag == 0,
+           trie.literalIndex(at: node) != nil {
+          stack.append(Self.thread(pc + 1))
+        }
+        if trie.hasChildren(node) {
+          result.append(t)
+        }
+      case .fail:
+        break
+      default:
+        result.append(t)
+      }
+    }
+
+    result.sort()
+    return result
+  }
+
+  /// Returns the ID of the state made up of `threads`, adding it to the
+  /// cache if needed.
+  private mutating func intern(_ threads: [Thread]) -> Int {
+    if let id = stateIDs[threads] {
+      return id
+    }
+    if states.count >= Self.maxCachedStates {
+      states.removeAll(keepingCapacity: true)
+      stateIDs.removeAll(keepingCapacity: true)
+      generation &+= 1
+    }
+
+    var state = State(threads: threads)
+    for t in threads {
+      let (opcode, payload) = instructions[Self.pc(t)].destructure
+      switch opcode {
+      case .assertBy:
+        state.assertions.append(t)
+      case .accept:
+        state.accepts = true
+      case .advance:
+        state.consumers.append(t)
+        if payload.distance.1.rawValue != 1 {
+          state.isByteLocal = false
+        }
+      default:
+        state.consumers.append(t)
+      }
+    }
+
+    let id = states.count
+    states.append(state)
+    stateIDs[threads] = id
+    return id
+  }
+
+  private func holds(_ t: Thread, _ cpu: inout Processor) -> Bool {
+    let payload = instructions[Self.pc(t)].payload.assertion
+    return (try? cpu.builtinAssert(by: payload)) ?? false
+  }
+
+  /// Returns the ID of the state reached by evaluating the assertions of
+  /// state `id` at the processor's current position, which has no
+  /// assertions left.
+  private mutating func expand(_ id: Int, _ cpu: inout Processor) -> Int {
+    let assertions = states[id].assertions
+    guard !assertions.isEmpty else { return id }
+
+    var isCacheable = assertions.count <= 64
+    var outcomes: UInt64 = 0
+    if isCacheable {
+      for (i, t) in assertions.enumerated() {
+        if holds(t, &cpu) {
+          outcomes |= 1 &<< UInt64(i)
+        }
+      }
+      if let cached = states[id].expansions[outcomes] {
+        return cached
+      }
+    }
+
+    var threads = states[id].threads.filter {
+      instructions[Self.pc($0)].opcode != .assertBy
+    }
+    var passed: [Thread] = []
+    for (i, t) in assertions.enumerated() {
+      let isPassed = isCacheable
+        ? outcomes & (1 &<< UInt64(i)) != 0
+        : holds(t, &cpu)
+      if isPassed {
+        passed.append(Self.thread(Self.pc(t) + 1))
+      }
+    }
+
+    // Threads that pass an assertion can reach more assertions, which have
+    // to be evaluated here too. Their outcomes aren't part of the cache key.
+    var checked = Set(assertions)
+    while !passed.isEmpty {
+      let reached = closure(of: passed)
+      passed.removeAll()
+      for t in reached {
+        guard instructions[Self.pc(t)].opcode == .assertBy else {
+          threads.append(t)
+          continue
+        }
+        guard checked.insert(t).inserted else { continue }
+        isCacheable = false
+        if holds(t, &cpu) {
+          passed.append(Self.thread(Self.pc(t) + 1))
+        }
+      }
+    }
+    threads.sort()
+    threads = Self.removingAdjacentDuplicates(threads)
+
+    let generation = self.generation
+    let expanded = intern(threads)
+    if isCacheable && generation == self.generation {
+      states[id].expansions[outcomes] = expanded
+    }
+    return expanded
+  }
+
+  /// Returns the ID of the state reached by consuming the standalone ASCII
+  /// byte at `position` from state `id`.
+  private mutating func transition(
+    from id: Int,
+    on byte: UInt8,
+    at position: String.Index,
+    in input: String,
+    limitedBy end: String.Index
+  ) -> Int {
+    if states[id].transitions.isEmpty {
+      states[id].transitions = Array(repeating: -1, count: 128)
+    }
+    let cached = states[id].transitions[Int(byte)]
+    if cached >= 0 {
+      return Int(cached)
+    }
+
+    var successors: [Thread] = []
+    for t in states[id].consumers {
+      if let advanced = step(t, at: position, in: input, limitedBy: end) {
+        assert(advanced.next == input.utf8.index(after: position))
+        successors.append(advanced.successor)
+      }
+    }
+    var threads = closure(of: successors)
+    if mode == .search {
+      threads = Self.sortedUnion(threads, startThreads!)
+    }
+
+    let generation = self.generation
+    let target = intern(threads)
+    if generation == self.generation {
+      states[id].transitions[Int(byte)] = Int32(truncatingIfNeeded: target)
+    }
+    return target
+  }
+
+  /// Runs the consuming instruction that thread `t` is stopped at, returning
+  /// the position after the consumed input and the thread that continues
+  /// from there, or `nil` if the instruction doesn't match.
+  private func step(
+    _ t: Thread,
+    at position: String.Index,
+    in input: String,
+    limitedBy end: String.Index
+  ) -> (next: String.Index, successor: Thread)? {
+    let pc = Self.pc(t)
+    let (opcode, payload) = instructions[pc].destructure
+    let next: String.Index?
+    switch opcode {
+    case .match:
+      let (isCaseInsensitive, reg) = payload.elementPayload
+      next = input.match(
+        registers[reg],
+        at: position,
+        limitedBy: end,
+        isCaseInsensitive: isCaseInsensitive)
+
+    case .matchScalar:
+      let (scalar, caseInsensitive, boundaryCheck) = payload.scalarPayload
+      next = input.matchScalar(
+        scalar,
+        at: position,
+        limitedBy: end,
+        boundaryCheck: boundaryCheck,
+        isCaseInsensitive: caseInsensitive)
+
+    case .matchUTF8:
+      // Literals are matched a byte at a time, so that each byte can be
+      // a cached transition.
+      let (reg, boundaryCheck, isCaseInsensitive) = payload.matchUTF8Payload
+      let bytes = registers[reg]
+      let offset = Int(Self.counter(t))
+      guard position < end else { return nil }
+      let byte = input.utf8[position]
+      guard byte == bytes[offset]
+              || isCaseInsensitive && byte._asciiLowercased == bytes[offset]
+      else {
+        return nil
+      }
+      let after = input.utf8.index(after: position)
+      if offset + 1 < bytes.count {
+        return (after, t + 1)
+      }
+      if boundaryCheck && !input.isOnGraphemeClusterBoundary(after) {
+        return nil
+      }
+      return (after, Self.thread(pc + 1))
+
+    case .matchLiteralTrie:
+      // Like `matchUTF8`, the trie is walked a unit at a time. The threads
+      // that leave the trie are forked in `closure(of:)`.
+      let trie = registers[payload.literalTrie]
+      let node = Int(Self.counter(t) & ~Self.missedBoundaryFlag)
+      guard let (byte, after) = input.literalTrieUnit(
+              trie, at: position, limitedBy: end),
+            let child = trie.child(of: node, byte)
+      else {
+        return nil
+      }
+      var counter = UInt64(child)
+      if trie.boundaryCheck && trie.literalIndex(at: child) != nil
+          && !input.isOnGraphemeClusterBoundary(after) {
+        counter |= Self.missedBoundaryFlag
+      }
+      return (after, Self.thread(pc, counter))
+
+    case .matchBitset:
+      let (isScalar, reg) = payload.bitsetPayload
+      next = input.matchASCIIBitset(
+        registers[reg],
+        at: position,
+        limitedBy: end,
+        isScalarSemantics: isScalar)
+
+    case .matchBuiltin:
+      let payload = payload.characterClassPayload
+      next = input.matchBuiltinCC(
+        payload.cc,
+        at: position,
+        limitedBy: end,
+        isInverted: payload.isInverted,
+        isStrictASCII: payload.isStrictASCII,
+        isScalarSemantics: payload.isScalarSemantics)
+
+    case .matchAnyNonNewline:
+      next = input.matchAnyNonNewline(
+        at: position,
+        limitedBy: end,
+        isScalarSemantics: payload.isScalar)
+
+    case .advance:
+      let (isScalar, distance) = payload.distance
+      if isScalar {
+        next = input.unicodeScalars.index(
+          position, offsetBy: distance.rawValue, limitedBy: end)
+      } else if let i = input.index(
+        position, offsetBy: distance.rawValue, limitedBy: end
+      ) {
+        next = i
+      } else if distance.rawValue == 1 {
+        // Mirrors `Processor.consume(_:)` when `end` falls in the middle of
+        // a character.
+        next = input.unicodeScalars.index(
+          position, offsetBy: 1, limitedBy: end)
+      } else {
+        next = nil
+      }
+
+    case .quantify:
+      // A single trip of the quantification.
+      let quantify = payload.quantify
+      let isScalarSemantics = quantify.isScalarSemantics
+      let tripEnd: String.Index?
+      switch quantify.type {
+      case .asciiBitset:
+        tripEnd = input.matchASCIIBitset(
+          registers[quantify.bitset],
+          at: position,
+          limitedBy: end,
+          isScalarSemantics: isScalarSemantics)
+      case .asciiChar:
+        tripEnd = input.matchScalar(
+          Unicode.Scalar(quantify.asciiChar),
+          at: position,
+          limitedBy: end,
+          boundaryCheck: !isScalarSemantics,
+          isCaseInsensitive: false)
+      case .any:
+        tripEnd = input.matchRegexDot(
+          at: position,
+          limitedBy: end,
+          anyMatchesNewline: quantify.anyMatchesNewline,
+          isScalarSemantics: isScalarSemantics)
+      case .builtinCC:
+        tripEnd = input.matchBuiltinCC(
+          quantify.builtinCC,
+          at: position,
+          limitedBy: end,
+          isInverted: quantify.builtinIsInverted,
+          isStrictASCII: quantify.builtinIsStrict,
+          isScalarSemantics: isScalarSemantics)
+      case .scalarRun:
+        tripEnd = input.matchScalarRun(
+          registers[quantify.scalarRun],
+          at: position,
+          limitedBy: end,
+          isScalarSemantics: isScalarSemantics)
+      }
+      guard let tripEnd else { return nil }
+
+      // Past the minimum, further trips of an unbounded quantification are
+      // indistinguishable, so the count stops there.
+      var trips = Self.counter(t) + 1
+      if quantify.maxExtraTrips == nil {
+        trips = Swift.min(trips, quantify.minTrips)
+      }
+      return (tripEnd, Self.thread(pc, trips))
+
+    default:
+      fatalError("Unreachable: not a consuming instruction")
+    }
+    return next.map { ($0, Self.thread(pc + 1)) }
+  }
+}
+
+extension String {
+  /// Returns the byte at `i` if it's an ASCII character that forms a
+  /// grapheme cluster on its own, so that matching a character or scalar
+  /// there only depends on that byte.
+  fileprivate func _standaloneASCIIByte(at i: Index) -> UInt8? {
+    let byte = utf8[i]
+    guard byte < 0x80 else { return nil }
+
+    let next = utf8.index(after: i)
+    if next < utf8.endIndex {
+      let nextByte = utf8[next]
+      guard nextByte < 0x80,
+            !(byte == ._carriageReturn && nextByte == ._lineFeed)
+      else { return nil }
+    }
+    if i > utf8.startIndex {
+      let previousByte = utf8[utf8.index(before: i)]
+      guard previousByte < 0x80,
+            !(previousByte == ._carriageReturn && byte == ._lineFeed)
+      else { return nil }
+    }
+    return byte
+  }
+}
@@ -0,0 +1,171 @@
+//===----------------------------------------------------------------------===//
+//
+// This source file is part of the Swift.org open source project
+//
+// Copyright (c) 2025 Apple Inc. and the Swift project authors
+// Licensed under Apache License v2.0 with Runtime Library Exception
+//
+// See https://swift.org/LICENSE.txt for license information
+//
+//===----------------------------------------------------------------------===//
+
+/// A trie over the UTF-8 of an alternation of literals, such as
+/// `GET|POST|PUT|DELETE`, which finds every alternative that matches at a
+/// position in a single pass over the input.
+///
+/// An alternation emitted as save points tries each alternative in turn,
+/// taking time proportional to the number of alternatives. The trie follows
+/// one path, whose length is bounded by the longest literal, and records the
+/// alternatives that end along the way. `Processor` continues with the first
+/// of them in alternative order, and pushes save points for the rest, so
+/// backtracking sees the same matches as the alternation would produce.
+struct LiteralTrie {
+  /// The literals the trie was built from, in alternative order.
+  let literals: [[UInt8]]
+
+  /// Whether letters match case-insensitively. Case-insensitive literals
+  /// are ASCII, and are stored lowercased.
+  let isCaseInsensitive: Bool
+
+  /// Whether a non-empty match must end on a grapheme cluster boundary.
+  let boundaryCheck: Bool
+
+  // The edges of node `n` are at `edgeStarts[n]..<edgeStarts[n + 1]` in
+  // `edgeBytes` and `edgeTargets`, sorted by byte. The root is node 0.
+  private var edgeStarts: [Int32] = [0]
+  private var edgeBytes: [UInt8] = []
+  private var edgeTargets: [Int32] = []
+
+  /// For each node, the index of the first literal that ends there, or `-1`.
+  private var literalIndices: [Int32] = []
+
+  /// The number of edges above which a node's edges are binary searched.
+  private static var linearSearchLimit: Int { 8 }
+
+  init(
+    _ literals: [[UInt8]],
+    isCaseInsensitive: Bool,
+    boundaryCheck: Bool
+  ) {
+    assert(!isCaseInsensitive || literals.allSatisfy {
+      $0.allSatisfy(\._isASCII)
+    })
+    self.literals = literals
+    self.isCaseInsensitive = isCaseInsensitive
+    self.boundaryCheck = boundaryCheck
+
+    // Build the trie with a dictionary per node, then flatten it.
+    var children: [[UInt8: Int32]] = [[:]]
+    literalIndices = [-1]
+    for (i, literal) in literals.enumerated() {
+      var node = 0
+      for byte in literal {
+        let byte = isCaseInsensitive ? byte._asciiLowercased : byte
+        if let child = children[node][byte] {
+          node = Int(child)
+        } else {
+          children[node][byte] = Int32(children.count)
+          node = children.count
+          children.append([:])
+          literalIndices.append(-1)
+        }
+      }
+      // A repeated literal can only match where the first one did.
+      if literalIndices[node] < 0 {
+        literalIndices[node] = Int32(i)
+      }
+    }
+
+    for edges in children {
+      for (byte, target) in edges.sorted(by: { $0.key < $1.key }) {
+        edgeBytes.append(byte)
+        edgeTargets.append(target)
+      }
+      edgeStarts.append(Int32(edgeBytes.count))
+    }
+  }
+
+  static var root: Int { 0 }
+
+  /// Returns the node reached from `node` by `byte`, if any.
+  func child(of node: Int, _ byte: UInt8) -> Int? {
+    var lower = Int(edgeStarts[node])
+    var upper = Int(edgeStarts[node + 1])
+    while upper - lower > Self.linearSearchLimit {
+      let mid = lower + (upper - lower) / 2
+      if edgeBytes[mid] < byte {
+        lower = mid + 1
+      } else {
+        upper = mid + 1
+      }
+    }
+    for i in lower..<upper where edgeBytes[i] == byte {
+      return Int(edgeTargets[i])
+    }
+    return nil
+  }
+
+  /// Whether any literal continues past `node`.
+  func hasChildren(_ node: Int) -> Bool {
+    edgeStarts[node] != edgeStarts[node + 1]
+  }
+
+  /// The index of the first literal that ends at `node`, if any.
+  func literalIndex(at node: Int) -> Int? {
+    let i = literalIndices[node]
+    return i < 0 ? nil : Int(i)
+  }
+}
+
+extension String {
+  /// Returns the byte that `trie` reads for the input at `pos`, and the
+  /// position after the input it stands for.
+  ///
+  /// This is the byte at `pos`, unless the trie is case-insensitive. Then
+  /// ASCII letters are lowercased, and a non-ASCII scalar is read as its
+  /// simple case folding when that's ASCII (e.g. KELVIN SIGN reads as `k`),
+  /// matching `matchScalar`'s case-insensitive comparison.
+  func literalTrieUnit(
+    _ trie: LiteralTrie,
+    at pos: Index,
+    limitedBy end: Index
+  ) -> (byte: UInt8, next: Index)? {
+    guard pos < end else { return nil }
+    let byte = utf8[pos]
+    guard trie.isCaseInsensitive && !byte._isASCII else {
+      let byte = trie.isCaseInsensitive ? byte._asciiLowercased : byte
+      return (byte, utf8.index(after: pos))
+    }
+
+    let folded = unicodeScalars[pos].simpleCaseFolded
+    guard folded.isASCII else { return nil }
+    let next = unicodeScalars.index(after: pos)
+    assert(next <= end, "Input is a substring with a sub-scalar endIndex.")
+    return (UInt8(truncatingIfNeeded: folded.value), next)
+  }
+
+  /// Calls `body` with the index of each literal in `trie` that matches at
+  /// `pos` and the position after the match, from the shortest match to the
+  /// longest.
+  func forEachLiteralMatch(
+    in trie: LiteralTrie,
+    at pos: Index,
+    limitedBy end: Index,
+    _ body: (_ literal: Int, _ end: Index) -> Void
+  ) {
+    var node = LiteralTrie.root
+    var cur = pos
+    while true {
+      if let literal = trie.literalIndex(at: node),
+         !trie.boundaryCheck || cur == pos || isOnGraphemeClusterBoundary(cur) {
+        body(literal, cur)
+      }
+      guard trie.hasChildren(node),
+            let (byte, next) = literalTrieUnit(trie, at: cur, limitedBy: end),
+            let child = trie.child(of: node, byte)
+      else { return }
+      node = child
+      cur = next
+    }
+  }
+}
@@ -0,0 +1,160 @@
+//===----------------------------------------------------------------------===//
+//
+// This source file is part of the Swift.org open source project
+//
+// Copyright (c) 2025 Apple Inc. and the Swift project authors
+// Licensed under Apache License v2.0 with Runtime Library Exception
+//
+// See https://swift.org/LICENSE.txt for license information
+//
+//===----------------------------------------------------------------------===//
+
+// Backtracking can take time exponential in the length of the input, when
+// nested or overlapping quantifiers give many ways to reach the same
+// instruction at the same position. Once a search has taken more steps than
+// there are (instruction, position) pairs, the processor starts recording
+// the pairs it has visited at the instructions that backtracking resumes at
+// or loops back to. Reaching a recorded pair again means failing, since the
+// first visit's attempt already failed, so the rest of the search takes time
+// proportional to the size of the program times the length of the input.
+//
+// This only holds when nothing but the instruction and the position decides
+// how matching continues, so programs with counters, position registers,
+// backreferences, custom matchers, capture transforms, or instructions that
+// discard save points aren't memoized. The processor's step budget applies to every program.
+
+extension MEProgram {
+  /// Returns the row of the memoization table for each instruction, or `-1`
+  /// for instructions that aren't memoized, or `nil` if the program can't be
+  /// memoized.
+  static func memoizationRows(
+    _ instructions: InstructionList<Instruction>
+  ) -> [Int]? {
+    var isMemoized = Array(repeating: false, count: instructions.count)
+    for pc in instructions.indices {
+      let (opcode, payload) = instructions[pc].destructure
+      switch opcode {
+      case .branch, .save, .saveAddress:
+        isMemoized[payload.addr.rawValue] = true
+      case .splitSaving:
+        let (nextPC, resumeAddr) = payload.pairedAddrAddr
+        isMemoized[nextPC.rawValue] = true
+        isMemoized[resumeAddr.rawValue] = true
+      case .quantify, .matchLiteralTrie:
+        // Quantified and literal trie save points resume after the
+        // instruction.
+        if pc.rawValue + 1 < instructions.count {
+          isMemoized[pc.rawValue + 1] = true
+        }
+      case .moveImmediate, .moveCurrentPosition, .restorePosition,
+          .condBranchZeroElseDecrement, .condBranchSamePosition,
+          .clear, .clearThrough, .backreference, .matchBy, .captureValue,
+          .transformCapture:
+        return nil
+      default:
+        continue
+      }
+    }
+
+    var rowCount = 0
+    return isMemoized.map { isMemoized in
+      guard isMemoized else { return -1 }
+      defer { rowCount += 1 }
+      return rowCount
+    }
+  }
+}
+
+extension Processor {
+  /// The (instruction, position) pairs visited during a search.
+  struct Memo {
+    /// The position of the first column.
+    let base: Position
+    /// The number of columns, one for each UTF-8 offset in the search bounds.
+    let width: Int
+    var bits: [UInt64]
+
+    init(base: Position, width: Int, rowCount: Int) {
+      self.base = base
+      self.width = width
+      self.bits = Array(repeating: 0, count: (rowCount * width + 63) / 64)
+    }
+
+    /// Records the pair, returning `false` if it was already recorded.
+    mutating func insert(row: Int, offset: Int) -> Bool {
+      let bit = row * width + offset
+      let mask: UInt64 = 1 << (bit & 63)
+      guard bits[bit >> 6] & mask == 0 else { return false }
+      bits[bit >> 6] |= mask
+      return true
+    }
+  }
+
+  /// The number of steps between checks of the step budget.
+  static var stepCheckInterval: Int { 4096 }
+
+  /// The largest memoization table, in bits, that a search can allocate.
+  static var maxMemoSize: Int { 1 << 25 }
+
+  /// Returns whether the processor has reached the current instruction at
+  /// the current position before, recording it if not.
+  mutating func isMemoizedRevisit() -> Bool {
+    let row = memoRows![controller.pc.rawValue]
+    guard row >= 0 else { return false }
+    let offset = input.utf8.distance(from: memo!.base, to: currentPosition)
+    return !memo!.insert(row: row, offset: offset)
+  }
+
+  /// Thrown by a search that has used up the steps it had before its caller
+  /// checks whether there's a match at all.
+  struct ExistenceCheckRequested: Error {}
+
+  /// Accounts for the steps taken since the last check, aborting if the step
+  /// limit is reached or an existence check is due, and turning on
+  /// memoization if the search has taken long enough to need it.
+  mutating func checkStepBudget() {
+    stepsTaken += stepsBeforeCheck
+
+    if let limit = stepLimit, stepsTaken >= limit {
+      // A step limit can only be set through API that's available
+      // wherever the error is.
+      guard #available(SwiftStdlib 6.1, *) else {
+        fatalError("Step limit set without matchingStepLimit(_:)")
+      }
+      abort(RegexStepLimitExceeded(limit: limit))
+      return
+    }
+
+    if let budget = existenceCheckSteps, stepsTaken >= budget {
+      // The caller retries the attempt from its start, so the memo can't
+      // keep the states that the attempt had only begun to explore.
+      existenceCheckSteps = nil
+      memo = nil
+      abort(ExistenceCheckRequested())
+    } else if memo == nil, let rows = memoRows, input.isContiguousUTF8 {
+      let rowCount = rows.reduce(0) { $1 >= 0 ? $0 + 1 : $0 }
+      let width = input.utf8.distance(
+        from: searchBounds.lowerBound, to: searchBounds.upperBound) + 1
+      let (size, overflow) = rowCount.multipliedReportingOverflow(by: width)
+      if !overflow, size <= Self.maxMemoSize, stepsTaken >= size {
+        memo = Memo(
+          base: searchBounds.lowerBound, width: width, rowCount: rowCount)
+      }
+    }
+
+    stepsBeforeCheck = Self.stepCheckInterval
+    if let limit = stepLimit {
+      stepsBeforeCheck = min(stepsBeforeCheck, limit - stepsTaken)
+    }
+    stepsUntilCheck = stepsBeforeCheck
+  }
+
+  /// Starts counting steps for a new search.
+  mutating func resetStepBudget() {
+    stepsTaken = 0
+    memo = nil
+    existenceCheckSteps = nil
+    stepsBeforeCheck = min(Self.stepCheckInterval, stepLimit ?? .max)
+    stepsUntilCheck = stepsBeforeCheck
+  }
+}
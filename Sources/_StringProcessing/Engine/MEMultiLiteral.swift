@@ -0,0 +1,143 @@
+//===----------------------------------------------------------------------===//
+//
+// This source file is part of the Swift.org open source project
+//
+// Copyright (c) 2025 Apple Inc. and the Swift project authors
+// Licensed under Apache License v2.0 with Runtime Library Exception
+//
+// See https://swift.org/LICENSE.txt for license information
+//
+//===----------------------------------------------------------------------===//
+
+/// An Aho-Corasick automaton that finds which of a set of UTF-8 literals
+/// occur in an input, in a single pass over its bytes.
+///
+/// The automaton is compiled to a dense transition table. Bytes that don't
+/// appear in any literal all behave the same, so the table has one column
+/// per distinct literal byte plus one shared column for every other byte.
+struct MultiLiteralSearcher {
+  /// The literals being searched for. Each must be non-empty.
+  let literals: [[UInt8]]
+
+  /// The column of the transition table for each byte value.
+  private var byteClasses: [UInt8]
+  private var classCount: Int
+
+  /// `transitions[state * classCount + class]` is the state reached by
+  /// consuming a byte of `class` in `state`. State 0 is the root.
+  private var transitions: [Int32]
+
+  /// The literals recognized on entering each state, including literals
+  /// that end in a suffix of the state's string.
+  private var outputs: [[Int]]
+
+  init(_ literals: [[UInt8]]) {
+    assert(literals.allSatisfy { !$0.isEmpty })
+    self.literals = literals
+
+    var byteClasses = [UInt8](repeating: 0, count: 256)
+    var classCount = 1
+    for literal in literals {
+      for byte in literal where byteClasses[Int(byte)] == 0 {
+        byteClasses[Int(byte)] = UInt8(truncatingIfNeeded: classCount)
+        classCount += 1
+      }
+    }
+    // Every byte value can be distinct, so fall back to identity classes
+    // before the column index overflows.
+    if classCount > 256 {
+      for i in 0..<256 {
+        byteClasses[i] = UInt8(i)
+      }
+      classCount = 256
+    }
+    self.byteClasses = byteClasses
+    self.classCount = classCount
+
+    // Build the trie, with -1 for a missing edge.
+    var goto: [Int32] = Array(repeating: -1, count: classCount)
+    var outputs: [[Int]] = [[]]
+    for (index, literal) in literals.enumerated() {
+      var state = 0
+      for byte in literal {
+        let slot = state * classCount + Int(byteClasses[Int(byte)])
+        if goto[slot] < 0 {
+          goto[slot] = Int32(outputs.count)
+          goto.append(contentsOf: repeatElement(-1, count: classCount))
+          outputs.append([])
+        }
+        state = Int(goto[slot])
+      }
+      outputs[state].append(index)
+    }
+
+    // Fill in the missing edges breadth-first from the failure links, which
+    // turns the trie into a DFA.
+    var failure = [Int](repeating: 0, count: outputs.count)
+    var queue: [Int] = []
+    for c in 0..<classCount {
+      if goto[c] < 0 {
+        goto[c] = 0
+      } else {
+        queue.append(Int(goto[c]))
+      }
+    }
+    var head = 0
+    while head < queue.count {
+      let state = queue[head]
+      head += 1
+      outputs[state].append(contentsOf: outputs[failure[state]])
+      for c in 0..<classCount {
+        let slot = state * classCount + c
+        let fallback = goto[failure[state] * classCount + c]
+        if goto[slot] < 0 {
+          goto[slot] = fallback
+        } else {
+          let next = Int(goto[slot])
+          failure[next] = Int(fallback)
+          queue.append(next)
+        }
+      }
+    }
+    self.transitions = goto
+    self.outputs = outputs
+  }
+}
+
+extension MultiLiteralSearcher {
+  /// Calls `found` with the index of each literal that occurs within
+  /// `range` of `input`, in no particular order and possibly more than once.
+  ///
+  /// Stops early if `found` returns `false`.
+  func forEachLiteral(
+    in input: String,
+    _ range: Range<String.Index>,
+    _ found: (Int) -> Bool
+  ) {
+    let scanned: Void? = input.utf8.withContiguousStorageIfAvailable { bytes in
+      let lower = input.utf8.distance(
+        from: input.startIndex, to: range.lowerBound)
+      let upper = input.utf8.distance(
+        from: input.startIndex, to: range.upperBound)
+      _scan(bytes[lower..<upper], found)
+    }
+    if scanned == nil {
+      // Non-contiguous (e.g. bridged) strings fall back to the UTF-8 view.
+      _scan(input.utf8[range], found)
+    }
+  }
+
+  private func _scan<Bytes: Sequence>(
+    _ bytes: Bytes,
+    _ found: (Int) -> Bool
+  ) where Bytes.Element == UInt8 {
+    var state = 0
+    for byte in bytes {
+      let c = Int(byteClasses[Int(byte)])
+      state = Int(transitions[state &* classCount &+ c])
+      for index in outputs[state] {
+        guard found(index) else { return }
+      }
+    }
+  }
+}
@@ -0,0 +1,246 @@
+//===----------------------------------------------------------------------===//
+//
+// This source file is part of the Swift.org open source project
+//
+// Copyright (c) 2025 Apple Inc. and the Swift project authors
+// Licensed under Apache License v2.0 with Runtime Library Exception
+//
+// See https://swift.org/LICENSE.txt for license information
+//
+//===----------------------------------------------------------------------===//
+
+extension MEProgram {
+  /// Byte-level facts about every match of a program, used to rule out start
+  /// positions before spinning up the backtracking engine.
+  struct Prefilter {
+    /// The UTF-8 bytes that every match begins with, possibly empty.
+    var prefix: [UInt8]
+
+    /// The longest run of UTF-8 bytes that every match contains, possibly
+    /// empty.
+    var requiredLiteral: [UInt8]
+
+    /// The ASCII bytes that a match can begin with. Only computed when
+    /// `prefix` is empty.
+    var leadingBytes: DSLTree.CustomCharacterClass.AsciiBitset?
+
+    /// Whether `prefix` and `requiredLiteral` are lowercased, and match input
+    /// bytes regardless of ASCII case.
+    var isCaseInsensitive = false
+  }
+}
+
+extension MEProgram.Prefilter {
+  /// Whether `nextCandidate(in:_:isScalarSemantics:)` can move the start
+  /// position forward.
+  var canSkipAhead: Bool {
+    !prefix.isEmpty || leadingBytes != nil
+  }
+
+  /// Returns whether the required literal appears within `range` of `input`.
+  func requiredLiteralExists(
+    in input: String,
+    _ range: Range<String.Index>
+  ) -> Bool {
+    requiredLiteral.isEmpty
+      || input._firstIndex(
+        ofUTF8: requiredLiteral, in: range,
+        isCaseInsensitive: isCaseInsensitive) != nil
+  }
+
+  /// Returns the first position in `range` at which a match could begin, or
+  /// `nil` if no match can begin within `range`.
+  ///
+  /// `range.lowerBound` must be a position reachable by the caller's
+  /// character- or scalar-wise advancement; the returned position is too.
+  func nextCandidate(
+    in input: String,
+    _ range: Range<String.Index>,
+    isScalarSemantics: Bool
+  ) -> String.Index? {
+    var low = range.lowerBound
+    while true {
+      let candidate: String.Index
+      if !prefix.isEmpty {
+        guard let i = input._firstIndex(
+          ofUTF8: prefix, in: low..<range.upperBound,
+          isCaseInsensitive: isCaseInsensitive)
+        else { return nil }
+        candidate = i
+      } else if let leadingBytes {
+        guard let i = input._firstIndex(
+          ofByteIn: leadingBytes, in: low..<range.upperBound)
+        else { return nil }
+        candidate = i
+      } else {
+        return low
+      }
+
+      // Every candidate begins with a non-continuation byte, so it is always
+      // scalar-aligned, but can fall in the middle of a grapheme cluster
+      // (e.g. after a prepended concatenation mark).
+      if isScalarSemantics || input.isOnGraphemeClusterBoundary(candidate) {
+        return candidate
+      }
+      low = input.utf8.index(after: candidate)
+    }
+  }
+}
+
+extension String {
+  /// Returns the position of the first occurrence of `bytes` in this
+  /// string's UTF-8 view that lies entirely within `range`.
+  ///
+  /// If `isCaseInsensitive` is `true`, `bytes` must be lowercased, and match
+  /// ASCII bytes of either case.
+  func _firstIndex(
+    ofUTF8 bytes: [UInt8],
+    in range: Range<Index>,
+    isCaseInsensitive: Bool = false
+  ) -> Index? {
+    assert(!bytes.isEmpty)
+    let found: Int?? = utf8.withContiguousStorageIfAvailable { haystack in
+      let lower = utf8.distance(from: startIndex, to: range.lowerBound)
+      let upper = utf8.distance(from: startIndex, to: range.upperBound)
+      return bytes.withUnsafeBufferPointer { needle in
+        isCaseInsensitive
+          ? _firstCaseInsensitiveOffset(
+            of: needle, in: haystack, from: lower, to: upper)
+          : _firstOffset(of: needle, in: haystack, from: lower, to: upper)
+      }
+    }
+    if let found {
+      return found.map { utf8.index(startIndex, offsetBy: $0) }
+    }
+
+    // Non-contiguous (e.g. bridged) strings fall back to the UTF-8 view.
+    var i = range.lowerBound
+    while i < range.upperBound {
+      if matchUTF8(
+        bytes, at: i, limitedBy: range.upperBound, boundaryCheck: false,
+        isCaseInsensitive: isCaseInsensitive
+      ) != nil {
+        return i
+      }
+      utf8.formIndex(after: &i)
+    }
+    return nil
+  }
+
+  /// Returns the position of the first byte within `range` of this string's
+  /// UTF-8 view that is a member of `bitset`.
+  func _firstIndex(
+    ofByteIn bitset: DSLTree.CustomCharacterClass.AsciiBitset,
+    in range: Range<Index>
+  ) -> Index? {
+    assert(!bitset.isInverted)
+    let found: Int?? = utf8.withContiguousStorageIfAvailable { haystack in
+      let lower = utf8.distance(from: startIndex, to: range.lowerBound)
+      let upper = utf8.distance(from: startIndex, to: range.upperBound)
+      var i = lower
+      while i < upper {
+        if bitset.matches(haystack[i]) {
+          return i
+        }
+        i &+= 1
+      }
+      return nil
+    }
+    if let found {
+      return found.map { utf8.index(startIndex, offsetBy: $0) }
+    }
+
+    return utf8[range].firstIndex(where: bitset.matches(_:))
+  }
+}
+
+/// Returns the offset of the first occurrence of `needle` that lies entirely
+/// within `haystack[start..<end]`.
+private func _firstOffset(
+  of needle: UnsafeBufferPointer<UInt8>,
+  in haystack: UnsafeBufferPointer<UInt8>,
+  from start: Int,
+  to end: Int
+) -> Int? {
+  let lastStart = end - needle.count
+  var i = start
+  while i <= lastStart {
+    guard let j = _firstOffset(
+      of: needle[0], in: haystack, from: i, to: lastStart + 1)
+    else { return nil }
+
+    var k = 1
+    while k < needle.count && haystack[j &+ k] == needle[k] {
+      k &+= 1
+    }
+    if k == needle.count {
+      return j
+    }
+    i = j + 1
+  }
+  return nil
+}
+
+/// Returns the offset of the first occurrence of the lowercased `needle`,
+/// ignoring ASCII case, that lies entirely within `haystack[start..<end]`.
+///
+/// Unlike `matchUTF8(_:at:limitedBy:boundaryCheck:isCaseInsensitive:)`, this
+/// doesn't match KELVIN SIGN or LONG S, which the prefilter never includes.
+private func _firstCaseInsensitiveOffset(
+  of needle: UnsafeBufferPointer<UInt8>,
+  in haystack: UnsafeBufferPointer<UInt8>,
+  from start: Int,
+  to end: Int
+) -> Int? {
+  let first = needle[0]
+  let lastStart = end - needle.count
+  var i = start
+  while i <= lastStart {
+    if haystack[i]._asciiLowercased == first {
+      var k = 1
+      while k < needle.count
+              && haystack[i &+ k]._asciiLowercased == needle[k] {
+        k &+= 1
+      }
+      if k == needle.count {
+        return i
+      }
+    }
+    i &+= 1
+  }
+  return nil
+}
+
+/// Returns the offset of the first occurrence of `byte` in
+/// `haystack[start..<end]`.
+///
+/// Scans a word at a time, using the usual "has zero byte" bit trick on the
+/// word XOR'd with `byte` in every lane to skip words that can't contain it.
+private func _firstOffset(
+  of byte: UInt8,
+  in haystack: UnsafeBufferPointer<UInt8>,
+  from start: Int,
+  to end: Int
+) -> Int? {
+  guard start < end, let base = haystack.baseAddress else { return nil }
+  let lows: UInt64 = 0x0101_0101_0101_0101
+  let highs: UInt64 = 0x8080_8080_8080_8080
+  let splat = UInt64(byte) &* lows
+
+  var i = start
+  let raw = UnsafeRawPointer(base)
+  while i &+ 8 <= end {
+    let word = raw.loadUnaligned(fromByteOffset: i, as: UInt64.self) ^ splat
+    if (word &- lows) & ~word & highs != 0 {
+      break
+    }
+    i &+= 8
+  }
+  while i < end {
+    if base[i] == byte {
+      return i
+    }
+    i &+= 1
+  }
+  return nil
+}
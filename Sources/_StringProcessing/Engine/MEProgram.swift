@@ -31,6 +31,30 @@ struct MEProgram {
   
   var initialOptions: MatchingOptions
   var canOnlyMatchAtStart: Bool
+  var prefilter: Prefilter?
+  var canUseLazyDFA: Bool
+
+  /// The lazy DFAs that searches with this program share, if it can use
+  /// them.
+  var lazyDFAs: LazyDFACache? = nil
+
+  /// The memoization row of each instruction, or `nil` if the program can't
+  /// be memoized.
+  var memoRows: [Int]?
+
+  /// The location in the pattern that each instruction was compiled from,
+  /// if recorded for profiling.
+  var instructionLocations: [SourceLocation?]? = nil
+
+  /// The profile that searches with this program record their steps in.
+  var profile: ProfileRecorder? = nil
+
+  /// The number of steps after which a search throws
+  /// `RegexStepLimitExceeded`, if any.
+  var stepLimit: Int? = nil
+
+  /// The program lowered to closures, if it was compiled to run that way.
+  var threadedCode: ThreadedCode? = nil
 
   // We store the initial register state in the program, so that
   // processors can be spun up quicker (useful for running same regex
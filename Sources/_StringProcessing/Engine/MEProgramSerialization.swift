@@ -0,0 +1,675 @@
+//===----------------------------------------------------------------------===//
+//
+// This source file is part of the Swift.org open source project
+//
+// Copyright (c) 2025 Apple Inc. and the Swift project authors
+// Licensed under Apache License v2.0 with Runtime Library Exception
+//
+// See https://swift.org/LICENSE.txt for license information
+//
+//===----------------------------------------------------------------------===//
+
+internal import _RegexParser
+
+// A compiled representation is a header followed by a payload:
+//
+//   magic: UInt32, version: UInt32, payload size: UInt64, checksum: UInt64
+//
+// The payload holds the pattern, the program's options and capture list,
+// the contents of its read-only registers, its prefilter, and finally its
+// instructions, aligned to 8 bytes so that they can be copied in bulk. All
+// integers are little-endian; most are stored as UInt64.
+//
+// Programs that use closures, such as capture transforms and custom
+// components, can't be serialized. Neither can programs with references
+// from RegexBuilder, whose identifiers are only unique within a process.
+
+@available(SwiftStdlib 6.1, *)
+extension MEProgram {
+  static var serializationMagic: UInt32 { 0x5247_5853 }  // "SXGR"
+
+  /// The version of the format, which changes whenever the format or the
+  /// instruction set does.
+  static var serializationVersion: UInt32 { 3 }
+
+  static var serializationHeaderSize: Int { 24 }
+
+  /// Returns the compiled representation of this program, which was
+  /// compiled from `pattern`.
+  func serialized(
+    pattern: String,
+    syntax: SyntaxOptions,
+    stepLimit: Int?
+  ) throws -> [UInt8] {
+    guard registers.consumeFunctions.isEmpty,
+          registers.transformFunctions.isEmpty,
+          registers.matcherFunctions.isEmpty,
+          wholeMatchValueRegister == nil,
+          referencedCaptureOffsets.isEmpty,
+          captureList.captures.allSatisfy({ $0.type == Substring.self })
+    else {
+      throw CompiledRegexError.unsupportedComponent
+    }
+
+    var writer = Writer()
+    writer.write(pattern)
+    writer.write(UInt64(syntax.rawValue))
+    writer.write(stepLimit)
+
+    let scopes = initialOptions.serializedScopes
+    writer.write(scopes.count)
+    for scope in scopes {
+      writer.write(UInt64(scope))
+    }
+    writer.write(canOnlyMatchAtStart)
+    writer.write(canUseLazyDFA)
+
+    writer.write(captureList.captures.count)
+    for capture in captureList.captures {
+      writer.write(capture.name)
+      writer.write(capture.optionalDepth)
+      writer.write(capture.visibleInTypedOutput)
+    }
+
+    writer.write(registers.elements.count)
+    for element in registers.elements {
+      writer.write(String(element))
+    }
+    writer.write(registers.utf8Contents.count)
+    for bytes in registers.utf8Contents {
+      writer.write(bytes)
+    }
+    writer.write(registers.bitsets.count)
+    for bitset in registers.bitsets {
+      writer.write(bitset)
+    }
+    writer.write(registers.scalarRunSets.count)
+    for set in registers.scalarRunSets {
+      writer.write(set.words.count)
+      for word in set.words {
+        writer.write(word)
+      }
+      writer.write(set.isInverted)
+      writer.write(set.properties.count)
+      for property in set.properties {
+        try writer.write(property)
+      }
+    }
+    writer.write(registers.literalTries.count)
+    for trie in registers.literalTries {
+      writer.write(trie.literals.count)
+      for literal in trie.literals {
+        writer.write(literal)
+      }
+      writer.write(trie.isCaseInsensitive)
+      writer.write(trie.boundaryCheck)
+    }
+    writer.write(registers.ints.count)
+    writer.write(registers.values.count)
+    writer.write(registers.positions.count)
+
+    writer.write(prefilter != nil)
+    if let prefilter {
+      writer.write(prefilter.prefix)
+      writer.write(prefilter.requiredLiteral)
+      writer.write(prefilter.leadingBytes != nil)
+      if let leadingBytes = prefilter.leadingBytes {
+        writer.write(leadingBytes)
+      }
+      writer.write(prefilter.isCaseInsensitive)
+    }
+
+    writer.write(instructions.count)
+    writer.alignTo8()
+    for instruction in instructions.rawValue {
+      writer.write(instruction.rawValue)
+    }
+
+    var header = Writer()
+    header.write(UInt32(Self.serializationMagic))
+    header.write(UInt32(Self.serializationVersion))
+    header.write(writer.bytes.count)
+    header.write(writer.bytes.withUnsafeBytes(Self.checksum))
+    assert(header.bytes.count == Self.serializationHeaderSize)
+    return header.bytes + writer.bytes
+  }
+
+  /// A program loaded from a compiled representation, along with what it
+  /// was compiled from.
+  struct Loaded {
+    var program: MEProgram
+    var pattern: String
+    var syntax: SyntaxOptions
+    var ast: AST
+    var stepLimit: Int?
+  }
+
+  /// Loads a program from a compiled representation returned by
+  /// `serialized(pattern:syntax:stepLimit:)`.
+  static func load(from buffer: UnsafeRawBufferPointer) throws -> Loaded {
+    var header = Reader(buffer.prefix(serializationHeaderSize))
+    guard try header.readUInt32() == serializationMagic else {
+      throw CompiledRegexError.invalidData
+    }
+    guard try header.readUInt32() == serializationVersion else {
+      throw CompiledRegexError.unsupportedVersion
+    }
+    let payload = UnsafeRawBufferPointer(
+      rebasing: buffer.dropFirst(serializationHeaderSize))
+    guard try header.readInt() == payload.count,
+          try header.readUInt64() == checksum(payload)
+    else {
+      throw CompiledRegexError.invalidData
+    }
+
+    var reader = Reader(payload)
+    let pattern = try reader.readString()
+    let syntax = SyntaxOptions(rawValue: UInt(try reader.readUInt64()))
+    let stepLimit = try reader.readOptionalInt()
+    // The pattern is parsed again when the regex is combined with another
+    // or recompiled, so it has to be valid.
+    guard let ast = try? parse(pattern, syntax) else {
+      throw CompiledRegexError.invalidData
+    }
+
+    let scopes = try reader.readArray { r in
+      UInt32(exactly: try r.readUInt64())
+    }
+    guard let initialOptions = MatchingOptions(serializedScopes: scopes) else {
+      throw CompiledRegexError.invalidData
+    }
+    let canOnlyMatchAtStart = try reader.readBool()
+    let wasCompiledForLazyDFA = try reader.readBool()
+
+    let captures = try reader.readArray { r in
+      CaptureList.Capture(
+        name: try r.readOptionalString(),
+        optionalDepth: try r.readInt(),
+        visibleInTypedOutput: try r.readBool(),
+        .fake)
+    }
+    let patternCaptures = ast.captureList.captures
+    guard captures.count == patternCaptures.count,
+          zip(captures, patternCaptures).allSatisfy({
+            $0.name == $1.name && $0.optionalDepth >= 0
+          })
+    else {
+      throw CompiledRegexError.invalidData
+    }
+
+    let elements = try reader.readArray { r -> Character? in
+      let string = try r.readString()
+      return string.count == 1 ? string.first : nil
+    }
+    let utf8Contents = try reader.readArray { r in try r.readBytes() }
+    let bitsets = try reader.readArray { r in try r.readBitset() }
+    let scalarRunSets = try reader.readArray { r -> ScalarRunSet? in
+      let words = try r.readArray { r in try r.readUInt64() }
+      let isInverted = try r.readBool()
+      let properties = try r.readArray { r in try r.readProperty() }
+      return ScalarRunSet(words: words, properties, isInverted: isInverted)
+    }
+    let literalTries = try reader.readArray { r -> LiteralTrie? in
+      let literals = try r.readArray { r in try r.readBytes() }
+      let isCaseInsensitive = try r.readBool()
+      let boundaryCheck = try r.readBool()
+      if isCaseInsensitive
+          && !literals.allSatisfy({ $0.allSatisfy(\._isASCII) }) {
+        return nil
+      }
+      return LiteralTrie(
+        literals,
+        isCaseInsensitive: isCaseInsensitive,
+        boundaryCheck: boundaryCheck)
+    }
+    let numInts = try reader.readInt()
+    let numValues = try reader.readInt()
+    let numPositions = try reader.readInt()
+    // Instructions refer to these registers with 16-bit operands.
+    guard [numInts, numValues, numPositions].allSatisfy({
+      (0...(1 << 16)).contains($0)
+    }) else {
+      throw CompiledRegexError.invalidData
+    }
+
+    var prefilter: Prefilter? = nil
+    if try reader.readBool() {
+      prefilter = Prefilter(
+        prefix: try reader.readBytes(),
+        requiredLiteral: try reader.readBytes(),
+        leadingBytes: try reader.readBool() ? try reader.readBitset() : nil,
+        isCaseInsensitive: try reader.readBool())
+    }
+
+    let instructionCount = try reader.readInt()
+    try reader.alignTo8()
+    let instructionWords = try reader.readWords(instructionCount)
+    guard reader.isAtEnd else {
+      throw CompiledRegexError.invalidData
+    }
+
+    let registers = Processor.Registers(
+      elements: elements,
+      utf8Contents: utf8Contents,
+      bitsets: bitsets,
+      scalarRunSets: scalarRunSets,
+      literalTries: literalTries,
+      consumeFunctions: [],
+      transformFunctions: [],
+      matcherFunctions: [],
+      numInts: numInts,
+      numValues: numValues,
+      numPositions: numPositions)
+    let instructions = try validatedInstructions(
+      instructionWords,
+      registers: registers,
+      captureCount: captures.count - 1)
+    let canUseLazyDFA = wasCompiledForLazyDFA
+      && LazyDFA.canSimulate(instructions, registers: registers)
+
+    let program = MEProgram(
+      instructions: instructions,
+      wholeMatchValueRegister: nil,
+      enableTracing: false,
+      enableMetrics: false,
+      captureList: CaptureList(captures),
+      referencedCaptureOffsets: [:],
+      initialOptions: initialOptions,
+      canOnlyMatchAtStart: canOnlyMatchAtStart,
+      prefilter: prefilter,
+      canUseLazyDFA: canUseLazyDFA,
+      lazyDFAs: canUseLazyDFA ? LazyDFACache() : nil,
+      memoRows: memoizationRows(instructions),
+      registers: registers,
+      storedCaptures: Array(
+        repeating: Processor._StoredCapture(), count: captures.count - 1))
+    return Loaded(
+      program: program,
+      pattern: pattern,
+      syntax: syntax,
+      ast: ast,
+      stepLimit: stepLimit)
+  }
+
+  /// Returns the instructions in `words`, checking that each has a valid
+  /// opcode and operands, that every instruction address is in bounds, and
+  /// that execution can't run past the last instruction.
+  ///
+  /// `captureCount` is the number of capture registers, which doesn't
+  /// include the whole match.
+  private static func validatedInstructions(
+    _ words: [UInt64],
+    registers: Processor.Registers,
+    captureCount: Int
+  ) throws -> InstructionList<Instruction> {
+    var instructions: [Instruction] = []
+    instructions.reserveCapacity(words.count)
+    for word in words {
+      guard let opcode = Instruction.OpCode(rawValue: word &>> 56),
+            opcode != .invalid
+      else {
+        throw CompiledRegexError.invalidData
+      }
+      let instruction = Instruction(rawValue: word)
+      guard hasValidOperands(
+        instruction, registers: registers, captureCount: captureCount)
+      else {
+        throw CompiledRegexError.invalidData
+      }
+      instructions.append(instruction)
+    }
+    // Programs end in `accept`, followed by a `fail` instruction when
+    // possessive quantification needs an empty save point.
+    switch instructions.last?.opcode {
+    case .accept, .fail, .branch:
+      break
+    default:
+      throw CompiledRegexError.invalidData
+    }
+
+    for instruction in instructions {
+      let addresses = instruction.addressOperands
+      guard addresses.allSatisfy({ $0.rawValue < instructions.count }) else {
+        throw CompiledRegexError.invalidData
+      }
+    }
+    return InstructionList(instructions)
+  }
+
+  /// Returns whether every register and capture that `instruction` refers
+  /// to exists, and whether its other operands are ones the processor
+  /// accepts.
+  private static func hasValidOperands(
+    _ instruction: Instruction,
+    registers: Processor.Registers,
+    captureCount: Int
+  ) -> Bool {
+    let (opcode, payload) = instruction.destructure
+    switch opcode {
+    case .moveImmediate, .condBranchZeroElseDecrement,
+        .condBranchSamePosition, .splitSaving, .advance, .match, .matchUTF8,
+        .matchBitset, .matchBy, .backreference, .transformCapture,
+        .captureValue:
+      // These pack two 16-bit operands.
+      guard payload.rawValue &>> 32 == 0 else { return false }
+    default:
+      break
+    }
+
+    switch opcode {
+    case .invalid:
+      return false
+    case .moveImmediate:
+      return payload.pairedImmediateInt.1.rawValue < registers.ints.count
+    case .moveCurrentPosition, .restorePosition:
+      return payload.position.rawValue < registers.positions.count
+    case .condBranchZeroElseDecrement:
+      return payload.pairedAddrInt.1.rawValue < registers.ints.count
+    case .condBranchSamePosition:
+      return payload.pairedAddrPos.1.rawValue < registers.positions.count
+    case .match:
+      return payload.elementPayload.1.rawValue < registers.elements.count
+    case .matchScalar:
+      return Unicode.Scalar(UInt32(truncatingIfNeeded: payload.rawValue)) != nil
+    case .matchUTF8:
+      return payload.matchUTF8Payload.0.rawValue < registers.utf8Contents.count
+    case .matchLiteralTrie:
+      return payload.literalTrie.rawValue < registers.literalTries.count
+    case .matchBitset:
+      return payload.bitsetPayload.1.rawValue < registers.bitsets.count
+    case .matchBuiltin:
+      return _CharacterClassModel.Representation(
+        rawValue: payload.rawValue & CharacterClassPayload.ccMask) != nil
+    case .assertBy:
+      return DSLTree.Atom.Assertion(
+        rawValue: payload.rawValue & AssertionPayload.assertionKindMask) != nil
+    case .quantify:
+      return hasValidOperands(payload.quantify, registers: registers)
+    case .consumeBy:
+      return payload.consumer.rawValue < registers.consumeFunctions.count
+    case .matchBy:
+      let (matcher, value) = payload.pairedMatcherValue
+      return matcher.rawValue < registers.matcherFunctions.count
+        && value.rawValue < registers.values.count
+    case .backreference:
+      return payload.captureAndMode.1.rawValue < captureCount
+    case .beginCapture, .endCapture:
+      return payload.capture.rawValue < captureCount
+    case .transformCapture:
+      let (capture, transform) = payload.pairedCaptureTransform
+      return capture.rawValue < captureCount
+        && transform.rawValue < registers.transformFunctions.count
+    case .captureValue:
+      let (value, capture) = payload.pairedValueCapture
+      return value.rawValue < registers.values.count
+        && capture.rawValue < captureCount
+    case .branch, .save, .saveAddress, .clear, .clearThrough, .splitSaving,
+        .advance, .matchAnyNonNewline, .accept, .fail:
+      // Instruction addresses are checked once every instruction is read.
+      return true
+    }
+  }
+
+  private static func hasValidOperands(
+    _ quantify: QuantifyPayload,
+    registers: Processor.Registers
+  ) -> Bool {
+    let kind = (quantify.rawValue &>> QuantifyPayload.quantKindShift)
+      & quantify.quantKindMask
+    guard kind <= 2, let type = QuantifyPayload.PayloadType(
+      rawValue: (quantify.rawValue &>> QuantifyPayload.typeShift)
+        & quantify.typeMask)
+    else {
+      return false
+    }
+    switch type {
+    case .asciiBitset:
+      return quantify.bitset.rawValue < registers.bitsets.count
+    case .scalarRun:
+      return quantify.scalarRun.rawValue < registers.scalarRunSets.count
+    case .asciiChar:
+      return quantify.rawValue & quantify.payloadMask < 0x80
+    case .any:
+      return true
+    case .builtinCC:
+      return _CharacterClassModel.Representation(
+        rawValue: quantify.rawValue & 0xFF) != nil
+    }
+  }
+
+  /// A 64-bit FNV-1a hash, to catch representations that were truncated or
+  /// corrupted.
+  private static func checksum(_ bytes: UnsafeRawBufferPointer) -> UInt64 {
+    var hash: UInt64 = 0xcbf2_9ce4_8422_2325
+    for byte in bytes {
+      hash = (hash ^ UInt64(byte)) &* 0x100_0000_01b3
+    }
+    return hash
+  }
+}
+
+// MARK: - Writing
+
+@available(SwiftStdlib 6.1, *)
+extension MEProgram {
+  fileprivate struct Writer {
+    var bytes: [UInt8] = []
+
+    mutating func write(_ value: UInt64) {
+      withUnsafeBytes(of: value.littleEndian) { bytes.append(contentsOf: $0) }
+    }
+
+    mutating func write(_ value: UInt32) {
+      withUnsafeBytes(of: value.littleEndian) { bytes.append(contentsOf: $0) }
+    }
+
+    mutating func write(_ value: Int) {
+      write(UInt64(bitPattern: Int64(value)))
+    }
+
+    mutating func write(_ value: Int?) {
+      write(value != nil)
+      if let value {
+        write(value)
+      }
+    }
+
+    mutating func write(_ value: Bool) {
+      bytes.append(value ? 1 : 0)
+    }
+
+    mutating func write(_ value: [UInt8]) {
+      write(value.count)
+      bytes.append(contentsOf: value)
+    }
+
+    mutating func write(_ value: String) {
+      write(Array(value.utf8))
+    }
+
+    mutating func write(_ value: String?) {
+      write(value != nil)
+      if let value {
+        write(value)
+      }
+    }
+
+    mutating func write(_ bitset: DSLTree.CustomCharacterClass.AsciiBitset) {
+      write(bitset.isInverted)
+      write(bitset.a)
+      write(bitset.b)
+    }
+
+    mutating func write(_ property: AST.Atom.CharacterProperty) throws {
+      switch property.kind {
+      case .assigned:
+        bytes.append(0)
+        write("")
+      case .generalCategory(let category):
+        bytes.append(1)
+        write(category.rawValue)
+      case .script(let script):
+        bytes.append(2)
+        write(script.rawValue)
+      case .scriptExtension(let script):
+        bytes.append(3)
+        write(script.rawValue)
+      default:
+        throw CompiledRegexError.unsupportedComponent
+      }
+      write(property.isInverted)
+      write(property.isPOSIX)
+    }
+
+    mutating func alignTo8() {
+      while bytes.count % 8 != 0 {
+        bytes.append(0)
+      }
+    }
+  }
+}
+
+// MARK: - Reading
+
+@available(SwiftStdlib 6.1, *)
+extension MEProgram {
+  /// Reads values from a buffer, throwing `CompiledRegexError.invalidData`
+  /// when a value doesn't fit in what remains of the buffer.
+  fileprivate struct Reader {
+    let buffer: UnsafeRawBufferPointer
+    var offset = 0
+
+    init(_ buffer: UnsafeRawBufferPointer) {
+      self.buffer = buffer
+    }
+
+    init(_ buffer: Slice<UnsafeRawBufferPointer>) {
+      self.buffer = UnsafeRawBufferPointer(rebasing: buffer)
+    }
+
+    var isAtEnd: Bool { offset == buffer.count }
+
+    private mutating func take(_ count: Int) throws -> UnsafeRawBufferPointer {
+      guard count >= 0, count <= buffer.count - offset else {
+        throw CompiledRegexError.invalidData
+      }
+      defer { offset += count }
+      return UnsafeRawBufferPointer(
+        rebasing: buffer[offset ..< offset + count])
+    }
+
+    mutating func readUInt64() throws -> UInt64 {
+      UInt64(littleEndian: try take(8).loadUnaligned(as: UInt64.self))
+    }
+
+    mutating func readUInt32() throws -> UInt32 {
+      UInt32(littleEndian: try take(4).loadUnaligned(as: UInt32.self))
+    }
+
+    mutating func readInt() throws -> Int {
+      guard let value = Int(exactly: Int64(bitPattern: try readUInt64()))
+      else {
+        throw CompiledRegexError.invalidData
+      }
+      return value
+    }
+
+    mutating func readOptionalInt() throws -> Int? {
+      try readBool() ? try readInt() : nil
+    }
+
+    mutating func readBool() throws -> Bool {
+      switch try take(1)[0] {
+      case 0: return false
+      case 1: return true
+      default: throw CompiledRegexError.invalidData
+      }
+    }
+
+    mutating func readBytes() throws -> [UInt8] {
+      Array(try take(try readInt()))
+    }
+
+    mutating func readString() throws -> String {
+      String(decoding: try take(try readInt()), as: UTF8.self)
+    }
+
+    mutating func readOptionalString() throws -> String? {
+      try readBool() ? try readString() : nil
+    }
+
+    mutating func readBitset() throws -> DSLTree.CustomCharacterClass.AsciiBitset {
+      let isInverted = try readBool()
+      return .init(a: try readUInt64(), b: try readUInt64(), isInverted: isInverted)
+    }
+
+    mutating func readProperty() throws -> AST.Atom.CharacterProperty {
+      let tag = try take(1)[0]
+      let rawValue = try readString()
+      let kind: AST.Atom.CharacterProperty.Kind
+      switch tag {
+      case 0:
+        kind = .assigned
+      case 1:
+        guard let category = Unicode.ExtendedGeneralCategory(
+          rawValue: rawValue)
+        else {
+          throw CompiledRegexError.invalidData
+        }
+        kind = .generalCategory(category)
+      case 2, 3:
+        guard let script = Unicode.Script(rawValue: rawValue) else {
+          throw CompiledRegexError.invalidData
+        }
+        kind = tag == 2 ? .script(script) : .scriptExtension(script)
+      default:
+        throw CompiledRegexError.invalidData
+      }
+      return .init(kind, isInverted: try readBool(), isPOSIX: try readBool())
+    }
+
+    /// Reads a count followed by that many elements, each read by `body`,
+    /// which returns `nil` for an invalid element.
+    mutating func readArray<T>(
+      _ body: (inout Reader) throws -> T?
+    ) throws -> [T] {
+      let count = try readInt()
+      // Each element takes at least one byte.
+      guard count >= 0, count <= buffer.count - offset else {
+        throw CompiledRegexError.invalidData
+      }
+      var result: [T] = []
+      result.reserveCapacity(count)
+      for _ in 0 ..< count {
+        guard let element = try body(&self) else {
+          throw CompiledRegexError.invalidData
+        }
+        result.append(element)
+      }
+      return result
+    }
+
+    mutating func alignTo8() throws {
+      _ = try take((8 - offset % 8) % 8)
+    }
+
+    /// Reads `count` words with a single copy.
+    mutating func readWords(_ count: Int) throws -> [UInt64] {
+      guard count >= 0, count <= (buffer.count - offset) / 8 else {
+        throw CompiledRegexError.invalidData
+      }
+      let bytes = try take(count * 8)
+      var words = Array<UInt64>(unsafeUninitializedCapacity: count) {
+        words, initializedCount in
+        UnsafeMutableRawBufferPointer(words).copyMemory(from: bytes)
+        initializedCount = count
+      }
+      #if _endian(big)
+      for i in words.indices {
+        words[i] = UInt64(littleEndian: words[i])
+      }
+      #endif
+      return words
+    }
+  }
+}
@@ -80,7 +80,16 @@ extension Processor {
       }
 
     case .any:
-      if isZeroOrMore {
+      if !isScalarSemantics {
+        matchResult = input.matchQuantifiedCharacterDot(
+          at: currentPosition,
+          limitedBy: end,
+          minMatches: minMatches,
+          maxMatches: maxMatches,
+          produceSavePointRange: produceSavePointRange,
+          anyMatchesNewline: payload.anyMatchesNewline,
+          using: &graphemeBreakCache)
+      } else if isZeroOrMore {
         matchResult = input.matchZeroOrMoreRegexDot(
           at: currentPosition,
           limitedBy: end,
@@ -136,6 +145,27 @@ extension Processor {
           isStrictASCII: payload.builtinIsStrict,
           isScalarSemantics: isScalarSemantics)
       }
+
+    case .scalarRun:
+      let set = registers[payload.scalarRun]
+      if isScalarSemantics && payload.maxExtraTrips == nil {
+        matchResult = input.matchUnboundedScalarRun(
+          set,
+          at: currentPosition,
+          limitedBy: end,
+          minMatches: minMatches,
+          produceSavePointRange: produceSavePointRange)
+      } else {
+        matchResult = input.matchQuantifiedScalarRun(
+          set,
+          at: currentPosition,
+          limitedBy: end,
+          minMatches: minMatches,
+          maxMatches: maxMatches,
+          produceSavePointRange: produceSavePointRange,
+          isScalarSemantics: isScalarSemantics,
+          using: &graphemeBreakCache)
+      }
     }
 
     guard let (next, savePointRange) = matchResult else {
@@ -524,6 +554,120 @@ extension String {
         isScalarSemantics: isScalarSemantics)
     }
   }
-}
 
+  /// Matches `.` under grapheme semantics, stepping a character at a time
+  /// with the batched breaks in `cache`.
+  fileprivate func matchQuantifiedCharacterDot(
+    at currentPosition: Index,
+    limitedBy end: Index,
+    minMatches: UInt64,
+    maxMatches: UInt64,
+    produceSavePointRange: Bool,
+    anyMatchesNewline: Bool,
+    using cache: inout GraphemeBreakCache
+  ) -> (next: Index, savePointRange: Range<Index>?)? {
+    _runQuantLoop(
+      at: currentPosition,
+      limitedBy: end,
+      minMatches: minMatches,
+      maxMatches: maxMatches,
+      produceSavePointRange: produceSavePointRange,
+      isScalarSemantics: false
+    ) { currentPosition, end, _ in
+      guard currentPosition < end else { return nil }
+      // A character is a newline exactly when its first scalar is.
+      if !anyMatchesNewline && unicodeScalars[currentPosition].isNewline {
+        return nil
+      }
+      let next = index(after: currentPosition, using: &cache)
+      if next <= end {
+        return next
+      }
+      // The character is cut short by `end`.
+      return matchRegexDot(
+        at: currentPosition,
+        limitedBy: end,
+        anyMatchesNewline: anyMatchesNewline,
+        isScalarSemantics: false)
+    }
+  }
+
+  /// Matches an unbounded run of scalars in `set`, finding the whole run at
+  /// once rather than a trip at a time.
+  fileprivate func matchUnboundedScalarRun(
+    _ set: ScalarRunSet,
+    at currentPosition: Index,
+    limitedBy end: Index,
+    minMatches: UInt64,
+    produceSavePointRange: Bool
+  ) -> (next: Index, savePointRange: Range<Index>?)? {
+    let runEnd = _scalarRunEnd(set, from: currentPosition, limitedBy: end)
+
+    // The same backtracking positions as `_runQuantLoop` produces: from the
+    // end of the last required trip to the start of the final one.
+    var rangeStart = currentPosition
+    for _ in 0..<minMatches {
+      guard rangeStart < runEnd else { return nil }
+      unicodeScalars.formIndex(after: &rangeStart)
+    }
+    guard produceSavePointRange && rangeStart < runEnd else {
+      return (runEnd, nil)
+    }
+    let rangeEnd = unicodeScalars.index(before: runEnd)
+    return (
+      runEnd,
+      Range(uncheckedBounds: (lower: rangeStart, upper: rangeEnd))
+    )
+  }
 
+  fileprivate func matchQuantifiedScalarRun(
+    _ set: ScalarRunSet,
+    at currentPosition: Index,
+    limitedBy end: Index,
+    minMatches: UInt64,
+    maxMatches: UInt64,
+    produceSavePointRange: Bool,
+    isScalarSemantics: Bool,
+    using cache: inout GraphemeBreakCache
+  ) -> (next: Index, savePointRange: Range<Index>?)? {
+    // A bounded quantification only looks at a few trips, which isn't worth
+    // scanning the whole run for.
+    guard maxMatches == UInt64.max else {
+      return _runQuantLoop(
+        at: currentPosition,
+        limitedBy: end,
+        minMatches: minMatches,
+        maxMatches: maxMatches,
+        produceSavePointRange: produceSavePointRange,
+        isScalarSemantics: isScalarSemantics
+      ) { currentPosition, end, isScalarSemantics in
+        matchScalarRun(
+          set,
+          at: currentPosition,
+          limitedBy: end,
+          isScalarSemantics: isScalarSemantics)
+      }
+    }
+
+    // Scalars before `runEnd` are known to be in the set, so a trip that
+    // starts before it only needs to find the end of the character.
+    var runEnd = currentPosition
+    return _runQuantLoop(
+      at: currentPosition,
+      limitedBy: end,
+      minMatches: minMatches,
+      maxMatches: maxMatches,
+      produceSavePointRange: produceSavePointRange,
+      isScalarSemantics: isScalarSemantics
+    ) { currentPosition, end, isScalarSemantics in
+      if currentPosition >= runEnd {
+        runEnd = _scalarRunEnd(set, from: currentPosition, limitedBy: end)
+        guard currentPosition < runEnd else { return nil }
+      }
+      let next = isScalarSemantics
+        ? unicodeScalars.index(after: currentPosition)
+        : index(after: currentPosition, using: &cache)
+      return next <= end ? next : nil
+    }
+  }
+}
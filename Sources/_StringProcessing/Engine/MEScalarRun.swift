@@ -0,0 +1,204 @@
+//===----------------------------------------------------------------------===//
+//
+// This source file is part of the Swift.org open source project
+//
+// Copyright (c) 2025 Apple Inc. and the Swift project authors
+// Licensed under Apache License v2.0 with Runtime Library Exception
+//
+// See https://swift.org/LICENSE.txt for license information
+//
+//===----------------------------------------------------------------------===//
+
+internal import _RegexParser
+
+@_silgen_name("_swift_string_processing_scalarRunLength")
+func _swift_string_processing_scalarRunLength(
+  _: UnsafePointer<UInt8>,
+  _: Int,
+  _: UnsafePointer<UInt64>
+) -> Int
+
+/// A set of scalars defined by properties, such as `[\p{Nd}\p{Pc}]`, whose
+/// runs are found by a kernel in `_CUnicode` when quantified.
+///
+/// The kernel decides the scalars below U+0800 from a bitmap, and the rest
+/// from the script tables when the set is made of scripts. It stops at any
+/// other scalar, which `predicate` decides instead, so the set matches
+/// exactly what the properties' consume functions do.
+struct ScalarRunSet {
+  /// The set in the layout that `_swift_string_processing_scalarRunLength`
+  /// reads, described in `UnicodeData.h`.
+  var words: [UInt64]
+
+  /// Whether a scalar is in the set.
+  var predicate: ScalarPredicate
+
+  /// The properties that define the set, which are kept so that the set can
+  /// be serialized.
+  var properties: [AST.Atom.CharacterProperty]
+  var isInverted: Bool
+}
+
+extension ScalarRunSet {
+  // Keep in sync with UnicodeData.h
+  static var scriptsWord: Int { 32 }
+  static var flagsWord: Int { 36 }
+  static var nibblesWord: Int { 37 }
+  static var wordCount: Int { 39 }
+
+  static var hasScriptsFlag: UInt64 { 1 }
+  static var usesExtensionsFlag: UInt64 { 2 }
+  static var isInvertedFlag: UInt64 { 4 }
+
+  /// Creates the set of scalars that match any of `properties`, or none of
+  /// them if `isInverted` is `true`.
+  ///
+  /// Returns `nil` if any of the properties looks at more than a single
+  /// scalar.
+  init?(_ properties: [AST.Atom.CharacterProperty], isInverted: Bool) {
+    guard let predicate = Self.predicate(properties, isInverted: isInverted)
+    else {
+      return nil
+    }
+
+    var words = Array(repeating: UInt64(0), count: Self.wordCount)
+    for value in 0..<UInt32(0x800) where predicate(Unicode.Scalar(value)!) {
+      words[Int(value >> 6)] |= 1 << (value & 63)
+    }
+    let ascii = (words[0], words[1])
+    words.withUnsafeMutableBytes { bytes in
+      for byte in 0..<0x80 {
+        let word = byte < 64 ? ascii.0 : ascii.1
+        guard (word >> (byte & 63)) & 1 == 1 else { continue }
+        bytes[Self.nibblesWord * 8 + (byte & 0xF)] |= 1 << (byte >> 4)
+      }
+    }
+
+    func setScriptBit(_ script: Unicode.Script) {
+      let value = Int(unsafeBitCast(script, to: UInt8.self))
+      words[Self.scriptsWord + (value >> 6)] |= 1 << (value & 63)
+    }
+
+    if properties.allSatisfy({ p in
+      if case .script = p.kind { return true }
+      return false
+    }) {
+      // The script alone decides whether a scalar is in the set.
+      for script in Unicode.Script.allCases {
+        let isMember = properties.contains { p in
+          guard case .script(let s) = p.kind else { return false }
+          return (s == script) != p.isInverted
+        }
+        if isMember != isInverted {
+          setScriptBit(script)
+        }
+      }
+      words[Self.flagsWord] = Self.hasScriptsFlag
+    } else if properties.allSatisfy({ p in
+      if case .scriptExtension = p.kind { return !p.isInverted }
+      return false
+    }) {
+      // A scalar is in the set when any of its script extensions is.
+      for p in properties {
+        guard case .scriptExtension(let s) = p.kind else { continue }
+        setScriptBit(s)
+      }
+      words[Self.flagsWord] = Self.hasScriptsFlag | Self.usesExtensionsFlag
+        | (isInverted ? Self.isInvertedFlag : 0)
+    }
+    self.words = words
+    self.predicate = predicate
+    self.properties = properties
+    self.isInverted = isInverted
+  }
+
+  /// Creates a set from words previously computed for the same properties,
+  /// as when loading a serialized program.
+  init?(
+    words: [UInt64],
+    _ properties: [AST.Atom.CharacterProperty],
+    isInverted: Bool
+  ) {
+    guard words.count == Self.wordCount,
+          let predicate = Self.predicate(properties, isInverted: isInverted)
+    else {
+      return nil
+    }
+    self.words = words
+    self.predicate = predicate
+    self.properties = properties
+    self.isInverted = isInverted
+  }
+
+  private static func predicate(
+    _ properties: [AST.Atom.CharacterProperty],
+    isInverted: Bool
+  ) -> ScalarPredicate? {
+    let predicates = properties.compactMap(\.scalarPredicate)
+    guard !properties.isEmpty, predicates.count == properties.count else {
+      return nil
+    }
+    if predicates.count == 1 && !isInverted {
+      return predicates[0]
+    }
+    return { s in predicates.contains { $0(s) } != isInverted }
+  }
+}
+
+extension String {
+  /// Returns the end of the run of scalars in `set` that the kernel finds
+  /// from `start`, which stops early at scalars it leaves undecided.
+  ///
+  /// Returns `start` for strings without contiguous UTF-8 storage.
+  private func _decidedScalarRunEnd(
+    _ set: ScalarRunSet,
+    from start: Index,
+    limitedBy end: Index
+  ) -> Index {
+    let length: Int? = utf8.withContiguousStorageIfAvailable { bytes in
+      let lower = utf8.distance(from: startIndex, to: start)
+      let upper = utf8.distance(from: startIndex, to: end)
+      return set.words.withUnsafeBufferPointer { words in
+        _swift_string_processing_scalarRunLength(
+          bytes.baseAddress! + lower, upper - lower, words.baseAddress!)
+      }
+    }
+    guard let length, length > 0 else { return start }
+    return utf8.index(start, offsetBy: length)
+  }
+
+  /// Returns the end of the longest run of scalars in `set` beginning at
+  /// `start` that doesn't pass `end`.
+  func _scalarRunEnd(
+    _ set: ScalarRunSet,
+    from start: Index,
+    limitedBy end: Index
+  ) -> Index {
+    var position = start
+    while position < end {
+      position = _decidedScalarRunEnd(set, from: position, limitedBy: end)
+      guard position < end, set.predicate(unicodeScalars[position]) else {
+        break
+      }
+      let next = unicodeScalars.index(after: position)
+      guard next <= end else { break }
+      position = next
+    }
+    return position
+  }
+
+  /// Matches a single scalar in `set`, or in grapheme semantics, a single
+  /// character whose leading scalar is in `set`.
+  func matchScalarRun(
+    _ set: ScalarRunSet,
+    at position: Index,
+    limitedBy end: Index,
+    isScalarSemantics: Bool
+  ) -> Index? {
+    guard position < end, set.predicate(unicodeScalars[position]) else {
+      return nil
+    }
+    let next = index(after: position, isScalarSemantics: isScalarSemantics)
+    return next <= end ? next : nil
+  }
+}
@@ -0,0 +1,282 @@
+//===----------------------------------------------------------------------===//
+//
+// This source file is part of the Swift.org open source project
+//
+// Copyright (c) 2025 Apple Inc. and the Swift project authors
+// Licensed under Apache License v2.0 with Runtime Library Exception
+//
+// See https://swift.org/LICENSE.txt for license information
+//
+//===----------------------------------------------------------------------===//
+
+/// A program lowered to a closure per instruction, which the processor calls
+/// in place of decoding and dispatching the instruction in `cycle()`.
+///
+/// Each closure is built once, when the program is compiled, with its
+/// instruction's payload already decoded and the contents of the read-only
+/// registers it uses loaded. Instructions whose behavior depends on the
+/// semantic level or case sensitivity are lowered to a closure for that
+/// combination, so those checks aren't made at each step.
+///
+/// The closures run each instruction with the same processor methods as
+/// `cycle()` does, so the step budget, memoization, and backtracking all
+/// work unchanged. The processor still uses `cycle()` for programs that
+/// record traces, metrics, or a profile, which are counted per instruction.
+struct ThreadedCode {
+  typealias Step = (inout Processor) -> Void
+
+  /// The closure for each instruction, indexed by its address.
+  let steps: [Step]
+
+  init(
+    _ instructions: InstructionList<Instruction>,
+    registers: Processor.Registers
+  ) {
+    self.steps = instructions.indices.map {
+      ThreadedCode.lower(instructions[$0], registers: registers)
+    }
+  }
+}
+
+extension ThreadedCode {
+  static func lower(
+    _ instruction: Instruction,
+    registers: Processor.Registers
+  ) -> Step {
+    let (opcode, payload) = instruction.destructure
+    switch opcode {
+    case .invalid:
+      return { _ in fatalError("Invalid program") }
+
+    case .moveImmediate:
+      let (imm, reg) = payload.pairedImmediateInt
+      let int = Int(asserting: imm)
+      return { cpu in cpu.moveImmediate(int, into: reg) }
+
+    case .moveCurrentPosition:
+      let reg = payload.position
+      return { cpu in cpu.moveCurrentPosition(into: reg) }
+
+    case .restorePosition:
+      let reg = payload.position
+      return { cpu in cpu.restorePosition(from: reg) }
+
+    case .branch:
+      let addr = payload.addr
+      return { cpu in cpu.controller.pc = addr }
+
+    case .condBranchZeroElseDecrement:
+      let (addr, reg) = payload.pairedAddrInt
+      return { cpu in cpu.condBranch(to: addr, ifZeroElseDecrement: reg) }
+
+    case .condBranchSamePosition:
+      let (addr, reg) = payload.pairedAddrPos
+      return { cpu in cpu.condBranch(to: addr, ifSamePositionAs: reg) }
+
+    case .save:
+      let resumeAddr = payload.addr
+      return { cpu in cpu.save(resumingAt: resumeAddr) }
+
+    case .saveAddress:
+      let resumeAddr = payload.addr
+      return { cpu in cpu.saveAddress(resumingAt: resumeAddr) }
+
+    case .splitSaving:
+      let (nextPC, resumeAddr) = payload.pairedAddrAddr
+      return { cpu in cpu.split(to: nextPC, saving: resumeAddr) }
+
+    case .clear:
+      return { cpu in cpu.clear() }
+
+    case .clearThrough:
+      let addr = payload.addr
+      return { cpu in cpu.clearThrough(addr) }
+
+    case .accept:
+      return { cpu in cpu.tryAccept() }
+
+    case .fail:
+      if payload.boolPayload {
+        return { cpu in cpu.signalFailure(preservingCaptures: true) }
+      }
+      return { cpu in cpu.signalFailure() }
+
+    case .advance:
+      let (isScalar, distance) = payload.distance
+      if isScalar {
+        return { cpu in cpu.advance(distance, isScalarDistance: true) }
+      }
+      return { cpu in cpu.advance(distance, isScalarDistance: false) }
+
+    case .matchAnyNonNewline:
+      if payload.isScalar {
+        return { cpu in
+          if cpu.matchAnyNonNewline(isScalarSemantics: true) {
+            cpu.controller.step()
+          }
+        }
+      }
+      return { cpu in
+        if cpu.matchAnyNonNewline(isScalarSemantics: false) {
+          cpu.controller.step()
+        }
+      }
+
+    case .match:
+      let (isCaseInsensitive, reg) = payload.elementPayload
+      let element = registers[reg]
+      if isCaseInsensitive {
+        return { cpu in
+          if cpu.match(element, isCaseInsensitive: true) {
+            cpu.controller.step()
+          }
+        }
+      }
+      return { cpu in
+        if cpu.match(element, isCaseInsensitive: false) {
+          cpu.controller.step()
+        }
+      }
+
+    case .matchScalar:
+      let (scalar, caseInsensitive, boundaryCheck) = payload.scalarPayload
+      if caseInsensitive || boundaryCheck {
+        return { cpu in
+          if cpu.matchScalar(
+            scalar,
+            boundaryCheck: boundaryCheck,
+            isCaseInsensitive: caseInsensitive
+          ) {
+            cpu.controller.step()
+          }
+        }
+      }
+      // Matching a scalar exactly, as in scalar semantics or within a
+      // literal that's known to be a single character, needs neither check.
+      return { cpu in
+        if cpu.matchScalar(
+          scalar, boundaryCheck: false, isCaseInsensitive: false
+        ) {
+          cpu.controller.step()
+        }
+      }
+
+    case .matchUTF8:
+      let (reg, boundaryCheck, isCaseInsensitive) = payload.matchUTF8Payload
+      let bytes = registers[reg]
+      if isCaseInsensitive || boundaryCheck {
+        return { cpu in
+          if cpu.matchUTF8(
+            bytes,
+            boundaryCheck: boundaryCheck,
+            isCaseInsensitive: isCaseInsensitive
+          ) {
+            cpu.controller.step()
+          }
+        }
+      }
+      return { cpu in
+        if cpu.matchUTF8(bytes, boundaryCheck: false, isCaseInsensitive: false) {
+          cpu.controller.step()
+        }
+      }
+
+    case .matchLiteralTrie:
+      let trie = registers[payload.literalTrie]
+      return { cpu in
+        if cpu.matchLiteralTrie(trie) {
+          cpu.controller.step()
+        }
+      }
+
+    case .matchBitset:
+      let (isScalar, reg) = payload.bitsetPayload
+      let bitset = registers[reg]
+      if isScalar {
+        return { cpu in
+          if cpu.matchBitset(bitset, isScalarSemantics: true) {
+            cpu.controller.step()
+          }
+        }
+      }
+      return { cpu in
+        if cpu.matchBitset(bitset, isScalarSemantics: false) {
+          cpu.controller.step()
+        }
+      }
+
+    case .matchBuiltin:
+      let payload = payload.characterClassPayload
+      let cc = payload.cc
+      let isInverted = payload.isInverted
+      let isStrictASCII = payload.isStrictASCII
+      if payload.isScalarSemantics {
+        return { cpu in
+          if cpu.matchBuiltinCC(
+            cc,
+            isInverted: isInverted,
+            isStrictASCII: isStrictASCII,
+            isScalarSemantics: true
+          ) {
+            cpu.controller.step()
+          }
+        }
+      }
+      return { cpu in
+        if cpu.matchBuiltinCC(
+          cc,
+          isInverted: isInverted,
+          isStrictASCII: isStrictASCII,
+          isScalarSemantics: false
+        ) {
+          cpu.controller.step()
+        }
+      }
+
+    case .quantify:
+      let quantify = payload.quantify
+      return { cpu in
+        if cpu.runQuantify(quantify) {
+          cpu.controller.step()
+        }
+      }
+
+    case .consumeBy:
+      let consumer = registers[payload.consumer]
+      return { cpu in cpu.consume(by: consumer) }
+
+    case .assertBy:
+      let assertion = payload.assertion
+      return { cpu in cpu.checkAssertion(assertion) }
+
+    case .matchBy:
+      let (matcherReg, valReg) = payload.pairedMatcherValue
+      let matcher = registers[matcherReg]
+      return { cpu in cpu.match(by: matcher, into: valReg) }
+
+    case .backreference:
+      let (isScalarMode, capture) = payload.captureAndMode
+      let capNum = Int(asserting: capture.rawValue)
+      return { cpu in cpu.backreference(capNum, isScalarMode: isScalarMode) }
+
+    case .beginCapture:
+      let capNum = Int(asserting: payload.capture.rawValue)
+      return { cpu in cpu.beginCapture(capNum) }
+
+    case .endCapture:
+      let capNum = Int(asserting: payload.capture.rawValue)
+      return { cpu in cpu.endCapture(capNum) }
+
+    case .transformCapture:
+      let (cap, trans) = payload.pairedCaptureTransform
+      let transform = registers[trans]
+      let capNum = Int(asserting: cap.rawValue)
+      return { cpu in cpu.transformCapture(capNum, with: transform) }
+
+    case .captureValue:
+      let (val, cap) = payload.pairedValueCapture
+      let capNum = Int(asserting: cap.rawValue)
+      return { cpu in cpu.captureValue(val, into: capNum) }
+    }
+  }
+}
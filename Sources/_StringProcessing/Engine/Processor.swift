@@ -35,7 +35,10 @@ struct Processor {
   /// Taken together, `input` and `subjectBounds` define the actual subject
   /// of the search. `input` can be a "supersequence" of the subject, while
   /// `input[subjectBounds]` is the logical entity that is being searched.
-  let input: Input
+  ///
+  /// The subject only changes when a processor is reused for another input;
+  /// see `reset(input:subjectBounds:searchBounds:matchMode:)`.
+  private(set) var input: Input
 
   /// The bounds of the logical subject in `input`.
   ///
@@ -46,16 +49,27 @@ struct Processor {
   ///
   /// `subjectBounds` is always equal to or a subrange of
   /// `input.startIndex..<input.endIndex`.
-  let subjectBounds: Range<Position>
+  private(set) var subjectBounds: Range<Position>
 
-  let matchMode: MatchMode
+  private(set) var matchMode: MatchMode
 
   let instructions: InstructionList<Instruction>
 
+  /// The program's instructions lowered to closures, if it has them.
+  let threadedCode: ThreadedCode?
+
+  /// The number of steps after which a search throws, if any.
+  let stepLimit: Int?
+
+  /// The memoization row of each instruction, if the program can be
+  /// memoized.
+  let memoRows: [Int]?
+
   // MARK: Update-only state
 
-  var wordIndexCache: Set<String.Index>? = nil
-  var wordIndexMaxIndex: String.Index? = nil
+  var wordBoundaryCache = WordBoundaryCache()
+
+  var graphemeBreakCache = GraphemeBreakCache()
 
   // MARK: Resettable state
 
@@ -82,6 +96,10 @@ struct Processor {
 
   var savePoints: [SavePoint] = []
 
+  /// Previous values of captures and registers that were modified while a
+  /// save point was live, for restoring when backtracking.
+  var trail: [TrailEntry] = []
+
   var storedCaptures: Array<_StoredCapture>
 
   var state: State = .inProgress
@@ -89,6 +107,31 @@ struct Processor {
   var failureReason: Error? = nil
 
   var metrics: ProcessorMetrics
+
+  /// The counts for a profiled regex, merged into its profile once the
+  /// processor is done.
+  var profileCounts: ProfileCounts?
+
+  // MARK: Per-search state
+  //
+  // Kept when resetting to try a later start position, and reset along with
+  // the search bounds.
+
+  /// The steps taken in this search, as of the last check of the budget.
+  var stepsTaken = 0
+
+  /// The steps between the last check of the budget and the next one.
+  var stepsBeforeCheck = 0
+
+  /// The steps left until the next check of the budget.
+  var stepsUntilCheck = 0
+
+  /// The visited (instruction, position) pairs, once memoization is on.
+  var memo: Memo? = nil
+
+  /// The value of `stepsTaken` at which the search stops so that its caller
+  /// can check whether there's a match at all, if it will.
+  var existenceCheckSteps: Int? = nil
 }
 
 extension Processor {
@@ -111,6 +154,9 @@ extension Processor {
   ) {
     self.controller = Controller(pc: 0)
     self.instructions = program.instructions
+    self.threadedCode = program.threadedCode
+    self.stepLimit = program.stepLimit
+    self.memoRows = program.memoRows
     self.input = input
     self.subjectBounds = subjectBounds
     self.searchBounds = searchBounds
@@ -119,6 +165,9 @@ extension Processor {
     self.metrics = ProcessorMetrics(
       isTracingEnabled: program.enableTracing,
       shouldMeasureMetrics: program.enableMetrics)
+    self.profileCounts = program.profile.map {
+      ProfileCounts(profile: $0, instructionCount: program.instructions.count)
+    }
 
     self.currentPosition = searchBounds.lowerBound
 
@@ -127,6 +176,7 @@ extension Processor {
 
     self.storedCaptures = program.storedCaptures
 
+    resetStepBudget()
     _checkInvariants()
   }
 
@@ -134,8 +184,13 @@ extension Processor {
     currentPosition: Position,
     searchBounds: Range<Position>
   ) {
+    // Trying a later start position continues the same search, whose
+    // earlier attempts all failed.
+    if searchBounds != self.searchBounds || state == .accept {
+      self.searchBounds = searchBounds
+      resetStepBudget()
+    }
     self.currentPosition = currentPosition
-    self.searchBounds = searchBounds
 
     self.controller = Controller(pc: 0)
 
@@ -144,6 +199,9 @@ extension Processor {
     if !self.savePoints.isEmpty {
       self.savePoints.removeAll(keepingCapacity: true)
     }
+    if !self.trail.isEmpty {
+      self.trail.removeAll(keepingCapacity: true)
+    }
 
     for idx in storedCaptures.indices {
       storedCaptures[idx] = .init()
@@ -156,12 +214,34 @@ extension Processor {
     _checkInvariants()
   }
 
+  /// Points the processor at a new subject, keeping the storage that it has
+  /// already allocated for save points, captures, and registers.
+  mutating func reset(
+    input: Input,
+    subjectBounds: Range<Position>,
+    searchBounds: Range<Position>,
+    matchMode: MatchMode
+  ) {
+    self.input = input
+    self.subjectBounds = subjectBounds
+    self.searchBounds = searchBounds
+    self.matchMode = matchMode
+
+    // The update-only state describes the old subject.
+    wordBoundaryCache.removeAll()
+    graphemeBreakCache.removeAll()
+
+    resetStepBudget()
+    reset(currentPosition: searchBounds.lowerBound, searchBounds: searchBounds)
+  }
+
   // Check that resettable state has been reset. Note that `reset()`
   // takes a new current position and search bounds.
   func isReset() -> Bool {
     _checkInvariants()
     guard self.controller == Controller(pc: 0),
           self.savePoints.isEmpty,
+          self.trail.isEmpty,
           self.storedCaptures.allSatisfy({ $0.range == nil }),
           self.state == .inProgress,
           self.failureReason == nil
@@ -321,13 +401,15 @@ extension Processor {
   // TODO: bytes should be a Span or RawSpan
   mutating func matchUTF8(
     _ bytes: Array<UInt8>,
-    boundaryCheck: Bool
+    boundaryCheck: Bool,
+    isCaseInsensitive: Bool
   ) -> Bool {
     guard let next = input.matchUTF8(
       bytes,
       at: currentPosition,
       limitedBy: end,
-      boundaryCheck: boundaryCheck
+      boundaryCheck: boundaryCheck,
+      isCaseInsensitive: isCaseInsensitive
     ) else {
       signalFailure()
       return false
@@ -336,6 +418,42 @@ extension Processor {
     return true
   }
 
+  // Match the alternatives in the trie, continuing with the first that
+  // matches and leaving save points for the others
+  mutating func matchLiteralTrie(_ trie: LiteralTrie) -> Bool {
+    var first: (literal: Int, end: Position)? = nil
+    var others: [(literal: Int, end: Position)] = []
+    input.forEachLiteralMatch(
+      in: trie, at: currentPosition, limitedBy: end
+    ) { literal, end in
+      if first == nil {
+        first = (literal, end)
+      } else {
+        others.append((literal, end))
+      }
+    }
+    guard var next = first else {
+      signalFailure()
+      return false
+    }
+
+    // Matches are found from shortest to longest, but are tried in
+    // alternative order, so the save point for the second alternative has
+    // to be on top.
+    if !others.isEmpty {
+      others.append(next)
+      others.sort { $0.literal > $1.literal }
+      next = others.removeLast()
+      for other in others {
+        var sp = makeSavePoint(resumingAt: controller.pc + 1)
+        sp.pos = other.end
+        savePoints.append(sp)
+      }
+    }
+    currentPosition = next.end
+    return true
+  }
+
   // If we have a bitset we know that the CharacterClass only matches against
   // ascii characters, so check if the current input element is ascii then
   // check if it is set in the bitset
@@ -377,13 +495,10 @@ extension Processor {
       state = .fail
       return
     }
-    let (pc, pos, capEnds, intRegisters, posRegisters): (
-      pc: InstructionAddress,
-      pos: Position?,
-      captureEnds: [_StoredCapture],
-      intRegisters: [Int],
-      PositionRegister: [Input.Index]
-    )
+    let savePoint: SavePoint
+    if _slowPath(profileCounts != nil) {
+      profileCounts!.recordBacktrack(at: controller.pc)
+    }
 
     let idx = savePoints.index(before: savePoints.endIndex)
 
@@ -391,22 +506,16 @@ extension Processor {
     // pos instead of removing it
     if savePoints[idx].isQuantified {
       savePoints[idx].takePositionFromQuantifiedRange(input)
-      (pc, pos, capEnds, intRegisters, posRegisters) = savePoints[idx].destructure
+      savePoint = savePoints[idx]
     } else {
-      (pc, pos, capEnds, intRegisters, posRegisters) = savePoints.removeLast().destructure
+      savePoint = savePoints.removeLast()
     }
 
-    assert(capEnds.count == storedCaptures.count)
-
-    controller.pc = pc
-    currentPosition = pos ?? currentPosition
-    registers.ints = intRegisters
-    registers.positions = posRegisters
-
-    if !preservingCaptures {
-      // Reset all capture information
-      storedCaptures = capEnds
-    }
+    controller.pc = savePoint.pc
+    currentPosition = savePoint.pos ?? currentPosition
+    unwindTrail(
+      to: savePoint.trailHeight, preservingCaptures: preservingCaptures)
+    trimTrail()
 
     metrics.addBacktrack()
   }
@@ -435,6 +544,7 @@ extension Processor {
   mutating func clearThrough(_ address: InstructionAddress) {
     while let sp = savePoints.popLast() {
       if sp.pc == address {
+        trimTrail()
         controller.step()
         return
       }
@@ -443,6 +553,197 @@ extension Processor {
     fatalError("Invalid code: Tried to clear save points when empty")
   }
 
+  // MARK: Instructions
+  //
+  // Each of these runs an instruction whose operands have been decoded, for
+  // `cycle()` and for threaded code, which decodes them once ahead of time.
+  // The instructions that match input use the match functions above.
+
+  @inline(__always)
+  mutating func moveImmediate(_ int: Int, into reg: IntRegister) {
+    setRegister(reg, to: int)
+    controller.step()
+  }
+
+  @inline(__always)
+  mutating func moveCurrentPosition(into reg: PositionRegister) {
+    setRegister(reg, to: currentPosition)
+    controller.step()
+  }
+
+  @inline(__always)
+  mutating func restorePosition(from reg: PositionRegister) {
+    currentPosition = registers[reg]
+    controller.step()
+  }
+
+  @inline(__always)
+  mutating func condBranch(
+    to addr: InstructionAddress, ifZeroElseDecrement reg: IntRegister
+  ) {
+    let count = registers[reg]
+    if count == 0 {
+      controller.pc = addr
+    } else {
+      setRegister(reg, to: count - 1)
+      controller.step()
+    }
+  }
+
+  @inline(__always)
+  mutating func condBranch(
+    to addr: InstructionAddress, ifSamePositionAs reg: PositionRegister
+  ) {
+    if registers[reg] == currentPosition {
+      controller.pc = addr
+    } else {
+      controller.step()
+    }
+  }
+
+  @inline(__always)
+  mutating func save(resumingAt addr: InstructionAddress) {
+    let sp = makeSavePoint(resumingAt: addr)
+    savePoints.append(sp)
+    controller.step()
+  }
+
+  @inline(__always)
+  mutating func saveAddress(resumingAt addr: InstructionAddress) {
+    let sp = makeAddressOnlySavePoint(resumingAt: addr)
+    savePoints.append(sp)
+    controller.step()
+  }
+
+  @inline(__always)
+  mutating func split(
+    to nextPC: InstructionAddress, saving resumeAddr: InstructionAddress
+  ) {
+    let sp = makeSavePoint(resumingAt: resumeAddr)
+    savePoints.append(sp)
+    controller.pc = nextPC
+  }
+
+  @inline(__always)
+  mutating func clear() {
+    if let _ = savePoints.popLast() {
+      trimTrail()
+      controller.step()
+    } else {
+      // TODO: What should we do here?
+      fatalError("Invalid code: Tried to clear save points when empty")
+    }
+  }
+
+  @inline(__always)
+  mutating func advance(_ distance: Distance, isScalarDistance: Bool) {
+    let advanced = isScalarDistance
+      ? consumeScalar(distance)
+      : consume(distance)
+    if advanced {
+      controller.step()
+    }
+  }
+
+  mutating func consume(by consumer: MEProgram.ConsumeFunction) {
+    guard currentPosition < searchBounds.upperBound,
+          let nextIndex = consumer(input, currentPosition..<searchBounds.upperBound),
+          nextIndex <= end
+    else {
+      signalFailure()
+      return
+    }
+    resume(at: nextIndex)
+    controller.step()
+  }
+
+  mutating func checkAssertion(_ payload: AssertionPayload) {
+    do {
+      guard try builtinAssert(by: payload) else {
+        signalFailure()
+        return
+      }
+    } catch {
+      abort(error)
+      return
+    }
+    controller.step()
+  }
+
+  mutating func match(
+    by matcher: MEProgram.MatcherFunction, into valReg: ValueRegister
+  ) {
+    do {
+      guard let (nextIdx, val) = try matcher(
+        input, currentPosition, searchBounds
+      ), nextIdx <= end else {
+        signalFailure()
+        return
+      }
+      registers[valReg] = val
+      resume(at: nextIdx)
+      controller.step()
+    } catch {
+      abort(error)
+    }
+  }
+
+  mutating func backreference(_ capNum: Int, isScalarMode: Bool) {
+    guard capNum < storedCaptures.count else {
+      fatalError("Should this be an assert?")
+    }
+    // TODO:
+    //   Should we assert it's not finished yet?
+    //   What's the behavior there?
+    let cap = storedCaptures[capNum]
+    guard let range = cap.range else {
+      signalFailure()
+      return
+    }
+    if matchSeq(input[range], isScalarSemantics: isScalarMode) {
+      controller.step()
+    }
+  }
+
+  @inline(__always)
+  mutating func beginCapture(_ capNum: Int) {
+    trailCapture(capNum)
+    storedCaptures[capNum].startCapture(currentPosition)
+    controller.step()
+  }
+
+  @inline(__always)
+  mutating func endCapture(_ capNum: Int) {
+    trailCapture(capNum)
+    storedCaptures[capNum].endCapture(currentPosition)
+    controller.step()
+  }
+
+  mutating func transformCapture(
+    _ capNum: Int, with transform: MEProgram.TransformFunction
+  ) {
+    do {
+      // FIXME: Pass input or the slice?
+      guard let value = try transform(input, storedCaptures[capNum]) else {
+        signalFailure()
+        return
+      }
+      trailCapture(capNum)
+      storedCaptures[capNum].registerValue(value)
+      controller.step()
+    } catch {
+      abort(error)
+    }
+  }
+
+  @inline(__always)
+  mutating func captureValue(_ valReg: ValueRegister, into capNum: Int) {
+    let value = registers[valReg]
+    trailCapture(capNum)
+    storedCaptures[capNum].registerValue(value)
+    controller.step()
+  }
+
   mutating func cycle() {
     _checkInvariants()
     assert(state == .inProgress)
@@ -459,60 +760,32 @@ extension Processor {
       let (imm, reg) = payload.pairedImmediateInt
       let int = Int(asserting: imm)
       assert(int == imm)
-
-      registers[reg] = int
-      controller.step()
+      moveImmediate(int, into: reg)
     case .moveCurrentPosition:
-      let reg = payload.position
-      registers[reg] = currentPosition
-      controller.step()
+      moveCurrentPosition(into: payload.position)
     case .restorePosition:
-      let reg = payload.position
-      currentPosition = registers[reg]
-      controller.step()
+      restorePosition(from: payload.position)
     case .branch:
       controller.pc = payload.addr
 
     case .condBranchZeroElseDecrement:
       let (addr, int) = payload.pairedAddrInt
-      if registers[int] == 0 {
-        controller.pc = addr
-      } else {
-        registers[int] -= 1
-        controller.step()
-      }
+      condBranch(to: addr, ifZeroElseDecrement: int)
     case .condBranchSamePosition:
       let (addr, pos) = payload.pairedAddrPos
-      if registers[pos] == currentPosition {
-        controller.pc = addr
-      } else {
-        controller.step()
-      }
+      condBranch(to: addr, ifSamePositionAs: pos)
     case .save:
-      let resumeAddr = payload.addr
-      let sp = makeSavePoint(resumingAt: resumeAddr)
-      savePoints.append(sp)
-      controller.step()
+      save(resumingAt: payload.addr)
 
     case .saveAddress:
-      let resumeAddr = payload.addr
-      let sp = makeAddressOnlySavePoint(resumingAt: resumeAddr)
-      savePoints.append(sp)
-      controller.step()
+      saveAddress(resumingAt: payload.addr)
 
     case .splitSaving:
       let (nextPC, resumeAddr) = payload.pairedAddrAddr
-      let sp = makeSavePoint(resumingAt: resumeAddr)
-      savePoints.append(sp)
-      controller.pc = nextPC
+      split(to: nextPC, saving: resumeAddr)
 
     case .clear:
-      if let _ = savePoints.popLast() {
-        controller.step()
-      } else {
-        // TODO: What should we do here?
-        fatalError("Invalid code: Tried to clear save points when empty")
-      }
+      clear()
 
     case .clearThrough:
       clearThrough(payload.addr)
@@ -526,15 +799,7 @@ extension Processor {
 
     case .advance:
       let (isScalar, distance) = payload.distance
-      if isScalar {
-        if consumeScalar(distance) {
-          controller.step()
-        }
-      } else {
-        if consume(distance) {
-          controller.step()
-        }
-      }
+      advance(distance, isScalarDistance: isScalar)
     case .matchAnyNonNewline:
       if matchAnyNonNewline(isScalarSemantics: payload.isScalar) {
         controller.step()
@@ -556,14 +821,23 @@ extension Processor {
       }
 
     case .matchUTF8:
-      let (utf8Reg, boundaryCheck) = payload.matchUTF8Payload
+      let (utf8Reg, boundaryCheck, isCaseInsensitive) =
+        payload.matchUTF8Payload
       let utf8Content = registers[utf8Reg]
       if matchUTF8(
-        utf8Content, boundaryCheck: boundaryCheck
+        utf8Content,
+        boundaryCheck: boundaryCheck,
+        isCaseInsensitive: isCaseInsensitive
       ) {
         controller.step()
       }
 
+    case .matchLiteralTrie:
+      let trie = registers[payload.literalTrie]
+      if matchLiteralTrie(trie) {
+        controller.step()
+      }
+
     case .matchBitset:
       let (isScalar, reg) = payload.bitsetPayload
       let bitset = registers[reg]
@@ -587,104 +861,40 @@ extension Processor {
       }
 
     case .consumeBy:
-      let reg = payload.consumer
-      let consumer = registers[reg]
-      guard currentPosition < searchBounds.upperBound,
-            let nextIndex = consumer(input, currentPosition..<searchBounds.upperBound),
-            nextIndex <= end
-      else {
-        signalFailure()
-        return
-      }
-      resume(at: nextIndex)
-      controller.step()
+      consume(by: registers[payload.consumer])
 
     case .assertBy:
-      let payload = payload.assertion
-      do {
-        guard try builtinAssert(by: payload) else {
-          signalFailure()
-          return
-        }
-      } catch {
-        abort(error)
-        return
-      }
-      controller.step()
+      checkAssertion(payload.assertion)
 
     case .matchBy:
       let (matcherReg, valReg) = payload.pairedMatcherValue
-      let matcher = registers[matcherReg]
-      do {
-        guard let (nextIdx, val) = try matcher(
-          input, currentPosition, searchBounds
-        ), nextIdx <= end else {
-          signalFailure()
-          return
-        }
-        registers[valReg] = val
-        resume(at: nextIdx)
-        controller.step()
-      } catch {
-        abort(error)
-        return
-      }
+      match(by: registers[matcherReg], into: valReg)
 
     case .backreference:
       let (isScalarMode, capture) = payload.captureAndMode
       let capNum = Int(
         asserting: capture.rawValue)
-      guard capNum < storedCaptures.count else {
-        fatalError("Should this be an assert?")
-      }
-      // TODO:
-      //   Should we assert it's not finished yet?
-      //   What's the behavior there?
-      let cap = storedCaptures[capNum]
-      guard let range = cap.range else {
-        signalFailure()
-        return
-      }
-      if matchSeq(input[range], isScalarSemantics: isScalarMode) {
-        controller.step()
-      }
+      backreference(capNum, isScalarMode: isScalarMode)
 
     case .beginCapture:
       let capNum = Int(
         asserting: payload.capture.rawValue)
-      storedCaptures[capNum].startCapture(currentPosition)
-      controller.step()
+      beginCapture(capNum)
 
     case .endCapture:
       let capNum = Int(
         asserting: payload.capture.rawValue)
-      storedCaptures[capNum].endCapture(currentPosition)
-      controller.step()
+      endCapture(capNum)
 
     case .transformCapture:
       let (cap, trans) = payload.pairedCaptureTransform
-      let transform = registers[trans]
       let capNum = Int(asserting: cap.rawValue)
-
-      do {
-        // FIXME: Pass input or the slice?
-        guard let value = try transform(input, storedCaptures[capNum]) else {
-          signalFailure()
-          return
-        }
-        storedCaptures[capNum].registerValue(value)
-        controller.step()
-      } catch {
-        abort(error)
-        return
-      }
+      transformCapture(capNum, with: registers[trans])
 
     case .captureValue:
       let (val, cap) = payload.pairedValueCapture
-      let value = registers[val]
       let capNum = Int(asserting: cap.rawValue)
-      storedCaptures[capNum].registerValue(value)
-      controller.step()
+      captureValue(val, into: capNum)
     }
   }
 }
@@ -707,7 +917,7 @@ extension String {
     else { return nil }
 
     if isCaseInsensitive {
-      guard stringChar.lowercased() == char.lowercased() else { return nil }
+      guard stringChar.caseFoldedEquals(char) else { return nil }
     } else {
       guard stringChar == char else { return nil }
     }
@@ -756,7 +966,8 @@ extension String {
     let curScalar = unicodeScalars[pos]
 
     if isCaseInsensitive {
-      guard curScalar.properties.lowercaseMapping == scalar.properties.lowercaseMapping
+      guard curScalar == scalar
+              || curScalar.simpleCaseFolded == scalar.simpleCaseFolded
       else {
         return nil
       }
@@ -778,12 +989,19 @@ extension String {
     _ bytes: Array<UInt8>,
     at pos: Index,
     limitedBy end: Index,
-    boundaryCheck: Bool
+    boundaryCheck: Bool,
+    isCaseInsensitive: Bool = false
   ) -> Index? {
     var cur = pos
-    for b in bytes {
-      guard cur < end, self.utf8[cur] == b else { return nil }
-      self.utf8.formIndex(after: &cur)
+    if isCaseInsensitive {
+      guard let next = matchCaseFoldedASCII(bytes, at: pos, limitedBy: end)
+      else { return nil }
+      cur = next
+    } else {
+      for b in bytes {
+        guard cur < end, self.utf8[cur] == b else { return nil }
+        self.utf8.formIndex(after: &cur)
+      }
     }
 
     guard cur <= end else { return nil }
@@ -795,6 +1013,33 @@ extension String {
     return cur
   }
 
+  /// Matches the case-folded ASCII `bytes` against the simple case folding
+  /// of the input's scalars.
+  ///
+  /// ASCII input is folded a byte at a time. The only other scalars that
+  /// fold to ASCII are LONG S and KELVIN SIGN, so any other non-ASCII input
+  /// fails without being decoded.
+  func matchCaseFoldedASCII(
+    _ bytes: Array<UInt8>,
+    at pos: Index,
+    limitedBy end: Index
+  ) -> Index? {
+    var cur = pos
+    for b in bytes {
+      guard cur < end else { return nil }
+      let byte = self.utf8[cur]
+      if byte._asciiLowercased == b {
+        self.utf8.formIndex(after: &cur)
+        continue
+      }
+      guard !byte._isASCII, b == UInt8(ascii: "k") || b == UInt8(ascii: "s"),
+            unicodeScalars[cur].simpleCaseFolded.value == UInt32(b)
+      else { return nil }
+      self.unicodeScalars.formIndex(after: &cur)
+    }
+    return cur
+  }
+
   func matchASCIIBitset(
     _ bitset: DSLTree.CustomCharacterClass.AsciiBitset,
     at pos: Index,
@@ -0,0 +1,56 @@
+//===----------------------------------------------------------------------===//
+//
+// This source file is part of the Swift.org open source project
+//
+// Copyright (c) 2025 Apple Inc. and the Swift project authors
+// Licensed under Apache License v2.0 with Runtime Library Exception
+//
+// See https://swift.org/LICENSE.txt for license information
+//
+//===----------------------------------------------------------------------===//
+
+extension Processor {
+  /// The counts a processor records for a profiled regex.
+  ///
+  /// The counts are kept apart from the profile while the processor runs,
+  /// so that recording a step doesn't take a lock, and are merged into the
+  /// profile when the processor is released.
+  final class ProfileCounts {
+    let profile: ProfileRecorder
+
+    /// The number of times each instruction was dispatched.
+    var steps: [Int]
+    /// The number of times matching failed at each instruction.
+    var backtracks: [Int]
+    /// The most save points there were right after each instruction ran.
+    var maxSavePoints: [Int]
+    /// The number of positions a match was tried from.
+    var matchAttempts = 0
+
+    init(profile: ProfileRecorder, instructionCount: Int) {
+      self.profile = profile
+      self.steps = Array(repeating: 0, count: instructionCount)
+      self.backtracks = Array(repeating: 0, count: instructionCount)
+      self.maxSavePoints = Array(repeating: 0, count: instructionCount)
+    }
+
+    deinit {
+      profile.merge(self)
+    }
+
+    func recordBacktrack(at pc: InstructionAddress) {
+      backtracks[pc.rawValue] += 1
+    }
+  }
+
+  /// Runs one instruction, counting it in `profileCounts`.
+  mutating func profiledCycle() {
+    let pc = controller.pc.rawValue
+    let counts = profileCounts.unsafelyUnwrapped
+    counts.steps[pc] += 1
+    cycle()
+    if savePoints.count > counts.maxSavePoints[pc] {
+      counts.maxSavePoints[pc] = savePoints.count
+    }
+  }
+}
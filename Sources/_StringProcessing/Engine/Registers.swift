@@ -29,6 +29,10 @@ extension Processor {
 
     var bitsets: [DSLTree.CustomCharacterClass.AsciiBitset]
 
+    var scalarRunSets: [ScalarRunSet]
+
+    var literalTries: [LiteralTrie]
+
     var consumeFunctions: [MEProgram.ConsumeFunction]
 
     // Captured-value constructors
@@ -52,6 +56,8 @@ extension Processor {
       elements: [Element],
       utf8Contents: [[UInt8]],
       bitsets: [DSLTree.CustomCharacterClass.AsciiBitset],
+      scalarRunSets: [ScalarRunSet],
+      literalTries: [LiteralTrie],
       consumeFunctions: [MEProgram.ConsumeFunction],
       transformFunctions: [MEProgram.TransformFunction],
       matcherFunctions: [MEProgram.MatcherFunction],
@@ -63,6 +69,8 @@ extension Processor {
       self.elements = elements
       self.utf8Contents = utf8Contents
       self.bitsets = bitsets
+      self.scalarRunSets = scalarRunSets
+      self.literalTries = literalTries
       self.consumeFunctions = consumeFunctions
       self.transformFunctions = transformFunctions
       self.matcherFunctions = matcherFunctions
@@ -110,6 +118,12 @@ extension Processor.Registers {
   ) -> DSLTree.CustomCharacterClass.AsciiBitset {
     bitsets[i.rawValue]
   }
+  subscript(_ i: ScalarRunSetRegister) -> ScalarRunSet {
+    scalarRunSets[i.rawValue]
+  }
+  subscript(_ i: LiteralTrieRegister) -> LiteralTrie {
+    literalTries[i.rawValue]
+  }
   subscript(_ i: ConsumeFunctionRegister) -> MEProgram.ConsumeFunction {
     consumeFunctions[i.rawValue]
   }
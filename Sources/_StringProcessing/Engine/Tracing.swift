@@ -78,6 +78,13 @@ extension Instruction: CustomStringConvertible {
     case .matchBy:
       let (matcherReg, valReg) = payload.pairedMatcherValue
       return "\(opcode) match[\(matcherReg)] -> val[\(valReg)]"
+    case .matchLiteralTrie:
+      let reg = payload.literalTrie
+      return "\(opcode) trie[\(reg)]"
+    case .matchUTF8:
+      let (reg, boundaryCheck, isCaseInsensitive) = payload.matchUTF8Payload
+      let name = isCaseInsensitive ? "matchUTF8CaseInsensitive" : "matchUTF8"
+      return "\(name) utf8[\(reg)] boundaryCheck: \(boundaryCheck)"
     case .matchScalar:
       let (scalar, caseInsensitive, boundaryCheck) = payload.scalarPayload
       if caseInsensitive {
@@ -35,12 +35,87 @@ enum Executor<Output> {
     subjectBounds: Range<String.Index>,
     searchBounds: Range<String.Index>
   ) throws -> Regex<Output>.Match? {
-    try Executor._run(
-      program,
-      input,
+    var cpu = Processor(
+      program: program,
+      input: input,
       subjectBounds: subjectBounds,
       searchBounds: searchBounds,
-      mode: .wholeString)
+      matchMode: .wholeString)
+    var dfa: LazyDFA? = nil
+    return try Executor._wholeMatch(program, using: &cpu, lazyDFA: &dfa)
+  }
+
+  /// Returns the match of `program` covering the processor's search bounds.
+  ///
+  /// `lazyDFA` is an anchored DFA to use instead of one from the program's
+  /// cache, if it's not `nil`.
+  static func _wholeMatch(
+    _ program: MEProgram,
+    using cpu: inout Processor,
+    lazyDFA: inout LazyDFA?
+  ) throws -> Regex<Output>.Match? {
+    // The lazy DFA answers whether there's a match in linear time. Without
+    // captures, the bounds are all there is to the match.
+    if program.canUseLazyDFA && program.storedCaptures.isEmpty
+        && program.wholeMatchValueRegister == nil {
+      guard _matchExists(program, using: &cpu, lazyDFA: &lazyDFA, .anchored)
+      else { return nil }
+      return Executor._captureFreeMatch(
+        program, cpu.input, range: cpu.searchBounds)
+    }
+    guard let range = try _wholeMatchRunRange(
+      program, using: &cpu, lazyDFA: &lazyDFA)
+    else { return nil }
+    return _match(program, cpu, range: range)
+  }
+
+  /// Returns the range of the match of `program` covering the processor's
+  /// search bounds, without building its output.
+  ///
+  /// If `capturing` is true, the processor is left with the match's
+  /// captures, as it is after `_firstMatchRange`.
+  static func _wholeMatchRange(
+    _ program: MEProgram,
+    using cpu: inout Processor,
+    lazyDFA: inout LazyDFA?,
+    capturing: Bool = false
+  ) throws -> Range<String.Index>? {
+    if program.canUseLazyDFA
+        && (!capturing || program.storedCaptures.isEmpty) {
+      guard _matchExists(program, using: &cpu, lazyDFA: &lazyDFA, .anchored)
+      else { return nil }
+      return cpu.searchBounds
+    }
+    return try _wholeMatchRunRange(program, using: &cpu, lazyDFA: &lazyDFA)
+  }
+
+  /// Runs the processor over its search bounds, interrupting it to check
+  /// with the lazy DFA whether there's a match at all once it has taken as
+  /// many steps as there are code units to match.
+  ///
+  /// A match that's found in fewer steps costs a single pass, and the
+  /// check never costs more than the backtracking before it.
+  static func _wholeMatchRunRange(
+    _ program: MEProgram,
+    using cpu: inout Processor,
+    lazyDFA: inout LazyDFA?
+  ) throws -> Range<String.Index>? {
+    guard program.canUseLazyDFA else {
+      return try _runRange(&cpu)
+    }
+    cpu.existenceCheckSteps = cpu.stepsTaken + cpu.input.utf8.distance(
+      from: cpu.currentPosition, to: cpu.searchBounds.upperBound)
+    defer { cpu.existenceCheckSteps = nil }
+    do {
+      return try _runRange(&cpu)
+    } catch is Processor.ExistenceCheckRequested {
+      cpu.reset(
+        currentPosition: cpu.searchBounds.lowerBound,
+        searchBounds: cpu.searchBounds)
+      guard _matchExists(program, using: &cpu, lazyDFA: &lazyDFA, .anchored)
+      else { return nil }
+      return try _runRange(&cpu)
+    }
   }
 
   static func firstMatch(
@@ -55,22 +130,159 @@ enum Executor<Output> {
       subjectBounds: subjectBounds,
       searchBounds: searchBounds,
       matchMode: .partialFromFront)
+    var dfa: LazyDFA? = nil
     return try Executor._firstMatch(
       program,
-      using: &cpu)
+      using: &cpu,
+      lazyDFA: &dfa)
+  }
+
+  /// Returns whether the program matches anywhere in `searchBounds`.
+  static func containsMatch(
+    _ program: MEProgram,
+    _ input: String,
+    subjectBounds: Range<String.Index>,
+    searchBounds: Range<String.Index>
+  ) throws -> Bool {
+    var cpu = Processor(
+      program: program,
+      input: input,
+      subjectBounds: subjectBounds,
+      searchBounds: searchBounds,
+      matchMode: .partialFromFront)
+    var dfa: LazyDFA? = nil
+    guard program.canUseLazyDFA else {
+      return try Executor._firstMatch(
+        program, using: &cpu, lazyDFA: &dfa) != nil
+    }
+    if let p = program.prefilter,
+       !p.requiredLiteralExists(in: input, searchBounds) {
+      return false
+    }
+    return _matchExists(
+      program, using: &cpu, lazyDFA: &dfa, _searchingMode(program))
+  }
+
+  /// Returns a lazy DFA for finding the first match of `program`, if the
+  /// program can use one.
+  static func _searchingLazyDFA(_ program: MEProgram) -> LazyDFA? {
+    LazyDFA(program, mode: _searchingMode(program))
+  }
+
+  /// Returns the mode of the lazy DFA that finds the first match of
+  /// `program`.
+  static func _searchingMode(_ program: MEProgram) -> LazyDFA.Mode {
+    program.canOnlyMatchAtStart ? .anchored : .search
   }
 
+  /// Returns whether `program` matches from the processor's current
+  /// position, as `LazyDFA.matchExists(_:)` does, with `lazyDFA` if it's not
+  /// `nil` or with a DFA from the program's cache.
+  ///
+  /// The program must be able to use a lazy DFA.
+  static func _matchExists(
+    _ program: MEProgram,
+    using cpu: inout Processor,
+    lazyDFA: inout LazyDFA?,
+    _ mode: LazyDFA.Mode
+  ) -> Bool {
+    if lazyDFA != nil {
+      return lazyDFA!.matchExists(&cpu)
+    }
+    var dfa = program.lazyDFAs?.take(mode) ?? LazyDFA(program, mode: mode)!
+    defer { program.lazyDFAs?.putBack(dfa) }
+    return dfa.matchExists(&cpu)
+  }
+
+  /// Returns the first match of `program` beginning at or after the
+  /// processor's current position.
+  ///
+  /// `lazyDFA` is a searching DFA to use instead of one from the program's
+  /// cache, if it's not `nil`.
+  ///
+  /// If `startLimit` is given, only positions up to `startLimit` are tried
+  /// as the start of a match, though a match can extend past it. Checks that
+  /// would scan the rest of the search bounds are skipped in that case, so
+  /// the cost stays proportional to the distance to `startLimit`.
   static func _firstMatch(
     _ program: MEProgram,
-    using cpu: inout Processor
+    using cpu: inout Processor,
+    lazyDFA: inout LazyDFA?,
+    startLimit: String.Index? = nil
   ) throws -> Regex<Output>.Match? {
+    guard let range = try _firstMatchRange(
+      program, using: &cpu, lazyDFA: &lazyDFA, startLimit: startLimit)
+    else { return nil }
+    return _match(program, cpu, range: range)
+  }
+
+  /// Returns the range of the first match of `program`, as `_firstMatch`
+  /// does, without building its output.
+  ///
+  /// The processor is left in the state it reached at the end of the match,
+  /// with its captures and registers.
+  static func _firstMatchRange(
+    _ program: MEProgram,
+    using cpu: inout Processor,
+    lazyDFA: inout LazyDFA?,
+    startLimit: String.Index? = nil
+  ) throws -> Range<String.Index>? {
     let isGraphemeSemantic = program.initialOptions.semanticLevel == .graphemeCluster
 
     var low = cpu.searchBounds.lowerBound
-    let high = cpu.searchBounds.upperBound
+    let high = startLimit ?? cpu.searchBounds.upperBound
+    guard low <= high else { return nil }
+
+    // Fast-path for a literal that every match must contain, and skip ahead
+    // to the first position where a match could begin.
+    let prefilter = _skippingPrefilter(program, cpu.input, low)
+    if startLimit == nil, let p = program.prefilter,
+       !p.requiredLiteralExists(in: cpu.input, low..<high) {
+      return nil
+    }
+
+    // Once backtracking has taken as many steps as there are code units left
+    // to search, rule out inputs without a match in linear time, before it
+    // has the chance to take exponential time. Searches that find a match
+    // sooner, such as most of those in `matches(of:)`, never scan ahead.
+    if startLimit == nil, program.canUseLazyDFA {
+      cpu.existenceCheckSteps = cpu.stepsTaken + cpu.input.utf8.distance(
+        from: low, to: cpu.searchBounds.upperBound)
+    }
+    defer { cpu.existenceCheckSteps = nil }
+
+    // A candidate's prefix can extend past the last start position.
+    let candidateHigh = startLimit.map {
+      cpu.input.utf8.index(
+        $0,
+        offsetBy: prefilter?.prefix.count ?? 0,
+        limitedBy: cpu.searchBounds.upperBound) ?? cpu.searchBounds.upperBound
+    } ?? high
+    if let prefilter {
+      guard let next = prefilter.nextCandidate(
+        in: cpu.input, low..<candidateHigh,
+        isScalarSemantics: !isGraphemeSemantic),
+        next <= high
+      else { return nil }
+      if next != low {
+        low = next
+        cpu.reset(currentPosition: low, searchBounds: cpu.searchBounds)
+      }
+    }
+
     while true {
-      if let m = try Executor._run(program, &cpu) {
-        return m
+      let range: Range<String.Index>?
+      do {
+        range = try Executor._runRange(&cpu)
+      } catch is Processor.ExistenceCheckRequested {
+        cpu.reset(currentPosition: low, searchBounds: cpu.searchBounds)
+        guard _matchExists(
+          program, using: &cpu, lazyDFA: &lazyDFA, _searchingMode(program))
+        else { return nil }
+        continue
+      }
+      if let range {
+        return range
       }
       // Fast-path for start-anchored regex
       if program.canOnlyMatchAtStart {
@@ -78,16 +290,50 @@ enum Executor<Output> {
       }
       if low == high { return nil }
       if isGraphemeSemantic {
-        cpu.input.formIndex(after: &low)
+        low = cpu.input.index(after: low, using: &cpu.graphemeBreakCache)
       } else {
         cpu.input.unicodeScalars.formIndex(after: &low)
       }
       guard low <= high else {
         return nil
       }
+      if let prefilter {
+        guard let next = prefilter.nextCandidate(
+          in: cpu.input, low..<candidateHigh,
+          isScalarSemantics: !isGraphemeSemantic),
+          next <= high
+        else { return nil }
+        low = next
+      }
       cpu.reset(currentPosition: low, searchBounds: cpu.searchBounds)
     }
   }
+
+  /// Returns the program's prefilter if it can be used to move the start
+  /// position of a search beginning at `low`.
+  ///
+  /// Candidate positions are only reachable by advancing one character (or
+  /// scalar) at a time when `low` is itself aligned to a character (or
+  /// scalar) boundary, which isn't true for some substring inputs.
+  private static func _skippingPrefilter(
+    _ program: MEProgram,
+    _ input: String,
+    _ low: String.Index
+  ) -> MEProgram.Prefilter? {
+    guard let prefilter = program.prefilter,
+          prefilter.canSkipAhead,
+          !program.canOnlyMatchAtStart
+    else { return nil }
+    switch program.initialOptions.semanticLevel {
+    case .graphemeCluster:
+      guard input.isOnGraphemeClusterBoundary(low) else { return nil }
+    case .unicodeScalar:
+      guard String.Index(low, within: input.unicodeScalars) != nil else {
+        return nil
+      }
+    }
+    return prefilter
+  }
 }
 
 @available(SwiftStdlib 5.7, *)
@@ -118,9 +364,14 @@ extension Executor {
 }
 
 @available(SwiftStdlib 5.7, *)
-extension Executor.Matches.Iterator {
-  func nextSearchIndex(
-    after range: Range<String.Index>
+extension Executor {
+  /// Returns the position to resume searching from after a match covering
+  /// `range`, or `nil` if the search is finished.
+  static func _nextSearchIndex(
+    after range: Range<String.Index>,
+    _ program: MEProgram,
+    _ input: String,
+    _ subjectBounds: Range<String.Index>
   ) -> String.Index? {
     if !range.isEmpty {
       return range.upperBound
@@ -128,25 +379,49 @@ extension Executor.Matches.Iterator {
 
     // If the last match was an empty match, advance by one position and
     // run again, unless at the end of `input`.
-    guard range.lowerBound < processor.subjectBounds.upperBound else {
+    guard range.lowerBound < subjectBounds.upperBound else {
       return nil
     }
 
     switch program.initialOptions.semanticLevel {
     case .graphemeCluster:
-      return processor.input.index(after: range.upperBound)
+      return input.index(after: range.upperBound)
     case .unicodeScalar:
-      return processor.input.unicodeScalars.index(after: range.upperBound)
+      return input.unicodeScalars.index(after: range.upperBound)
     }
   }
+}
+
+@available(SwiftStdlib 5.7, *)
+extension Executor.Matches.Iterator {
+  func nextSearchIndex(
+    after range: Range<String.Index>
+  ) -> String.Index? {
+    Executor._nextSearchIndex(
+      after: range, program, processor.input, processor.subjectBounds)
+  }
 
   mutating func next() -> Regex<Output>.Match? {
+    try? nextMatch()
+  }
+
+  /// Returns the next match, or throws the error that stopped the search,
+  /// such as reaching the step limit, after which there are no more
+  /// matches.
+  mutating func nextMatch() throws -> Regex<Output>.Match? {
     if finished {
       return nil
     }
-    guard let match = try? Executor._firstMatch(
-      program, using: &processor
-    ) else {
+    var lazyDFA: LazyDFA? = nil
+    let found: Regex<Output>.Match?
+    do {
+      found = try Executor._firstMatch(
+        program, using: &processor, lazyDFA: &lazyDFA)
+    } catch {
+      finished = true
+      throw error
+    }
+    guard let match = found else {
       return nil
     }
 
@@ -185,13 +460,30 @@ extension Executor {
     _ program: MEProgram,
     _ cpu: inout Processor
   ) throws -> Regex<Output>.Match? {
+    guard let range = try _runRange(&cpu) else {
+      return nil
+    }
+    return _match(program, cpu, range: range)
+  }
 
+  /// Runs the processor from its current position, returning the range of
+  /// the match it finds.
+  static func _runRange(
+    _ cpu: inout Processor
+  ) throws -> Range<String.Index>? {
     let startPosition = cpu.currentPosition
     guard let endIdx = try cpu.run() else {
       return nil
     }
-    let range = startPosition..<endIdx
+    return startPosition..<endIdx
+  }
 
+  /// Returns the match covering `range` that the processor has just found.
+  static func _match(
+    _ program: MEProgram,
+    _ cpu: Processor,
+    range: Range<String.Index>
+  ) -> Regex<Output>.Match {
     let wholeMatchValue: Any?
     if let reg = program.wholeMatchValueRegister {
       wholeMatchValue = cpu.registers[reg]
@@ -200,14 +492,33 @@ extension Executor {
     }
     let aroElements = Executor.createExistentialElements(
       program,
-      matchRange: startPosition..<endIdx,
+      matchRange: range,
       storedCaptures: cpu.storedCaptures,
       wholeMatchValue: wholeMatchValue)
 
     let anyRegexOutput = AnyRegexOutput(
       input: cpu.input, elements: aroElements)
     return .init(anyRegexOutput: anyRegexOutput, range: range)
-  }}
+  }
+
+  /// Returns the match covering `range`, for a program without captures or
+  /// a whole-match value.
+  static func _captureFreeMatch(
+    _ program: MEProgram,
+    _ input: String,
+    range: Range<String.Index>
+  ) -> Regex<Output>.Match {
+    let aroElements = Executor.createExistentialElements(
+      program,
+      matchRange: range,
+      storedCaptures: [],
+      wholeMatchValue: nil)
+
+    let anyRegexOutput = AnyRegexOutput(
+      input: input, elements: aroElements)
+    return .init(anyRegexOutput: anyRegexOutput, range: range)
+  }
+}
 
 extension Processor {
   fileprivate mutating func run() throws -> Input.Index? {
@@ -221,17 +532,82 @@ extension Processor {
       return nil
     }
     assert(isReset())
-    while true {
-      switch self.state {
-      case .accept:
-        return self.currentPosition
-      case .fail:
-        if let e = failureReason {
-          throw e
-        }
-        return nil
-      case .inProgress: self.cycle()
+    profileCounts?.matchAttempts += 1
+
+    // Profiles count steps per instruction, which only the interpreter does.
+    let steps = profileCounts == nil ? threadedCode?.steps : nil
+    // The kind of step only changes when the budget is checked, so it's
+    // chosen once for each block of steps between checks.
+    while self.state == .inProgress {
+      if stepsUntilCheck == 0 {
+        checkStepBudget()
+      } else if _slowPath(memo != nil) {
+        runMemoizedSteps(steps)
+      } else if let steps {
+        runThreadedSteps(steps)
+      } else if _slowPath(profileCounts != nil) {
+        runProfiledSteps()
+      } else {
+        runInterpretedSteps()
       }
     }
+
+    if self.state == .accept {
+      return self.currentPosition
+    }
+    if let e = failureReason {
+      throw e
+    }
+    return nil
+  }
+
+  // Each of these runs steps until the attempt ends or the budget is due to
+  // be checked. The steps are counted in a local, and what's left is stored
+  // back in `stepsUntilCheck` when they stop.
+
+  private mutating func runInterpretedSteps() {
+    var remaining = stepsUntilCheck
+    defer { stepsUntilCheck = remaining }
+    repeat {
+      remaining -= 1
+      cycle()
+    } while remaining > 0 && state == .inProgress
+  }
+
+  private mutating func runThreadedSteps(_ steps: [ThreadedCode.Step]) {
+    var remaining = stepsUntilCheck
+    defer { stepsUntilCheck = remaining }
+    repeat {
+      remaining -= 1
+      steps[controller.pc.rawValue](&self)
+    } while remaining > 0 && state == .inProgress
+  }
+
+  private mutating func runProfiledSteps() {
+    var remaining = stepsUntilCheck
+    defer { stepsUntilCheck = remaining }
+    repeat {
+      remaining -= 1
+      profiledCycle()
+    } while remaining > 0 && state == .inProgress
+  }
+
+  /// Runs steps that first check the memo, which is only on for searches
+  /// that have already taken long enough to need it.
+  private mutating func runMemoizedSteps(_ steps: [ThreadedCode.Step]?) {
+    var remaining = stepsUntilCheck
+    defer { stepsUntilCheck = remaining }
+    repeat {
+      remaining -= 1
+      if isMemoizedRevisit() {
+        signalFailure()
+      } else if let steps {
+        steps[controller.pc.rawValue](&self)
+      } else if profileCounts != nil {
+        profiledCycle()
+      } else {
+        cycle()
+      }
+    } while remaining > 0 && state == .inProgress
   }
 }
@@ -35,8 +35,16 @@ extension Regex {
   /// The value of this property may change between different releases of Swift.
   @available(SwiftStdlib 6.0, *)
   public var _literalPattern: String? {
+    program.list.literalPattern
+  }
+}
+
+extension DSLList {
+  /// The literal pattern for this list, or `nil` if it includes components
+  /// that cannot be represented in a regex literal.
+  var literalPattern: String? {
     var gen = LiteralPrinter(options: MatchingOptions())
-    var list = self.program.list.nodes[...]
+    var list = nodes[...]
     try? gen.outputList(&list)
     return gen.canonicalLiteralString
   }
@@ -63,6 +63,32 @@ extension MatchingOptions {
   }
 }
 
+// MARK: Serialization API
+extension MatchingOptions {
+  /// The raw value of each scope's options, outermost first.
+  var serializedScopes: [UInt32] {
+    stack.map(\.rawValue)
+  }
+
+  /// Creates an instance from the raw values returned by `serializedScopes`,
+  /// or returns `nil` if they don't describe valid options.
+  init?(serializedScopes: [UInt32]) {
+    let stack = serializedScopes.map(Representation.init(rawValue:))
+    guard !stack.isEmpty, stack.allSatisfy({ options in
+      options.intersection(.textSegmentOptions)
+        .rawValue.nonzeroBitCount == 1
+        && options.intersection(.semanticMatchingLevels)
+          .rawValue.nonzeroBitCount == 1
+        && options.intersection(.repetitionBehaviors)
+          .rawValue.nonzeroBitCount <= 1
+    }) else {
+      return nil
+    }
+    self.stack = stack
+    _invariantCheck()
+  }
+}
+
 // MARK: Matching behavior API
 extension MatchingOptions {
   var isCaseInsensitive: Bool {
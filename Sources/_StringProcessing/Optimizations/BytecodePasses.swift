@@ -0,0 +1,435 @@
+//===----------------------------------------------------------------------===//
+//
+// This source file is part of the Swift.org open source project
+//
+// Copyright (c) 2025 Apple Inc. and the Swift project authors
+// Licensed under Apache License v2.0 with Runtime Library Exception
+//
+// See https://swift.org/LICENSE.txt for license information
+//
+//===----------------------------------------------------------------------===//
+
+internal import _RegexParser
+
+extension MEProgram.Builder {
+  /// A transformation of the instructions emitted by codegen, run during
+  /// assembly once every instruction address has been resolved.
+  ///
+  /// A pass must not change what the program matches, or the captures and
+  /// save points it produces along the way; it can only reduce the number
+  /// of instructions the processor dispatches to get there.
+  struct OptimizationPass {
+    var name: String
+    var run: (inout MEProgram.Builder, inout [Instruction]) -> Void
+  }
+
+  /// The passes run on every program compiled with optimizations enabled,
+  /// in order.
+  static var optimizationPasses: [OptimizationPass] {
+    [
+      .init(name: "fuse literals") { $0.fuseLiterals(&$1) },
+      .init(name: "fuse quantifications") { $0.fuseQuantifications(&$1) },
+      .init(name: "thread jumps") { $0.threadJumps(&$1) },
+      .init(name: "remove dead code") { $0.removeDeadCode(&$1) },
+    ]
+  }
+
+  mutating func runOptimizationPasses(_ instructions: inout [Instruction]) {
+    for pass in Self.optimizationPasses {
+      let count = instructions.count
+      pass.run(&self, &instructions)
+      if enableTracing {
+        print("\(pass.name): \(count) -> \(instructions.count) instructions")
+      }
+    }
+  }
+}
+
+// MARK: - Passes
+
+extension MEProgram.Builder {
+  /// Replaces runs of instructions that each match a literal scalar or
+  /// UTF-8 sequence with a single `matchUTF8`.
+  ///
+  /// A grapheme boundary check in the middle of a run is only dropped when
+  /// it can't fail, i.e. between two ASCII scalars that aren't CR-LF.
+  ///
+  /// Case-insensitive ASCII scalars fuse into a case-insensitive run, which
+  /// can also take case-sensitive literals that fold to themselves.
+  mutating func fuseLiterals(_ instructions: inout [Instruction]) {
+    let isTarget = Self.addressTargets(instructions)
+    var isRemoved = Array(repeating: false, count: instructions.count)
+
+    var start = 0
+    while start < instructions.count {
+      guard let first = literal(instructions[start]) else {
+        start += 1
+        continue
+      }
+      var utf8 = first.utf8
+      var boundaryCheck = first.boundaryCheck
+      var isCaseInsensitive = first.isCaseInsensitive
+      var end = start + 1
+      while end < instructions.count, !isTarget[end],
+            let next = literal(instructions[end]),
+            !boundaryCheck
+              || Self.isAlwaysGraphemeBoundary(utf8.last!, next.utf8.first!)
+      {
+        if isCaseInsensitive != next.isCaseInsensitive {
+          let caseSensitive = isCaseInsensitive ? next.utf8 : utf8
+          guard Self.isCaseFoldingInvariant(caseSensitive) else { break }
+          isCaseInsensitive = true
+        }
+        utf8 += next.utf8
+        boundaryCheck = next.boundaryCheck
+        end += 1
+      }
+
+      if end - start > 1 {
+        instructions[start] = .init(.matchUTF8, .init(
+          utf8: utf8Contents.store(utf8),
+          boundaryCheck: boundaryCheck,
+          isCaseInsensitive: isCaseInsensitive))
+        for pc in (start + 1)..<end {
+          isRemoved[pc] = true
+        }
+        mergeLocations(of: start..<end)
+      }
+      start = end
+    }
+
+    removeInstructions(&instructions, isRemoved)
+  }
+
+  /// Folds a match of a single element into an immediately following
+  /// quantification of the same element, e.g. `\d\d*` into `\d+`.
+  mutating func fuseQuantifications(_ instructions: inout [Instruction]) {
+    let isTarget = Self.addressTargets(instructions)
+    var isRemoved = Array(repeating: false, count: instructions.count)
+
+    var pc = 0
+    while pc + 1 < instructions.count {
+      let next = instructions[pc + 1]
+      guard !isTarget[pc + 1], next.opcode == .quantify else {
+        pc += 1
+        continue
+      }
+      let quantify = next.payload.quantify
+      guard quantify.minTrips < QuantifyPayload.maxStorableTrips,
+            matchesOneTrip(instructions[pc], of: quantify)
+      else {
+        pc += 1
+        continue
+      }
+
+      instructions[pc] = .init(.quantify, .init(quantify: QuantifyPayload(
+        rawValue: quantify.rawValue + (1 &<< QuantifyPayload.minTripsShift))))
+      isRemoved[pc + 1] = true
+      mergeLocations(of: pc..<(pc + 2))
+      pc += 2
+    }
+
+    removeInstructions(&instructions, isRemoved)
+  }
+
+  /// Retargets jumps that land on an unconditional branch to that branch's
+  /// destination.
+  ///
+  /// Save point addresses are left alone, since `clearThrough` identifies
+  /// save points by the address they resume at.
+  mutating func threadJumps(_ instructions: inout [Instruction]) {
+    // The final destination of each branch that's been followed, so that a
+    // long chain of branches is only walked once.
+    var resolved = [InstructionAddress?](repeating: nil, count: instructions.count)
+    func destination(_ addr: InstructionAddress) -> InstructionAddress {
+      var addr = addr
+      var chain: [Int] = []
+      // Bounded, in case the program has an infinite loop of branches.
+      for _ in instructions.indices {
+        if let known = resolved[addr.rawValue] {
+          addr = known
+          break
+        }
+        let inst = instructions[addr.rawValue]
+        guard inst.opcode == .branch else { break }
+        chain.append(addr.rawValue)
+        addr = inst.payload.addr
+      }
+      for pc in chain {
+        resolved[pc] = addr
+      }
+      return addr
+    }
+
+    for pc in instructions.indices {
+      let (opcode, payload) = instructions[pc].destructure
+      switch opcode {
+      case .branch:
+        instructions[pc] = .init(
+          opcode, .init(addr: destination(payload.addr)))
+      case .condBranchZeroElseDecrement:
+        let (addr, int) = payload.pairedAddrInt
+        instructions[pc] = .init(
+          opcode, .init(addr: destination(addr), int: int))
+      case .condBranchSamePosition:
+        let (addr, position) = payload.pairedAddrPos
+        instructions[pc] = .init(
+          opcode, .init(addr: destination(addr), position: position))
+      case .splitSaving:
+        let (nextPC, resumeAddr) = payload.pairedAddrAddr
+        instructions[pc] = .init(
+          opcode, .init(addr: destination(nextPC), addr2: resumeAddr))
+      default:
+        continue
+      }
+    }
+  }
+
+  /// Removes instructions that can't be reached, branches to the next
+  /// instruction, and save points that are cleared as soon as they're made.
+  mutating func removeDeadCode(_ instructions: inout [Instruction]) {
+    guard !instructions.isEmpty else { return }
+    let isTarget = Self.addressTargets(instructions)
+
+    var isReachable = Array(repeating: false, count: instructions.count)
+    var worklist = [0]
+    isReachable[0] = true
+    for inst in instructions where inst.opcode == .clearThrough {
+      // A `clearThrough` refers to a save point's address without
+      // jumping to it, but the address still needs to exist.
+      isReachable[inst.payload.addr.rawValue] = true
+      worklist.append(inst.payload.addr.rawValue)
+    }
+    while let pc = worklist.popLast() {
+      let inst = instructions[pc]
+      var successors = inst.addressOperands.map(\.rawValue)
+      if inst.fallsThrough, pc + 1 < instructions.count {
+        successors.append(pc + 1)
+      }
+      for next in successors where !isReachable[next] {
+        isReachable[next] = true
+        worklist.append(next)
+      }
+    }
+
+    var isRemoved = isReachable.map { !$0 }
+    for pc in instructions.indices where isReachable[pc] && !isTarget[pc] {
+      let inst = instructions[pc]
+      switch inst.opcode {
+      case .branch:
+        if inst.payload.addr.rawValue == pc + 1 {
+          isRemoved[pc] = true
+        }
+      case .save, .saveAddress:
+        if pc + 1 < instructions.count, !isTarget[pc + 1],
+           instructions[pc + 1].opcode == .clear {
+          isRemoved[pc] = true
+          isRemoved[pc + 1] = true
+        }
+      default:
+        continue
+      }
+    }
+
+    removeInstructions(&instructions, isRemoved)
+  }
+}
+
+// MARK: - Helpers
+
+extension MEProgram.Builder {
+  /// Returns the UTF-8 that `inst` matches, if it matches a fixed sequence
+  /// of scalars.
+  ///
+  /// The UTF-8 of a case-insensitive match is case-folded, and only ASCII
+  /// scalars are matched case-insensitively this way.
+  fileprivate func literal(
+    _ inst: Instruction
+  ) -> (utf8: [UInt8], boundaryCheck: Bool, isCaseInsensitive: Bool)? {
+    switch inst.opcode {
+    case .matchScalar:
+      let (scalar, caseInsensitive, boundaryCheck) = inst.payload.scalarPayload
+      guard caseInsensitive else {
+        return (Array(String(scalar).utf8), boundaryCheck, false)
+      }
+      guard scalar.isASCII else { return nil }
+      let byte = UInt8(truncatingIfNeeded: scalar.value)
+      return ([byte._asciiLowercased], boundaryCheck, true)
+    case .matchUTF8:
+      let (reg, boundaryCheck, isCaseInsensitive) =
+        inst.payload.matchUTF8Payload
+      let utf8 = utf8Contents.load(reg)
+      guard !utf8.isEmpty else { return nil }
+      return (utf8, boundaryCheck, isCaseInsensitive)
+    default:
+      return nil
+    }
+  }
+
+  /// Whether case-sensitive `utf8` matches the same input when matched
+  /// case-insensitively, i.e. it's ASCII without any letters.
+  fileprivate static func isCaseFoldingInvariant(_ utf8: [UInt8]) -> Bool {
+    utf8.allSatisfy { $0._isASCII && !$0._asciiIsLetter }
+  }
+
+  /// Whether there's a grapheme cluster boundary between two scalars, given
+  /// the last UTF-8 code unit of the first and the first of the second,
+  /// regardless of the surrounding text.
+  fileprivate static func isAlwaysGraphemeBoundary(
+    _ before: UInt8, _ after: UInt8
+  ) -> Bool {
+    before._isASCII && after._isASCII && !(before == 0x0D && after == 0x0A)
+  }
+
+  /// Whether `inst` matches exactly what one trip of `quantify` does.
+  fileprivate func matchesOneTrip(
+    _ inst: Instruction, of quantify: QuantifyPayload
+  ) -> Bool {
+    guard quantify.quantKind != .reluctant else { return false }
+    let payload = inst.payload
+    switch (inst.opcode, quantify.type) {
+    case (.matchBitset, .asciiBitset):
+      let (isScalar, reg) = payload.bitsetPayload
+      return isScalar == quantify.isScalarSemantics
+        && asciiBitsets[reg.rawValue] == asciiBitsets[quantify.bitset.rawValue]
+    case (.matchScalar, .asciiChar):
+      // A quantified scalar checks for a grapheme boundary after each trip
+      // in grapheme semantic mode.
+      let (scalar, caseInsensitive, boundaryCheck) = payload.scalarPayload
+      return !caseInsensitive
+        && boundaryCheck != quantify.isScalarSemantics
+        && scalar.value == UInt32(quantify.asciiChar)
+    case (.matchBuiltin, .builtinCC):
+      let cc = payload.characterClassPayload
+      return cc.cc == quantify.builtinCC
+        && cc.isInverted == quantify.builtinIsInverted
+        && cc.isStrictASCII == quantify.builtinIsStrict
+        && cc.isScalarSemantics == quantify.isScalarSemantics
+    case (.matchAnyNonNewline, .any):
+      return !quantify.anyMatchesNewline
+        && payload.isScalar == quantify.isScalarSemantics
+    default:
+      return false
+    }
+  }
+
+  /// Returns whether each instruction can be jumped to or resumed at,
+  /// rather than only reached from the instruction before it.
+  fileprivate static func addressTargets(
+    _ instructions: [Instruction]
+  ) -> [Bool] {
+    var isTarget = Array(repeating: false, count: instructions.count)
+    if !isTarget.isEmpty {
+      isTarget[0] = true
+    }
+    for pc in instructions.indices {
+      let inst = instructions[pc]
+      for addr in inst.addressOperands {
+        isTarget[addr.rawValue] = true
+      }
+      // Quantified and literal trie save points resume after the
+      // instruction.
+      if inst.opcode == .quantify || inst.opcode == .matchLiteralTrie,
+         pc + 1 < instructions.count {
+        isTarget[pc + 1] = true
+      }
+    }
+    return isTarget
+  }
+
+  /// Gives the first instruction in `range` a location covering those of
+  /// all the instructions in `range`, when fusing them into one.
+  fileprivate mutating func mergeLocations(of range: Range<Int>) {
+    guard let locations = instructionLocations else { return }
+    instructionLocations![range.lowerBound] = locations[range]
+      .reduce(nil) { merged, location in
+        guard let location else { return merged }
+        return merged?.union(with: location) ?? location
+      }
+  }
+
+  /// Removes the instructions marked in `isRemoved`, updating instruction
+  /// addresses, and recorded locations, to match. An address of a removed
+  /// instruction is updated to the next instruction that remains.
+  fileprivate mutating func removeInstructions(
+    _ instructions: inout [Instruction], _ isRemoved: [Bool]
+  ) {
+    guard isRemoved.contains(true) else { return }
+    if let locations = instructionLocations {
+      instructionLocations = locations.indices
+        .filter { !isRemoved[$0] }
+        .map { locations[$0] }
+    }
+
+    var newAddresses: [Int] = []
+    newAddresses.reserveCapacity(instructions.count)
+    var next = 0
+    for pc in instructions.indices {
+      newAddresses.append(next)
+      if !isRemoved[pc] {
+        next += 1
+      }
+    }
+
+    var result: [Instruction] = []
+    result.reserveCapacity(next)
+    for pc in instructions.indices where !isRemoved[pc] {
+      result.append(instructions[pc].mappingAddresses {
+        InstructionAddress(newAddresses[$0.rawValue])
+      })
+    }
+    instructions = result
+  }
+}
+
+extension Instruction {
+  /// The instruction addresses in this instruction's payload.
+  var addressOperands: [InstructionAddress] {
+    switch opcode {
+    case .branch, .save, .saveAddress, .clearThrough:
+      return [payload.addr]
+    case .condBranchZeroElseDecrement:
+      return [payload.pairedAddrInt.0]
+    case .condBranchSamePosition:
+      return [payload.pairedAddrPos.0]
+    case .splitSaving:
+      let (nextPC, resumeAddr) = payload.pairedAddrAddr
+      return [nextPC, resumeAddr]
+    default:
+      return []
+    }
+  }
+
+  /// Whether execution can continue with the next instruction.
+  var fallsThrough: Bool {
+    switch opcode {
+    case .branch, .splitSaving, .accept, .fail, .invalid:
+      return false
+    default:
+      return true
+    }
+  }
+
+  /// Returns this instruction with each instruction address in its payload
+  /// replaced by the result of `transform`.
+  func mappingAddresses(
+    _ transform: (InstructionAddress) -> InstructionAddress
+  ) -> Instruction {
+    switch opcode {
+    case .branch, .save, .saveAddress, .clearThrough:
+      return .init(opcode, .init(addr: transform(payload.addr)))
+    case .condBranchZeroElseDecrement:
+      let (addr, int) = payload.pairedAddrInt
+      return .init(opcode, .init(addr: transform(addr), int: int))
+    case .condBranchSamePosition:
+      let (addr, position) = payload.pairedAddrPos
+      return .init(opcode, .init(addr: transform(addr), position: position))
+    case .splitSaving:
+      let (nextPC, resumeAddr) = payload.pairedAddrAddr
+      return .init(
+        opcode, .init(addr: transform(nextPC), addr2: transform(resumeAddr)))
+    default:
+      return self
+    }
+  }
+}
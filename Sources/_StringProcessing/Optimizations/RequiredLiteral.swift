@@ -0,0 +1,367 @@
+//===----------------------------------------------------------------------===//
+//
+// This source file is part of the Swift.org open source project
+//
+// Copyright (c) 2025 Apple Inc. and the Swift project authors
+// Licensed under Apache License v2.0 with Runtime Library Exception
+//
+// See https://swift.org/LICENSE.txt for license information
+//
+//===----------------------------------------------------------------------===//
+
+internal import _RegexParser
+
+extension DSLList {
+  /// The literal runs found while walking the nodes that every match
+  /// must pass through.
+  private struct _LiteralRuns {
+    /// The bytes that every match begins with.
+    var prefix: [UInt8] = []
+    /// The longest run of bytes that every match contains.
+    var longest: [UInt8] = []
+    /// The run currently being accumulated.
+    var current: [UInt8] = []
+    /// Whether `current` is matched starting at the beginning of every match.
+    var isAtStart = true
+    /// Whether the matching options are no longer known, which ends the walk.
+    var optionsAreUnknown = false
+    /// Whether any of the bytes in `prefix` or `longest` only need to match
+    /// up to ASCII case.
+    var isCaseInsensitive = false
+    /// Whether any of the bytes in `current` only need to match up to ASCII
+    /// case.
+    var currentIsCaseInsensitive = false
+
+    mutating func append(_ bytes: String.UTF8View, isCaseInsensitive: Bool) {
+      if !optionsAreUnknown {
+        current.append(contentsOf: bytes)
+        currentIsCaseInsensitive = currentIsCaseInsensitive || isCaseInsensitive
+      }
+    }
+
+    mutating func endRun() {
+      if isAtStart {
+        prefix = current
+        isAtStart = false
+        isCaseInsensitive = isCaseInsensitive || currentIsCaseInsensitive
+      }
+      if current.count > longest.count {
+        longest = current
+        isCaseInsensitive = isCaseInsensitive || currentIsCaseInsensitive
+      }
+      current.removeAll(keepingCapacity: true)
+      currentIsCaseInsensitive = false
+    }
+  }
+
+  /// Returns the UTF-8 bytes that `c` is guaranteed to match under `options`,
+  /// and whether they're only matched up to ASCII case, or `nil` if the
+  /// character can match other byte sequences.
+  ///
+  /// Under grapheme cluster semantics, only ASCII is normalization-invariant.
+  /// Case-insensitive cased characters can match multiple spellings, except
+  /// for ASCII letters, which only match themselves in either case. The
+  /// exceptions are `k` and `s`, which also match KELVIN SIGN and LONG S.
+  private func _verbatimBytes(
+    _ c: Character,
+    options: MatchingOptions
+  ) -> (bytes: String.UTF8View, isCaseInsensitive: Bool)? {
+    if options.usesCanonicalEquivalence && !c.isASCII {
+      return nil
+    }
+    if options.isCaseInsensitive
+        && (c.isCased || c.unicodeScalars.contains(where: \.properties.isCased)) {
+      guard let ascii = c.asciiValue, ascii._asciiIsLetter,
+            !"kKsS".utf8.contains(ascii)
+      else { return nil }
+      return (String(c).utf8, true)
+    }
+    return (String(c).utf8, false)
+  }
+
+  /// Moves `position` to the last node in the subtree rooted at `position`.
+  private func _skipSubtree(_ position: inout Int) {
+    for _ in 0..<nodes[position].directChildren {
+      position += 1
+      _skipSubtree(&position)
+    }
+  }
+
+  /// Skips the subtree at `position`, ending the current run.
+  ///
+  /// Option-setting atoms that aren't scoped to a group inside the skipped
+  /// subtree affect the nodes that follow it, so any further literals
+  /// can't be trusted.
+  private func _skipOpaqueSubtree(
+    _ position: inout Int,
+    runs: inout _LiteralRuns
+  ) {
+    let start = position
+    _skipSubtree(&position)
+    runs.endRun()
+    for node in nodes[start...position] {
+      if case .atom(.changeMatchingOptions) = node {
+        runs.optionsAreUnknown = true
+      }
+    }
+  }
+
+  /// Walks the subtree at `position`, appending the bytes that must be
+  /// matched verbatim to `runs`, and leaves `position` at the last node of
+  /// the subtree.
+  private func _collectLiteralRuns(
+    _ position: inout Int,
+    options: inout MatchingOptions,
+    into runs: inout _LiteralRuns
+  ) {
+    switch nodes[position] {
+    case .atom(let atom):
+      switch atom {
+      case .char(let c):
+        if let (bytes, isCaseInsensitive) = _verbatimBytes(c, options: options) {
+          runs.append(bytes, isCaseInsensitive: isCaseInsensitive)
+        } else {
+          runs.endRun()
+        }
+      case .scalar(let s):
+        if let (bytes, isCaseInsensitive) = _verbatimBytes(
+          Character(s), options: options
+        ) {
+          runs.append(bytes, isCaseInsensitive: isCaseInsensitive)
+        } else {
+          runs.endRun()
+        }
+      case .changeMatchingOptions(let seq):
+        options.apply(seq.ast)
+      // Assertions don't consume input, so a run continues across them.
+      case .assertion:
+        break
+      default:
+        runs.endRun()
+      }
+
+    case .quotedLiteral(let str, _):
+      for c in str {
+        if let (bytes, isCaseInsensitive) = _verbatimBytes(c, options: options) {
+          runs.append(bytes, isCaseInsensitive: isCaseInsensitive)
+        } else {
+          runs.endRun()
+        }
+      }
+
+    case .concatenation(let count):
+      for _ in 0..<count {
+        position += 1
+        _collectLiteralRuns(&position, options: &options, into: &runs)
+      }
+
+    case .capture:
+      position += 1
+      options.beginScope()
+      defer { options.endScope() }
+      _collectLiteralRuns(&position, options: &options, into: &runs)
+
+    case .nonCapturingGroup(let kind):
+      switch kind.ast {
+      case .nonCapture, .atomicNonCapturing:
+        position += 1
+        options.beginScope()
+        defer { options.endScope() }
+        _collectLiteralRuns(&position, options: &options, into: &runs)
+      case .changeMatchingOptions(let seq):
+        position += 1
+        options.beginScope()
+        defer { options.endScope() }
+        options.apply(seq)
+        _collectLiteralRuns(&position, options: &options, into: &runs)
+      default:
+        // Lookarounds can inspect input outside of the match, so their
+        // contents aren't required to appear within it.
+        _skipOpaqueSubtree(&position, runs: &runs)
+      }
+
+    case .ignoreCapturesInTypedOutput, .limitCaptureNesting:
+      position += 1
+      _collectLiteralRuns(&position, options: &options, into: &runs)
+
+    // The first trip of a required quantification is part of every match,
+    // but subsequent trips end the run.
+    case .quantification(let amount, _):
+      if amount.requiresAtLeastOne {
+        position += 1
+        _collectLiteralRuns(&position, options: &options, into: &runs)
+        runs.endRun()
+      } else {
+        _skipOpaqueSubtree(&position, runs: &runs)
+      }
+
+    // Trivia/empty have no effect.
+    case .trivia, .empty:
+      break
+
+    // TODO: Alternations could contribute a literal common to every branch.
+    case .orderedChoice, .conditional, .customCharacterClass,
+        .consumer, .matcher, .characterPredicate, .absentFunction:
+      _skipOpaqueSubtree(&position, runs: &runs)
+    }
+  }
+
+  /// Returns the set of ASCII bytes that a match of the subtree at `position`
+  /// must begin with.
+  ///
+  /// - `nil`: The subtree doesn't consume input, so the next sibling decides.
+  /// - `.some(nil)`: A match can begin with an arbitrary byte.
+  /// - `.some(bitset)`: A match must begin with a byte in `bitset`.
+  private func _leadingBytesImpl(
+    _ position: inout Int,
+    options: inout MatchingOptions
+  ) -> DSLTree.CustomCharacterClass.AsciiBitset?? {
+    typealias Bitset = DSLTree.CustomCharacterClass.AsciiBitset
+
+    func leadingByte(of c: Character) -> Bitset? {
+      guard c.isASCII,
+            let (bytes, isCaseInsensitive) = _verbatimBytes(c, options: options)
+      else {
+        return nil
+      }
+      return Bitset(bytes.first!, false, isCaseInsensitive)
+    }
+
+    switch nodes[position] {
+    case .atom(let atom):
+      switch atom {
+      case .char(let c):
+        return leadingByte(of: c)
+      case .scalar(let s):
+        return leadingByte(of: Character(s))
+      case .changeMatchingOptions(let seq):
+        options.apply(seq.ast)
+        return nil
+      case .assertion:
+        return nil
+      default:
+        return .some(nil)
+      }
+
+    case .quotedLiteral(let str, _):
+      return str.first.map(leadingByte(of:))
+
+    case .concatenation(let count):
+      var result: Bitset?? = nil
+      var i = 0
+      while i < count {
+        i += 1
+        position += 1
+        if let r = _leadingBytesImpl(&position, options: &options) {
+          result = r
+          break
+        }
+      }
+      for _ in i..<count {
+        position += 1
+        _skipSubtree(&position)
+      }
+      return result
+
+    // Every alternative must begin with a known byte.
+    case .orderedChoice(let count):
+      var result: Bitset? = nil
+      var isKnown = true
+      for _ in 0..<count {
+        position += 1
+        guard isKnown else {
+          _skipSubtree(&position)
+          continue
+        }
+        // An alternative that doesn't consume input lets the match begin
+        // with whatever follows the alternation.
+        guard let r = _leadingBytesImpl(&position, options: &options),
+              let bitset = r
+        else {
+          isKnown = false
+          continue
+        }
+        result = result.map { $0.union(bitset) } ?? bitset
+      }
+      return isKnown ? .some(result) : .some(nil)
+
+    case .capture:
+      position += 1
+      options.beginScope()
+      defer { options.endScope() }
+      return _leadingBytesImpl(&position, options: &options)
+
+    case .nonCapturingGroup(let kind):
+      switch kind.ast {
+      case .nonCapture, .atomicNonCapturing:
+        position += 1
+        options.beginScope()
+        defer { options.endScope() }
+        return _leadingBytesImpl(&position, options: &options)
+      case .changeMatchingOptions(let seq):
+        position += 1
+        options.beginScope()
+        defer { options.endScope() }
+        options.apply(seq)
+        return _leadingBytesImpl(&position, options: &options)
+      default:
+        _skipSubtree(&position)
+        return .some(nil)
+      }
+
+    case .ignoreCapturesInTypedOutput, .limitCaptureNesting:
+      position += 1
+      return _leadingBytesImpl(&position, options: &options)
+
+    case .quantification(let amount, _):
+      if amount.requiresAtLeastOne {
+        position += 1
+        return _leadingBytesImpl(&position, options: &options)
+      }
+      _skipSubtree(&position)
+      return .some(nil)
+
+    case .trivia, .empty:
+      return nil
+
+    case .conditional, .customCharacterClass, .consumer, .matcher,
+        .characterPredicate, .absentFunction:
+      _skipSubtree(&position)
+      return .some(nil)
+    }
+  }
+
+  /// Returns a prefilter describing bytes that must appear in every match of
+  /// this regex, or `nil` if no useful constraint could be found.
+  internal func prefilter(options: MatchingOptions) -> MEProgram.Prefilter? {
+    guard !nodes.isEmpty else { return nil }
+
+    var position = 0
+    var runOptions = options
+    var runs = _LiteralRuns()
+    _collectLiteralRuns(&position, options: &runOptions, into: &runs)
+    runs.endRun()
+
+    var leadingBytes: DSLTree.CustomCharacterClass.AsciiBitset? = nil
+    if runs.prefix.isEmpty {
+      position = 0
+      var leadingOptions = options
+      leadingBytes = _leadingBytesImpl(&position, options: &leadingOptions) ?? nil
+    }
+
+    guard !runs.longest.isEmpty || leadingBytes != nil else {
+      return nil
+    }
+    // Case-insensitive runs are searched for with their ASCII case folded,
+    // which only finds more candidates for any case-sensitive bytes.
+    let isCaseInsensitive = runs.isCaseInsensitive
+    func folded(_ bytes: [UInt8]) -> [UInt8] {
+      isCaseInsensitive ? bytes.map(\._asciiLowercased) : bytes
+    }
+    return MEProgram.Prefilter(
+      prefix: folded(runs.prefix),
+      requiredLiteral: folded(runs.longest),
+      leadingBytes: leadingBytes,
+      isCaseInsensitive: isCaseInsensitive)
+  }
+}
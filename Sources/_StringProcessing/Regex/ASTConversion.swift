@@ -13,21 +13,47 @@ internal import _RegexParser
 
 extension AST.Node {
   func convert(into list: inout [DSLTree.Node]) throws {
+    var locations: [SourceLocation?]? = nil
+    try convert(into: &list, locations: &locations)
+  }
+
+  /// Converts this node, appending to `list`, and if `locations` isn't
+  /// `nil`, records the source location of each node appended.
+  ///
+  /// A DSL node gets the location of the innermost AST node it was converted
+  /// from, so a quantification's location covers its child, but the child's
+  /// nodes have their own.
+  func convert(
+    into list: inout [DSLTree.Node],
+    locations: inout [SourceLocation?]?
+  ) throws {
+    let start = list.count
+    defer {
+      if locations != nil {
+        Self.recordLocation(
+          self.location, of: start..<list.count, in: &locations!)
+      }
+    }
+
     switch self {
     case .alternation(let alternation):
       list.append(.orderedChoice(alternation.children.count))
       for child in alternation.children {
-        try child.convert(into: &list)
+        try child.convert(into: &list, locations: &locations)
       }
     case .concatenation(_):
       let coalesced = self.coalescedChildrenWithDisplay
       list.append(.concatenation(coalesced.count))
       for child in coalesced {
         switch child {
-        case .literal(let value, let display):
+        case .literal(let value, let display, let location):
           list.append(.quotedLiteral(value, display: display))
+          if locations != nil {
+            Self.recordLocation(
+              location, of: (list.count - 1)..<list.count, in: &locations!)
+          }
         case .node(let astNode):
-          try astNode.convert(into: &list)
+          try astNode.convert(into: &list, locations: &locations)
         }
       }
     case .group(let group):
@@ -35,24 +61,24 @@ extension AST.Node {
       switch group.kind.value {
       case .capture:
         list.append(.capture())
-        try child.convert(into: &list)
+        try child.convert(into: &list, locations: &locations)
       case .namedCapture(let name):
         list.append(.capture(name: name.value))
-        try child.convert(into: &list)
+        try child.convert(into: &list, locations: &locations)
       case .balancedCapture:
         throw Unsupported("TODO: balanced captures")
       default:
         list.append(.nonCapturingGroup(.init(ast: group.kind.value)))
-        try child.convert(into: &list)
+        try child.convert(into: &list, locations: &locations)
       }
     case .conditional(let conditional):
       list.append(.conditional(.init(ast: conditional.condition.kind)))
-      try conditional.trueBranch.convert(into: &list)
-      try conditional.falseBranch.convert(into: &list)
+      try conditional.trueBranch.convert(into: &list, locations: &locations)
+      try conditional.falseBranch.convert(into: &list, locations: &locations)
     case .quantification(let quant):
       list.append(
         .quantification(.init(ast: quant.amount.value), .syntax(.init(ast: quant.kind.value))))
-      try quant.child.convert(into: &list)
+      try quant.child.convert(into: &list, locations: &locations)
     case .quote(let node):
       list.append(.quotedLiteral(node.literal, display: nil))
     case .trivia(let node):
@@ -82,10 +108,27 @@ extension AST.Node {
     }
   }
 
-  /// A coalesced child is either a literal (with value and display strings)
-  /// produced by coalescing adjacent chars/scalars, or an unconverted AST node.
+  /// Records `location` for the nodes in `range` that don't have a location
+  /// yet, which are those not converted from a child.
+  private static func recordLocation(
+    _ location: SourceLocation,
+    of range: Range<Int>,
+    in locations: inout [SourceLocation?]
+  ) {
+    if locations.count < range.upperBound {
+      locations.append(contentsOf:
+        repeatElement(nil, count: range.upperBound - locations.count))
+    }
+    for i in range where locations[i] == nil {
+      locations[i] = location
+    }
+  }
+
+  /// A coalesced child is either a literal (with value and display strings,
+  /// and the location of the coalesced nodes) produced by coalescing adjacent
+  /// chars/scalars, or an unconverted AST node.
   private enum CoalescedChild {
-    case literal(value: String, display: String)
+    case literal(value: String, display: String, location: SourceLocation)
     case node(AST.Node)
   }
 
@@ -93,12 +136,16 @@ extension AST.Node {
   /// scalars into quoted literals, tracking both the actual string value and
   /// a display form that preserves \u{} notation for scalars.
   private var coalescedChildrenWithDisplay: [CoalescedChild] {
-    func flatten(_ node: AST.Node) -> [AST.Node] {
+    // Flatten into a single array, rather than building an array for each
+    // child, which would allocate for every atom of a long concatenation.
+    func flatten(_ node: AST.Node, into flat: inout [AST.Node]) {
       switch node {
       case .concatenation(let concat):
-        return concat.children.flatMap(flatten)
+        for child in concat.children {
+          flatten(child, into: &flat)
+        }
       default:
-        return [node]
+        flat.append(node)
       }
     }
 
@@ -106,17 +153,24 @@ extension AST.Node {
       return []
     }
 
-    let flat = v.children.flatMap(flatten)
+    var flat: [AST.Node] = []
+    flat.reserveCapacity(v.children.count)
+    for child in v.children {
+      flatten(child, into: &flat)
+    }
     var result: [CoalescedChild] = []
     var value = ""
     var display = ""
+    var location: SourceLocation? = nil
     var accumulating = false
 
     func finishAccumulation() {
       if accumulating {
-        result.append(.literal(value: value, display: display))
+        result.append(.literal(
+          value: value, display: display, location: location ?? .fake))
         value = ""
         display = ""
+        location = nil
         accumulating = false
       }
     }
@@ -125,7 +179,13 @@ extension AST.Node {
       switch atom.kind {
       case .char(let c):
         value.append(c)
-        display += String(c)._escaped
+        // Escape in place, like `_escaped`, without creating a string for
+        // each character.
+        switch c {
+        case "\\": display += #"\\"#
+        case "\"": display += #"\""#
+        default: display.append(c)
+        }
         return true
       case .scalar(let s):
         value.append(Character(s.value))
@@ -166,6 +226,7 @@ extension AST.Node {
 
       if accumulated {
         accumulating = true
+        location = location?.union(with: child.location) ?? child.location
       } else {
         finishAccumulation()
         result.append(.node(child))
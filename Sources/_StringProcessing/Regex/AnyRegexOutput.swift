@@ -177,13 +177,20 @@ extension Regex where Output == AnyRegexOutput {
   /// If you know the capture structure of `pattern` ahead of time, use the
   /// ``init(_:as:)`` initializer instead.
   ///
+  /// Regexes created from the same pattern share their parsed and compiled
+  /// forms through the ``RegexCache``.
+  ///
   /// - Parameter pattern: A string with regular expression syntax.
   public init(_ pattern: String) throws {
-    self.init(ast: try parse(pattern, .traditional))
+    try self.init(pattern, syntax: .traditional)
   }
   
   internal init(_ pattern: String, syntax: SyntaxOptions) throws {
-    self.init(ast: try parse(pattern, syntax))
+    let key = ProgramCacheKey(
+      pattern: pattern, syntax: syntax, outputType: Output.self)
+    self.init(program: try .cached(key) {
+      Program(ast: try parse(pattern, syntax))
+    })
   }
 }
 
@@ -209,6 +216,9 @@ extension Regex {
   /// structure declared by `pattern`. If you don't know the capture structure
   /// in advance, use the ``init(_:)`` initializer instead.
   ///
+  /// Regexes created from the same pattern and capture type share their
+  /// parsed and compiled forms through the ``RegexCache``.
+  ///
   /// - Parameters:
   ///   - pattern: A string with regular expression syntax.
   ///   - outputType: The desired type for the output captures.
@@ -216,18 +226,22 @@ extension Regex {
     _ pattern: String,
     as outputType: Output.Type = Output.self
   ) throws {
-    let regex = Regex(ast: try parse(pattern, .traditional))
-    
-    let (isSuccess, correctType) = regex._verifyType()
-    
-    guard isSuccess else {
-      throw RegexCompilationError.incorrectOutputType(
-        incorrect: Output.self,
-        correct: correctType
-      )
-    }
-    
-    self = regex
+    let key = ProgramCacheKey(
+      pattern: pattern, syntax: .traditional, outputType: Output.self)
+    self.init(program: try .cached(key) {
+      let regex = Regex(ast: try parse(pattern, .traditional))
+      
+      let (isSuccess, correctType) = regex._verifyType()
+      
+      guard isSuccess else {
+        throw RegexCompilationError.incorrectOutputType(
+          incorrect: Output.self,
+          correct: correctType
+        )
+      }
+      
+      return regex.program
+    })
   }
 
   /// Creates a regular expression that matches the given string exactly, as
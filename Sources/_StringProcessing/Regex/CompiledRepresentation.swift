@@ -0,0 +1,158 @@
+//===----------------------------------------------------------------------===//
+//
+// This source file is part of the Swift.org open source project
+//
+// Copyright (c) 2025 Apple Inc. and the Swift project authors
+// Licensed under Apache License v2.0 with Runtime Library Exception
+//
+// See https://swift.org/LICENSE.txt for license information
+//
+//===----------------------------------------------------------------------===//
+
+internal import _RegexParser
+
+@available(SwiftStdlib 6.1, *)
+extension Regex {
+  /// Returns the compiled form of this regex as bytes, which
+  /// ``Regex/init(compiledRepresentation:)`` loads without compiling the
+  /// regex again.
+  ///
+  /// An app that uses many regexes can compile them ahead of time, such as
+  /// in a build step, and load the compiled representations at launch:
+  ///
+  ///     let bytes = try Regex(#"(\w+)@(\w+)\.com"#).compiledRepresentation()
+  ///     // Later, or in another process:
+  ///     let regex = try Regex(compiledRepresentation: bytes)
+  ///
+  /// A compiled representation can only be loaded by the same version of
+  /// the regex engine that created it.
+  ///
+  /// - Throws: ``CompiledRegexError/unsupportedComponent`` if the regex
+  ///   can't be represented as a string, such as a regex that includes a
+  ///   capture transform, a custom parser, or a `Reference`.
+  public func compiledRepresentation() throws -> [UInt8] {
+    guard let source = program.source else {
+      throw CompiledRegexError.unsupportedComponent
+    }
+    return try program.loweredProgram.serialized(
+      pattern: source.pattern,
+      syntax: source.syntax,
+      stepLimit: program.stepLimit)
+  }
+}
+
+@available(SwiftStdlib 6.1, *)
+extension Regex where Output == AnyRegexOutput {
+  /// Creates a regular expression from a compiled representation returned
+  /// by ``Regex/compiledRepresentation()``.
+  ///
+  /// The bytes are copied, so `buffer` can be released, or unmapped if it's
+  /// a mapped file, once this initializer returns. The regex's pattern is
+  /// parsed to check that it matches the compiled program, but the regex is
+  /// only compiled again if it's used with different compile options.
+  ///
+  /// - Throws: ``CompiledRegexError/unsupportedVersion`` if a different
+  ///   version of the regex engine created the representation, or
+  ///   ``CompiledRegexError/invalidData`` if it's truncated or corrupted.
+  public init(compiledRepresentation buffer: UnsafeRawBufferPointer) throws {
+    let loaded = try MEProgram.load(from: buffer)
+    self.init(program: Program(
+      loadedProgram: loaded.program,
+      pattern: loaded.pattern,
+      syntax: loaded.syntax,
+      ast: loaded.ast,
+      stepLimit: loaded.stepLimit))
+  }
+
+  /// Creates a regular expression from a compiled representation returned
+  /// by ``Regex/compiledRepresentation()``.
+  ///
+  /// - Throws: ``CompiledRegexError/unsupportedVersion`` if a different
+  ///   version of the regex engine created the representation, or
+  ///   ``CompiledRegexError/invalidData`` if it's truncated or corrupted.
+  public init(compiledRepresentation bytes: [UInt8]) throws {
+    self = try bytes.withUnsafeBytes {
+      try Regex(compiledRepresentation: $0)
+    }
+  }
+}
+
+/// An error thrown when creating or loading the compiled representation of
+/// a regex.
+@available(SwiftStdlib 6.1, *)
+public struct CompiledRegexError: Error, Hashable, CustomStringConvertible {
+  internal enum Kind: Hashable {
+    case unsupportedComponent
+    case unsupportedVersion
+    case invalidData
+  }
+
+  internal var kind: Kind
+
+  /// The regex includes a component that a compiled representation can't
+  /// hold.
+  public static var unsupportedComponent: Self { .init(kind: .unsupportedComponent) }
+
+  /// The compiled representation was created by a different version of the
+  /// regex engine.
+  public static var unsupportedVersion: Self { .init(kind: .unsupportedVersion) }
+
+  /// The data isn't a valid compiled representation.
+  public static var invalidData: Self { .init(kind: .invalidData) }
+
+  public var description: String {
+    switch kind {
+    case .unsupportedComponent:
+      return "The regex includes a component that can't be compiled ahead of time"
+    case .unsupportedVersion:
+      return "The compiled regex was created by a different version of the regex engine"
+    case .invalidData:
+      return "The data isn't a valid compiled regex"
+    }
+  }
+}
+
+/// The IR of a program loaded from its compiled representation, built from
+/// its parsed pattern the first time it's needed.
+final class LazyDSLList {
+  // This stored property should be stored at offset zero. We perform atomic
+  // operations on it.
+  private var _storage: AnyObject? = nil
+
+  let pattern: String
+  let syntax: SyntaxOptions
+  private let ast: AST
+
+  private final class Box {
+    let value: DSLList
+    init(_ value: DSLList) { self.value = value }
+  }
+
+  init(pattern: String, syntax: SyntaxOptions, ast: AST) {
+    self.pattern = pattern
+    self.syntax = syntax
+    self.ast = ast
+  }
+
+  private var storagePtr: UnsafeMutablePointer<AnyObject?> {
+    _getUnsafePointerToStoredProperties(self)
+      .assumingMemoryBound(to: Optional<AnyObject>.self)
+  }
+
+  var value: DSLList {
+    func load() -> DSLList? {
+      guard let box = _stdlib_atomicLoadARCRef(object: storagePtr) else {
+        return nil
+      }
+      return unsafeDowncast(box, to: Box.self).value
+    }
+    if let list = load() {
+      return list
+    }
+
+    let list = DSLList(ast: ast)
+    return _stdlib_atomicInitializeARCRef(object: storagePtr, desired: Box(list))
+      ? list
+      : load()!
+  }
+}
@@ -88,7 +88,7 @@ public protocol RegexComponent<RegexOutput> {
 /// [tspl]: https://docs.swift.org/swift-book/
 @available(SwiftStdlib 5.7, *)
 public struct Regex<Output>: RegexComponent {
-  let program: Program
+  var program: Program
 
   var hasCapture: Bool {
     program.list.hasCapture
@@ -151,11 +151,36 @@ extension Regex {
     /// FIXME: If Regex is the unit of composition, then it should be a Node instead,
     /// and we should have a separate type that handled both global options and,
     /// likely, compilation/caching.
-    var list: DSLList
+    var list: DSLList {
+      _list ?? lazyList.unsafelyUnwrapped.value
+    }
+
+    private let _list: DSLList?
+
+    /// The source of the IR for a program loaded from its compiled
+    /// representation, which is only parsed if it's needed.
+    private let lazyList: LazyDSLList?
+
+    /// The program loaded from a compiled representation, used in place of
+    /// compiling `list` with the default compile options.
+    private let loadedProgram: MEProgram?
 
     /// OptionSet of compiler options for testing purposes
     fileprivate var compileOptions: _CompileOptions = .default
 
+    /// The number of steps after which matching throws, if any.
+    fileprivate(set) var stepLimit: Int? = nil
+
+    /// The profile that searches with this program record their steps in,
+    /// if any.
+    fileprivate(set) var profile: ProfileRecorder? = nil
+
+    /// What this program was created from, if it's shared through the
+    /// `RegexCache`.
+    ///
+    /// Cached programs must not be modified; see `copy()`.
+    fileprivate(set) var cacheKey: ProgramCacheKey? = nil
+
     private final class ProgramBox {
       let value: MEProgram
       init(_ value: MEProgram) { self.value = value }
@@ -181,7 +206,22 @@ extension Regex {
       }
       
       // Compile the DSLTree into a lowered program and store it atomically.
-      let compiledProgram = try! Compiler(tree: list, compileOptions: compileOptions).emit()
+      var compiledProgram: MEProgram
+      if let loadedProgram, compileOptions == .default {
+        compiledProgram = loadedProgram
+      } else {
+        compiledProgram = try! Compiler(
+          tree: list, compileOptions: compileOptions).emit()
+      }
+      compiledProgram.stepLimit = stepLimit
+      if let profile {
+        // The lazy DFA decides some searches without running the processor,
+        // so it's turned off to count every step of a profiled search.
+        compiledProgram.canUseLazyDFA = false
+        compiledProgram.lazyDFAs = nil
+        compiledProgram.profile = profile
+        profile.prepare(for: compiledProgram)
+      }
       let storedNewProgram = _stdlib_atomicInitializeARCRef(
         object: _loweredProgramStoragePtr,
         desired: ProgramBox(compiledProgram))
@@ -194,11 +234,100 @@ extension Regex {
     }
 
     init(ast: AST) {
-      self.list = DSLList(ast: ast)
+      self._list = DSLList(ast: ast)
+      self.lazyList = nil
+      self.loadedProgram = nil
     }
 
     init(list: DSLList) {
-      self.list = list
+      self._list = list
+      self.lazyList = nil
+      self.loadedProgram = nil
+    }
+
+    /// Creates a program that matches with `loadedProgram`, which was
+    /// compiled from `pattern`.
+    init(
+      loadedProgram: MEProgram,
+      pattern: String,
+      syntax: SyntaxOptions,
+      ast: AST,
+      stepLimit: Int?
+    ) {
+      self._list = nil
+      self.lazyList = LazyDSLList(pattern: pattern, syntax: syntax, ast: ast)
+      self.loadedProgram = loadedProgram
+      self.stepLimit = stepLimit
+    }
+
+    private init(copying other: Program) {
+      self._list = other._list
+      self.lazyList = other.lazyList
+      self.loadedProgram = other.loadedProgram
+    }
+
+    /// The pattern that this program's IR can be parsed from, or `nil` if
+    /// the regex can't be represented as a string.
+    var source: (pattern: String, syntax: SyntaxOptions)? {
+      if let lazyList {
+        return (lazyList.pattern, lazyList.syntax)
+      }
+      if let cacheKey, cacheKey.options.isEmpty {
+        return (cacheKey.pattern, SyntaxOptions(rawValue: cacheKey.syntax))
+      }
+      return list.literalPattern.map { ($0, .traditional) }
+    }
+
+    /// Returns a program for the same regex that compiles separately, and
+    /// so can be modified without affecting other regexes.
+    func copy() -> Program {
+      let program = Program(copying: self)
+      program.compileOptions = compileOptions
+      program.stepLimit = stepLimit
+      program.profile = profile
+      return program
+    }
+
+    /// Returns a program for the same regex with the given step limit.
+    func withStepLimit(_ stepLimit: Int?) -> Program {
+      let program = copy()
+      program.stepLimit = stepLimit
+      return program
+    }
+
+    /// Returns a program for the same regex that records its searches in
+    /// `profile`.
+    ///
+    /// When the regex can be written as a pattern, the program is compiled
+    /// from a fresh parse of that pattern, so that each instruction can be
+    /// traced back to the part of the pattern it came from.
+    func withProfile(_ profile: ProfileRecorder) -> Program {
+      let program: Program
+      if let source, let ast = try? parse(source.pattern, source.syntax) {
+        program = Program(list: DSLList(recordingLocationsOf: ast))
+        program.compileOptions = compileOptions
+        program.stepLimit = stepLimit
+        profile.attach(pattern: source.pattern)
+      } else {
+        program = copy()
+        profile.attach(pattern: nil)
+      }
+      program.profile = profile
+      return program
+    }
+
+    /// Returns the program cached for `key`, calling `makeProgram` to create
+    /// one if there isn't one.
+    static func cached(
+      _ key: ProgramCacheKey,
+      _ makeProgram: () throws -> Program
+    ) rethrows -> Program {
+      let program = try ProgramCache.shared.program(for: key) {
+        let program = try makeProgram()
+        program.cacheKey = key
+        return program
+      }
+      return unsafeDowncast(program, to: Program.self)
     }
   }
   
@@ -228,6 +357,10 @@ extension Regex {
   init(list: DSLList) {
     self.program = Program(list: list)
   }
+
+  init(program: Program) {
+    self.program = program
+  }
   
   func appending<T>(_ node: DSLTree.Node) -> Regex<T> {
     var list = program.list
@@ -305,8 +438,8 @@ extension Regex {
     do {
       switch action {
       case .addOptions(let opts):
+        program = program.copy()
         program.compileOptions.insert(opts)
-        program._loweredProgramStorage = nil
         return true
       case .recompile:
         let _ = try Compiler(
@@ -14,6 +14,13 @@ internal import _RegexParser
 struct DSLList {
   var nodes: [DSLTree.Node]
   
+  /// The location in the pattern of each node, if recorded when converting
+  /// the list from a parsed pattern.
+  ///
+  /// Composing lists doesn't keep the locations, and they only describe
+  /// `nodes` while the two have the same count.
+  var sourceLocations: [SourceLocation?]? = nil
+
   // experimental
   var hasCapture: Bool = false
   var hasChildren: Bool {
@@ -36,6 +43,23 @@ struct DSLList {
     self.nodes = [.limitCaptureNesting]
     try! ast.root.convert(into: &nodes)
   }
+
+  /// Creates a list from `ast`, recording the source location of each node
+  /// in `sourceLocations`.
+  init(recordingLocationsOf ast: AST) {
+    self.nodes = [.limitCaptureNesting]
+    var locations: [SourceLocation?]? = [nil]
+    try! ast.root.convert(into: &nodes, locations: &locations)
+    self.sourceLocations = locations
+  }
+
+  /// The source location of each node, if recorded and still valid.
+  var validSourceLocations: [SourceLocation?]? {
+    guard let sourceLocations, sourceLocations.count == nodes.count else {
+      return nil
+    }
+    return sourceLocations
+  }
   
   var first: DSLTree.Node {
     nodes.first ?? .empty
@@ -45,18 +69,22 @@ struct DSLList {
 extension DSLList {
   mutating func append(_ node: DSLTree.Node) {
     nodes.append(node)
+    sourceLocations = nil
   }
   
   mutating func append(contentsOf other: some Sequence<DSLTree.Node>) {
     nodes.append(contentsOf: other)
+    sourceLocations = nil
   }
   
   mutating func prepend(_ node: DSLTree.Node) {
     nodes.insert(node, at: 0)
+    sourceLocations = nil
   }
   
   mutating func prepend(contentsOf other: some Collection<DSLTree.Node>) {
     nodes.insert(contentsOf: other, at: 0)
+    sourceLocations = nil
   }
 }
 
@@ -108,7 +108,8 @@ extension Regex {
   ///     // Prints "No match."
   ///
   /// The `wholeMatch(in:)` method can throw an error if this regex includes
-  /// a transformation closure that throws an error.
+  /// a transformation closure that throws an error, or if matching reaches
+  /// the limit set with ``matchingStepLimit(_:)``.
   ///
   /// - Parameter string: The string to match this regular expression against.
   /// - Returns: The match, if this regex matches the entirety of `string`;
@@ -146,7 +147,8 @@ extension Regex {
   ///     // Prints "No match."
   ///
   /// The `prefixMatch(in:)` method can throw an error if this regex includes
-  /// a transformation closure that throws an error.
+  /// a transformation closure that throws an error, or if matching reaches
+  /// the limit set with ``matchingStepLimit(_:)``.
   ///
   /// - Parameter string: The string to match this regular expression against.
   /// - Returns: The match, if this regex matches at the start of `string`;
@@ -176,7 +178,8 @@ extension Regex {
   ///     // Prints "2022"
   ///
   /// The `firstMatch(in:)` method can throw an error if this regex includes
-  /// a transformation closure that throws an error.
+  /// a transformation closure that throws an error, or if matching reaches
+  /// the limit set with ``matchingStepLimit(_:)``.
   ///
   /// - Parameter string: The string to match this regular expression against.
   /// - Returns: The match, if one is found; otherwise, `nil`.
@@ -213,7 +216,8 @@ extension Regex {
   ///     // Prints "No match."
   ///
   /// The `wholeMatch(in:)` method can throw an error if this regex includes
-  /// a transformation closure that throws an error.
+  /// a transformation closure that throws an error, or if matching reaches
+  /// the limit set with ``matchingStepLimit(_:)``.
   ///
   /// - Parameter string: The substring to match this regular expression
   ///   against.
@@ -252,7 +256,8 @@ extension Regex {
   ///     // Prints "No match."
   ///
   /// The `prefixMatch(in:)` method can throw an error if this regex includes
-  /// a transformation closure that throws an error.
+  /// a transformation closure that throws an error, or if matching reaches
+  /// the limit set with ``matchingStepLimit(_:)``.
   ///
   /// - Parameter string: The substring to match this regular expression
   ///   against.
@@ -283,7 +288,8 @@ extension Regex {
   ///     // Prints "2022"
   ///
   /// The `firstMatch(in:)` method can throw an error if this regex includes
-  /// a transformation closure that throws an error.
+  /// a transformation closure that throws an error, or if matching reaches
+  /// the limit set with ``matchingStepLimit(_:)``.
   ///
   /// - Parameter string: The substring to match this regular expression
   ///   against.
@@ -296,6 +302,17 @@ extension Regex {
       subjectBounds: bounds,
       searchBounds: bounds)
   }
+
+  /// Returns whether this regex matches anywhere in the given substring,
+  /// without producing the match itself.
+  func _containsMatch(in string: Substring) throws -> Bool {
+    let bounds = string.startIndex..<string.endIndex
+    return try Executor<Output>.containsMatch(
+      self.program.loweredProgram,
+      string.base,
+      subjectBounds: bounds,
+      searchBounds: bounds)
+  }
 }
 
 @available(SwiftStdlib 5.7, *)
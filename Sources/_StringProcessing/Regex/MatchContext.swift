@@ -0,0 +1,316 @@
+//===----------------------------------------------------------------------===//
+//
+// This source file is part of the Swift.org open source project
+//
+// Copyright (c) 2025 Apple Inc. and the Swift project authors
+// Licensed under Apache License v2.0 with Runtime Library Exception
+//
+// See https://swift.org/LICENSE.txt for license information
+//
+//===----------------------------------------------------------------------===//
+
+/// A reusable context for matching a regex against many inputs, such as
+/// log lines or the fields of a CSV file.
+///
+/// Each match operation on `Regex` sets up the matching engine from
+/// scratch. A match context keeps the engine's storage, and the states the
+/// regex's automaton has visited, from one call to the next:
+///
+///     var context = RegexMatchContext(/(\w+)=(\d+)/)
+///     for line in lines {
+///       if let match = try context.wholeMatch(in: line) {
+///         process(match.1, match.2)
+///       }
+///     }
+///
+/// The `...Range(in:)` methods, and the methods that write the UTF-8 offsets
+/// of a match and its captures to a buffer, find the same matches without
+/// building their output. Once the storage has grown to fit the regex and
+/// its inputs, they don't allocate at all.
+///
+/// A context is a value, so it's safe to keep one on each thread, but not to
+/// share a single context between threads. A context holds on to the last
+/// input it matched until the next match.
+@available(SwiftStdlib 6.1, *)
+public struct RegexMatchContext<Output> {
+  let program: MEProgram
+
+  /// The processor, once there's been an input to create it with.
+  var processor: Processor? = nil
+
+  /// The lazy DFAs for whole matches and for searches, if the regex can use
+  /// them. These are kept for the states they've cached.
+  var anchoredDFA: LazyDFA?
+  var searchingDFA: LazyDFA?
+
+  /// Creates a match context for `regex`.
+  public init(_ regex: Regex<Output>) {
+    self.program = regex.program.loweredProgram
+    self.anchoredDFA = LazyDFA(program, mode: .anchored)
+    self.searchingDFA = Executor<Output>._searchingLazyDFA(program)
+  }
+}
+
+@available(SwiftStdlib 6.1, *)
+extension RegexMatchContext {
+  /// Points the processor at `string`, creating it the first time.
+  mutating func _prepare(_ string: Substring, mode: MatchMode) {
+    let bounds = string.startIndex..<string.endIndex
+    if processor == nil {
+      processor = Processor(
+        program: program,
+        input: string.base,
+        subjectBounds: bounds,
+        searchBounds: bounds,
+        matchMode: mode)
+    } else {
+      processor!.reset(
+        input: string.base,
+        subjectBounds: bounds,
+        searchBounds: bounds,
+        matchMode: mode)
+    }
+  }
+
+  /// Returns a match if the regex matches the given string in its entirety.
+  ///
+  /// This is equivalent to `Regex.wholeMatch(in:)`.
+  public mutating func wholeMatch(
+    in string: String
+  ) throws -> Regex<Output>.Match? {
+    try wholeMatch(in: string[...])
+  }
+
+  /// Returns a match if the regex matches the given substring in its
+  /// entirety.
+  ///
+  /// This is equivalent to `Regex.wholeMatch(in:)`.
+  public mutating func wholeMatch(
+    in string: Substring
+  ) throws -> Regex<Output>.Match? {
+    _prepare(string, mode: .wholeString)
+    return try Executor._wholeMatch(
+      program, using: &processor!, lazyDFA: &anchoredDFA)
+  }
+
+  /// Returns a match if the regex matches the given string at its start.
+  ///
+  /// This is equivalent to `Regex.prefixMatch(in:)`.
+  public mutating func prefixMatch(
+    in string: String
+  ) throws -> Regex<Output>.Match? {
+    try prefixMatch(in: string[...])
+  }
+
+  /// Returns a match if the regex matches the given substring at its start.
+  ///
+  /// This is equivalent to `Regex.prefixMatch(in:)`.
+  public mutating func prefixMatch(
+    in string: Substring
+  ) throws -> Regex<Output>.Match? {
+    _prepare(string, mode: .partialFromFront)
+    return try Executor._run(program, &processor!)
+  }
+
+  /// Returns the first match of the regex in the given string.
+  ///
+  /// This is equivalent to `Regex.firstMatch(in:)`.
+  public mutating func firstMatch(
+    in string: String
+  ) throws -> Regex<Output>.Match? {
+    try firstMatch(in: string[...])
+  }
+
+  /// Returns the first match of the regex in the given substring.
+  ///
+  /// This is equivalent to `Regex.firstMatch(in:)`.
+  public mutating func firstMatch(
+    in string: Substring
+  ) throws -> Regex<Output>.Match? {
+    _prepare(string, mode: .partialFromFront)
+    return try Executor._firstMatch(
+      program, using: &processor!, lazyDFA: &searchingDFA)
+  }
+}
+
+@available(SwiftStdlib 6.1, *)
+extension RegexMatchContext {
+  /// Returns the range of the given string if the regex matches it in its
+  /// entirety, without building the match's output.
+  public mutating func wholeMatchRange(
+    in string: String
+  ) throws -> Range<String.Index>? {
+    try wholeMatchRange(in: string[...])
+  }
+
+  /// Returns the range of the given substring if the regex matches it in
+  /// its entirety, without building the match's output.
+  public mutating func wholeMatchRange(
+    in string: Substring
+  ) throws -> Range<String.Index>? {
+    _prepare(string, mode: .wholeString)
+    return try Executor<Output>._wholeMatchRange(
+      program, using: &processor!, lazyDFA: &anchoredDFA)
+  }
+
+  /// Returns the range of the first match of the regex in the given string,
+  /// without building the match's output.
+  public mutating func firstMatchRange(
+    in string: String
+  ) throws -> Range<String.Index>? {
+    try firstMatchRange(in: string[...])
+  }
+
+  /// Returns the range of the first match of the regex in the given
+  /// substring, without building the match's output.
+  public mutating func firstMatchRange(
+    in string: Substring
+  ) throws -> Range<String.Index>? {
+    _prepare(string, mode: .partialFromFront)
+    return try Executor<Output>._firstMatchRange(
+      program, using: &processor!, lazyDFA: &searchingDFA)
+  }
+}
+
+// MARK: - Match offsets
+
+@available(SwiftStdlib 6.1, *)
+extension RegexMatchContext {
+  /// The number of capture groups in the regex, not counting the whole
+  /// match.
+  ///
+  /// A buffer passed to the `offsets:` methods needs room for
+  /// `2 * (captureCount + 1)` offsets.
+  public var captureCount: Int {
+    program.captureList.captures.count - 1
+  }
+
+  /// Writes the UTF-8 offsets of the match that the processor just found,
+  /// relative to `base`, and of each of its captures to `offsets`.
+  func _writeOffsets(
+    _ range: Range<String.Index>,
+    from base: String.Index,
+    to offsets: UnsafeMutableBufferPointer<Int>
+  ) {
+    let utf8 = processor!.input.utf8
+    let storedCaptures = processor!.storedCaptures
+    offsets[0] = utf8.distance(from: base, to: range.lowerBound)
+    offsets[1] = utf8.distance(from: base, to: range.upperBound)
+    for i in storedCaptures.indices {
+      if let captureRange = storedCaptures[i].range {
+        offsets[2 * i + 2] = utf8.distance(
+          from: base, to: captureRange.lowerBound)
+        offsets[2 * i + 3] = utf8.distance(
+          from: base, to: captureRange.upperBound)
+      } else {
+        offsets[2 * i + 2] = -1
+        offsets[2 * i + 3] = -1
+      }
+    }
+  }
+
+  func _checkOffsetsCapacity(_ offsets: UnsafeMutableBufferPointer<Int>) {
+    precondition(
+      offsets.count >= 2 * (captureCount + 1),
+      "Offsets buffer is too small for the regex's captures")
+  }
+
+  /// Matches the regex against the given substring in its entirety, writing
+  /// the offsets of the match and its captures to `offsets`.
+  ///
+  /// The offsets are written in pairs: the start and end of the whole match,
+  /// then the start and end of each capture in order. Each offset is a count
+  /// of UTF-8 code units from the start of `string`, and captures that
+  /// didn't take part in the match have the offsets `-1` and `-1`. Nothing
+  /// is written if there's no match.
+  ///
+  /// This skips building the match's output, and doesn't allocate once the
+  /// context's storage has grown to fit. Capture transformations still run,
+  /// as they can decide whether the regex matches, but their results are
+  /// discarded.
+  ///
+  /// - Parameters:
+  ///   - string: The substring to match the regex against.
+  ///   - offsets: A buffer with room for at least `2 * (captureCount + 1)`
+  ///     offsets.
+  /// - Returns: Whether the regex matches `string`.
+  public mutating func wholeMatch(
+    in string: Substring,
+    offsets: UnsafeMutableBufferPointer<Int>
+  ) throws -> Bool {
+    _checkOffsetsCapacity(offsets)
+    _prepare(string, mode: .wholeString)
+    guard let range = try Executor<Output>._wholeMatchRange(
+      program, using: &processor!, lazyDFA: &anchoredDFA, capturing: true)
+    else { return false }
+    _writeOffsets(range, from: string.startIndex, to: offsets)
+    return true
+  }
+
+  /// Finds the first match of the regex in the given substring, writing the
+  /// offsets of the match and its captures to `offsets`.
+  ///
+  /// See `wholeMatch(in:offsets:)` for the layout of `offsets`.
+  ///
+  /// - Parameters:
+  ///   - string: The substring to search.
+  ///   - offsets: A buffer with room for at least `2 * (captureCount + 1)`
+  ///     offsets.
+  /// - Returns: Whether a match was found.
+  public mutating func firstMatch(
+    in string: Substring,
+    offsets: UnsafeMutableBufferPointer<Int>
+  ) throws -> Bool {
+    _checkOffsetsCapacity(offsets)
+    _prepare(string, mode: .partialFromFront)
+    guard let range = try Executor<Output>._firstMatchRange(
+      program, using: &processor!, lazyDFA: &searchingDFA)
+    else { return false }
+    _writeOffsets(range, from: string.startIndex, to: offsets)
+    return true
+  }
+
+  /// Finds every match of the regex in the given substring, as
+  /// `matches(of:)` does, writing the offsets of each match and its
+  /// captures to `offsets` and then calling `body`.
+  ///
+  /// See `wholeMatch(in:offsets:)` for the layout of `offsets`. The offsets
+  /// are overwritten by each match, so `body` should read them before it
+  /// returns:
+  ///
+  ///     var context = RegexMatchContext(try Regex(#"(\w+)@(\w+)"#))
+  ///     var offsets = [Int](repeating: 0, count: 6)
+  ///     try offsets.withUnsafeMutableBufferPointer { offsets in
+  ///       try context.forEachMatch(in: text[...], offsets: offsets) {
+  ///         print(offsets[2]..<offsets[3], offsets[4]..<offsets[5])
+  ///       }
+  ///     }
+  ///
+  /// - Parameters:
+  ///   - string: The substring to search.
+  ///   - offsets: A buffer with room for at least `2 * (captureCount + 1)`
+  ///     offsets.
+  ///   - body: A closure to call after each match is written to `offsets`.
+  public mutating func forEachMatch(
+    in string: Substring,
+    offsets: UnsafeMutableBufferPointer<Int>,
+    _ body: () throws -> Void
+  ) throws {
+    _checkOffsetsCapacity(offsets)
+    _prepare(string, mode: .partialFromFront)
+    while true {
+      guard let range = try Executor<Output>._firstMatchRange(
+        program, using: &processor!, lazyDFA: &searchingDFA)
+      else { return }
+      _writeOffsets(range, from: string.startIndex, to: offsets)
+      try body()
+
+      guard let next = Executor<Output>._nextSearchIndex(
+        after: range, program, string.base, processor!.subjectBounds)
+      else { return }
+      processor!.reset(
+        currentPosition: next,
+        searchBounds: next..<processor!.searchBounds.upperBound)
+    }
+  }
+}
@@ -295,8 +295,19 @@ extension RegexComponent {
       ? AST.MatchingOptionSequence(adding: [.init(option, location: .fake)])
       : AST.MatchingOptionSequence(removing: [.init(option, location: .fake)])
     
-    var list = regex.program.list
-    list.nodes.insert(.nonCapturingGroup(.init(ast: .changeMatchingOptions(sequence))), at: 0)
-    return Regex(list: list)
+    func wrapped() -> Regex<RegexOutput> {
+      var list = regex.program.list
+      list.nodes.insert(.nonCapturingGroup(.init(ast: .changeMatchingOptions(sequence))), at: 0)
+      return Regex(list: list)
+    }
+
+    // A regex made from a cached pattern shares the program for these
+    // options, too.
+    guard let key = regex.program.cacheKey else {
+      return wrapped()
+    }
+    return Regex(program: .cached(key.adding(option, isAdded: shouldAdd)) {
+      wrapped().program
+    })
   }
 }
@@ -0,0 +1,310 @@
+//===----------------------------------------------------------------------===//
+//
+// This source file is part of the Swift.org open source project
+//
+// Copyright (c) 2025 Apple Inc. and the Swift project authors
+// Licensed under Apache License v2.0 with Runtime Library Exception
+//
+// See https://swift.org/LICENSE.txt for license information
+//
+//===----------------------------------------------------------------------===//
+
+internal import _RegexParser
+
+@available(SwiftStdlib 6.1, *)
+extension Regex {
+  /// Returns a regular expression that records where its searches spend
+  /// their time in the given profile.
+  ///
+  /// Use a profile to find out why a regex is slow on some input. The
+  /// profile counts the steps the matching engine takes at each part of the
+  /// regex, along with how often matching backtracks there and how many
+  /// positions it has saved to backtrack to:
+  ///
+  ///     let profile = RegexProfile()
+  ///     let regex = try Regex(#"key: (.*?);"#).profiling(into: profile)
+  ///     _ = input.matches(of: regex)
+  ///     print(profile.report())
+  ///     // Prints the share of steps taken in each part of the pattern,
+  ///     // such as "80.0% of steps in `.*?` at columns 7-9".
+  ///
+  /// The report is `Codable`, so it can be saved as JSON with
+  /// `JSONEncoder`.
+  ///
+  /// Steps are counted for a regex that can be written as a pattern,
+  /// such as one created from a string or a regex literal, with each step
+  /// traced back to the columns of the pattern it was compiled from. Steps
+  /// of other regexes are counted without a location in the pattern.
+  ///
+  /// Searches with the returned regex skip some of the matching engine's
+  /// shortcuts, so that all of their steps are counted, and are slower than
+  /// searches with the original regex. Counts are added to the profile once
+  /// each search finishes.
+  ///
+  /// - Parameter profile: The profile to record in. Using the profile with
+  ///   this method again discards what it has recorded.
+  /// - Returns: The modified regular expression.
+  public func profiling(into profile: RegexProfile) -> Regex<RegexOutput> {
+    Regex(program: program.withProfile(profile.recorder))
+  }
+}
+
+/// The steps the matching engine took in searches with a regex, recorded by
+/// a regex returned from ``Regex/profiling(into:)``.
+///
+/// A profile can be shared by searches on different threads.
+@available(SwiftStdlib 6.1, *)
+public final class RegexProfile: @unchecked Sendable {
+  /// The recorded counts, which programs refer to directly so that the
+  /// matching engine doesn't depend on this type's availability.
+  let recorder = ProfileRecorder()
+
+  /// Creates an empty profile.
+  public init() {}
+
+  /// Discards the counts recorded so far.
+  public func reset() {
+    recorder.reset()
+  }
+
+  /// Returns a report of the counts recorded so far.
+  public func report() -> Report {
+    recorder.lock.withLock {
+      var report = Report(
+        pattern: recorder.pattern,
+        matchAttempts: recorder.matchAttempts,
+        steps: recorder.steps.reduce(0, +),
+        backtracks: recorder.backtracks.reduce(0, +),
+        maxSavePoints: recorder.maxSavePoints.max() ?? 0,
+        instructions: [],
+        regions: [])
+      for pc in recorder.instructionDescriptions.indices {
+        report.instructions.append(InstructionCounts(
+          address: pc,
+          description: recorder.instructionDescriptions[pc],
+          columns: recorder.instructionColumns[pc],
+          steps: recorder.steps[pc],
+          backtracks: recorder.backtracks[pc],
+          maxSavePoints: recorder.maxSavePoints[pc]))
+      }
+      if let pattern = recorder.pattern {
+        report.regions = Self.regions(
+          of: report.instructions, in: pattern, totalSteps: report.steps)
+      }
+      return report
+    }
+  }
+
+  /// Returns the counts for each part of `pattern` that instructions were
+  /// compiled from, most steps first.
+  private static func regions(
+    of instructions: [InstructionCounts],
+    in pattern: String,
+    totalSteps: Int
+  ) -> [Region] {
+    let allColumns = Set(instructions.compactMap(\.columns))
+    let characters = Array(pattern)
+    var result: [Region] = []
+    for columns in allColumns where columns.upperBound <= characters.count {
+      var region = Region(
+        columns: columns,
+        source: String(characters[columns]),
+        steps: 0,
+        backtracks: 0,
+        maxSavePoints: 0,
+        fractionOfSteps: 0)
+      // A region includes the parts of the pattern nested within it.
+      for inst in instructions {
+        guard let c = inst.columns,
+              c.lowerBound >= columns.lowerBound,
+              c.upperBound <= columns.upperBound
+        else { continue }
+        region.steps += inst.steps
+        region.backtracks += inst.backtracks
+        region.maxSavePoints = max(region.maxSavePoints, inst.maxSavePoints)
+      }
+      if totalSteps > 0 {
+        region.fractionOfSteps = Double(region.steps) / Double(totalSteps)
+      }
+      result.append(region)
+    }
+    return result.sorted {
+      ($0.steps, $1.columns.count, $1.columns.lowerBound)
+        > ($1.steps, $0.columns.count, $0.columns.lowerBound)
+    }
+  }
+}
+
+/// The counts recorded in a `RegexProfile`.
+final class ProfileRecorder {
+  /// Guards all of the recorder's state.
+  let lock = Lock()
+
+  /// The pattern of the profiled regex, if it has one.
+  var pattern: String? = nil
+
+  /// A description of each instruction of the profiled program.
+  var instructionDescriptions: [String] = []
+
+  /// The columns of the pattern that each instruction was compiled from.
+  var instructionColumns: [Range<Int>?] = []
+
+  var steps: [Int] = []
+  var backtracks: [Int] = []
+  var maxSavePoints: [Int] = []
+  var matchAttempts = 0
+
+  /// Discards the counts recorded so far.
+  func reset() {
+    lock.withLock {
+      resetCounts()
+    }
+  }
+
+  private func resetCounts() {
+    steps = Array(repeating: 0, count: instructionDescriptions.count)
+    backtracks = steps
+    maxSavePoints = steps
+    matchAttempts = 0
+  }
+
+  /// Starts recording for a regex with the given pattern, discarding
+  /// anything recorded for another regex.
+  func attach(pattern: String?) {
+    lock.withLock {
+      self.pattern = pattern
+      instructionDescriptions = []
+      instructionColumns = []
+      resetCounts()
+    }
+  }
+
+  /// Describes the instructions of `program`, which searches that record in
+  /// this profile run.
+  ///
+  /// Threads that compile the same regex at once all call this, with
+  /// equivalent programs.
+  func prepare(for program: MEProgram) {
+    let descriptions = program.instructions.map { "\($0)" }
+    var columns: [Range<Int>?] = Array(
+      repeating: nil, count: descriptions.count)
+    lock.withLock {
+      guard instructionDescriptions.count != descriptions.count else {
+        return
+      }
+      if let pattern, let locations = program.instructionLocations,
+         locations.count == columns.count {
+        for (pc, location) in locations.enumerated() {
+          guard let location, location.end <= pattern.endIndex else {
+            continue
+          }
+          let start = pattern.distance(
+            from: pattern.startIndex, to: location.start)
+          columns[pc] = start..<(start + pattern.distance(
+            from: location.start, to: location.end))
+        }
+      }
+      instructionDescriptions = descriptions
+      instructionColumns = columns
+      resetCounts()
+    }
+  }
+
+  /// Adds the counts recorded by a processor.
+  func merge(_ counts: Processor.ProfileCounts) {
+    lock.withLock {
+      guard counts.steps.count == steps.count else { return }
+      for pc in steps.indices {
+        steps[pc] += counts.steps[pc]
+        backtracks[pc] += counts.backtracks[pc]
+        maxSavePoints[pc] = max(maxSavePoints[pc], counts.maxSavePoints[pc])
+      }
+      matchAttempts += counts.matchAttempts
+    }
+  }
+}
+
+@available(SwiftStdlib 6.1, *)
+extension RegexProfile {
+  /// The counts recorded for a regex.
+  public struct Report: Codable, Hashable, CustomStringConvertible {
+    /// The pattern of the regex, or `nil` if it can't be written as one.
+    public var pattern: String?
+    /// The number of positions in the input that a match was tried from.
+    public var matchAttempts: Int
+    /// The total number of steps the matching engine took.
+    public var steps: Int
+    /// The total number of times matching backtracked.
+    public var backtracks: Int
+    /// The most positions saved to backtrack to at once.
+    public var maxSavePoints: Int
+    /// The counts for each instruction of the compiled regex, in program
+    /// order.
+    public var instructions: [InstructionCounts]
+    /// The counts for each part of the pattern, most steps first.
+    public var regions: [Region]
+
+    public var description: String {
+      var result = pattern.map { "Profile of `\($0)`: " } ?? "Profile: "
+      result += """
+        \(steps) steps, \(backtracks) backtracks, at most \
+        \(maxSavePoints) save points, in \(matchAttempts) match attempts
+        """
+      if regions.isEmpty {
+        for inst in instructions where inst.steps > 0 {
+          result += """
+
+              [\(inst.address)] \(inst.description): \(inst.steps) steps, \
+            \(inst.backtracks) backtracks
+            """
+        }
+      }
+      for region in regions where region.steps > 0 {
+        result += "\n  \(region)"
+      }
+      return result
+    }
+  }
+
+  /// The counts recorded for one instruction of the compiled regex.
+  public struct InstructionCounts: Codable, Hashable {
+    /// The instruction's position in the program.
+    public var address: Int
+    /// A description of the instruction.
+    public var description: String
+    /// The columns of the pattern, counted in characters from zero, that
+    /// the instruction was compiled from, if known.
+    public var columns: Range<Int>?
+    /// The number of times the instruction ran.
+    public var steps: Int
+    /// The number of times matching failed at the instruction.
+    public var backtracks: Int
+    /// The most save points there were right after the instruction ran.
+    public var maxSavePoints: Int
+  }
+
+  /// The counts recorded for the instructions compiled from a part of the
+  /// pattern, including the parts nested within it.
+  public struct Region: Codable, Hashable, CustomStringConvertible {
+    /// The columns of the pattern, counted in characters from zero.
+    public var columns: Range<Int>
+    /// The text of the pattern in `columns`.
+    public var source: String
+    public var steps: Int
+    public var backtracks: Int
+    public var maxSavePoints: Int
+    /// The share of all the steps that were taken in this region.
+    public var fractionOfSteps: Double
+
+    public var description: String {
+      let percentage = (fractionOfSteps * 1000).rounded() / 10
+      let location = columns.count == 1
+        ? "column \(columns.lowerBound + 1)"
+        : "columns \(columns.lowerBound + 1)-\(columns.upperBound)"
+      return """
+        \(percentage)% of steps in `\(source)` at \(location) \
+        (\(backtracks) backtracks, at most \(maxSavePoints) save points)
+        """
+    }
+  }
+}
@@ -0,0 +1,250 @@
+//===----------------------------------------------------------------------===//
+//
+// This source file is part of the Swift.org open source project
+//
+// Copyright (c) 2025 Apple Inc. and the Swift project authors
+// Licensed under Apache License v2.0 with Runtime Library Exception
+//
+// See https://swift.org/LICENSE.txt for license information
+//
+//===----------------------------------------------------------------------===//
+
+internal import _RegexParser
+
+/// The process-wide cache of regexes created from strings at run time.
+///
+/// Creating a regex with ``Regex/init(_:)`` or ``Regex/init(_:as:)`` parses
+/// the pattern, and the first match compiles it. Regexes created from the
+/// same pattern share the parsed and compiled forms through this cache, as
+/// do regexes derived from them with the same matching options, such as
+/// `try Regex(pattern).ignoresCase()`. When the cache is full, the least
+/// recently used pattern is evicted.
+///
+/// The cache is safe to use from multiple threads.
+@available(SwiftStdlib 6.1, *)
+public enum RegexCache {
+  /// Counts of cache lookups, for measuring how well the cache works.
+  public struct Statistics: Hashable {
+    /// The number of regexes created from a cached pattern.
+    public var hits: Int
+    /// The number of regexes created from a pattern that wasn't cached.
+    public var misses: Int
+    /// The number of patterns evicted to make room for others.
+    public var evictions: Int
+    /// The number of patterns currently in the cache.
+    public var count: Int
+  }
+
+  /// The largest number of patterns that the cache holds.
+  ///
+  /// The default capacity is 256. Lowering the capacity evicts patterns
+  /// until the cache fits, and a capacity of zero turns the cache off.
+  public static var capacity: Int {
+    get { ProgramCache.shared.lock.withLock { ProgramCache.shared.capacity } }
+    set {
+      precondition(newValue >= 0, "Cache capacity must not be negative")
+      ProgramCache.shared.lock.withLock {
+        ProgramCache.shared.capacity = newValue
+        ProgramCache.shared.evictToCapacity()
+      }
+    }
+  }
+
+  /// The cache's counts of lookups since the process started or the last
+  /// call to ``resetStatistics()``.
+  public static var statistics: Statistics {
+    let cache = ProgramCache.shared
+    return cache.lock.withLock {
+      Statistics(
+        hits: cache.hits,
+        misses: cache.misses,
+        evictions: cache.evictions,
+        count: cache.count)
+    }
+  }
+
+  /// Sets the cache's counts of lookups to zero.
+  public static func resetStatistics() {
+    let cache = ProgramCache.shared
+    cache.lock.withLock {
+      cache.hits = 0
+      cache.misses = 0
+      cache.evictions = 0
+    }
+  }
+
+  /// Removes every pattern from the cache.
+  ///
+  /// Regexes that were already created keep working, and don't share their
+  /// compiled forms with regexes created afterwards.
+  public static func removeAll() {
+    ProgramCache.shared.lock.withLock {
+      ProgramCache.shared.removeAll()
+    }
+  }
+}
+
+/// What a cached program was created from.
+struct ProgramCacheKey: Hashable {
+  struct Option: Hashable {
+    var kind: AST.MatchingOption.Kind
+    var isAdded: Bool
+  }
+
+  var pattern: String
+  var syntax: UInt
+  var outputType: ObjectIdentifier
+
+  /// The matching options applied to the regex, outermost last.
+  var options: [Option] = []
+
+  init(pattern: String, syntax: SyntaxOptions, outputType: Any.Type) {
+    self.pattern = pattern
+    self.syntax = syntax.rawValue
+    self.outputType = ObjectIdentifier(outputType)
+  }
+
+  func adding(_ kind: AST.MatchingOption.Kind, isAdded: Bool) -> Self {
+    var result = self
+    result.options.append(Option(kind: kind, isAdded: isAdded))
+    return result
+  }
+}
+
+/// A least-recently-used cache of `Regex.Program` instances.
+///
+/// Programs are stored as `AnyObject`, since each `Regex` output type has
+/// its own `Program` class; the key's output type keeps them apart.
+final class ProgramCache {
+  static let shared = ProgramCache(capacity: 256)
+
+  private struct Entry {
+    var key: ProgramCacheKey
+    /// The program, or `nil` if the entry is free.
+    var program: AnyObject?
+    var newer: Int?
+    var older: Int?
+  }
+
+  /// Guards all of the cache's state.
+  let lock = Lock()
+
+  var capacity: Int
+  var hits = 0
+  var misses = 0
+  var evictions = 0
+
+  private var entries: [Entry] = []
+  private var freeEntries: [Int] = []
+  private var indices: [ProgramCacheKey: Int] = [:]
+  private var newest: Int? = nil
+  private var oldest: Int? = nil
+
+  /// The number of cached programs.
+  var count: Int { indices.count }
+
+  init(capacity: Int) {
+    self.capacity = capacity
+  }
+
+  /// Returns the program cached for `key`, calling `makeProgram` to create
+  /// and cache one if there isn't one.
+  ///
+  /// `makeProgram` is called without holding the lock, so if two threads
+  /// miss at once, the first to finish is cached and returned to both.
+  func program(
+    for key: ProgramCacheKey,
+    _ makeProgram: () throws -> AnyObject
+  ) rethrows -> AnyObject {
+    let cached: AnyObject? = lock.withLock {
+      guard let index = indices[key] else {
+        misses += 1
+        return nil
+      }
+      hits += 1
+      moveToFront(index)
+      return entries[index].program!
+    }
+    if let cached {
+      return cached
+    }
+
+    let program = try makeProgram()
+    return lock.withLock {
+      guard capacity > 0 else { return program }
+      if let index = indices[key] {
+        moveToFront(index)
+        return entries[index].program!
+      }
+      insert(Entry(key: key, program: program))
+      evictToCapacity()
+      return program
+    }
+  }
+
+  func evictToCapacity() {
+    while indices.count > capacity, let index = oldest {
+      unlink(index)
+      indices[entries[index].key] = nil
+      entries[index].program = nil
+      freeEntries.append(index)
+      evictions += 1
+    }
+  }
+
+  func removeAll() {
+    entries.removeAll()
+    freeEntries.removeAll()
+    indices.removeAll()
+    newest = nil
+    oldest = nil
+  }
+
+  // MARK: Recency list
+
+  private func insert(_ entry: Entry) {
+    let index: Int
+    if let free = freeEntries.popLast() {
+      index = free
+      entries[index] = entry
+    } else {
+      index = entries.count
+      entries.append(entry)
+    }
+    indices[entry.key] = index
+    link(index)
+  }
+
+  private func moveToFront(_ index: Int) {
+    guard newest != index else { return }
+    unlink(index)
+    link(index)
+  }
+
+  /// Makes the entry at `index` the newest.
+  private func link(_ index: Int) {
+    entries[index].older = newest
+    entries[index].newer = nil
+    if let newest {
+      entries[newest].newer = index
+    }
+    newest = index
+    if oldest == nil {
+      oldest = index
+    }
+  }
+
+  private func unlink(_ index: Int) {
+    let (newer, older) = (entries[index].newer, entries[index].older)
+    if let newer {
+      entries[newer].older = older
+    } else {
+      newest = older
+    }
+    if let older {
+      entries[older].newer = newer
+    } else {
+      oldest = newer
+    }
+  }
+}
@@ -0,0 +1,196 @@
+//===----------------------------------------------------------------------===//
+//
+// This source file is part of the Swift.org open source project
+//
+// Copyright (c) 2025 Apple Inc. and the Swift project authors
+// Licensed under Apache License v2.0 with Runtime Library Exception
+//
+// See https://swift.org/LICENSE.txt for license information
+//
+//===----------------------------------------------------------------------===//
+
+internal import _RegexParser
+
+/// A collection of regular expressions that are matched against a string
+/// together.
+///
+/// Use a regex set when you need to know which of many independent patterns
+/// match the same input, such as when classifying log lines:
+///
+///     let rules = try RegexSet([
+///       #"ERROR \w+"#,
+///       #"timeout after \d+ms"#,
+///       #"user=(\w+)"#,
+///     ])
+///     let line = "ERROR net: timeout after 300ms"
+///     print(try rules.matchingIndices(in: line))
+///     // Prints "[0, 1]"
+///
+/// Rather than searching the input once per regex, a regex set first finds
+/// every literal that one of its regexes requires in a single pass over the
+/// input. Only the regexes whose required literal occurs, and those that
+/// have no required literal, are then run against the input.
+@available(SwiftStdlib 6.1, *)
+public struct RegexSet {
+  /// The lowered program for each regex, in the order they were given.
+  let programs: [MEProgram]
+
+  /// Searches for the required literals of the regexes that have one.
+  let literalSearcher: MultiLiteralSearcher?
+
+  /// The regex that each literal in `literalSearcher` belongs to.
+  let literalOwners: [Int]
+
+  /// The regexes that have no case-sensitive required literal, and so must
+  /// always be run.
+  let unfilteredIndices: [Int]
+
+  init(programs: [MEProgram]) {
+    self.programs = programs
+
+    var literals: [[UInt8]] = []
+    var literalOwners: [Int] = []
+    var unfilteredIndices: [Int] = []
+    for (index, program) in programs.enumerated() {
+      if let prefilter = program.prefilter, !prefilter.isCaseInsensitive,
+         !prefilter.requiredLiteral.isEmpty {
+        literals.append(prefilter.requiredLiteral)
+        literalOwners.append(index)
+      } else {
+        unfilteredIndices.append(index)
+      }
+    }
+    self.literalSearcher = literals.isEmpty
+      ? nil
+      : MultiLiteralSearcher(literals)
+    self.literalOwners = literalOwners
+    self.unfilteredIndices = unfilteredIndices
+  }
+
+  /// Creates a regex set from the given regexes.
+  ///
+  /// Each regex is compiled, if it hasn't been already, and the compiled
+  /// program is shared with the original regex.
+  ///
+  /// - Parameter regexes: The regexes to match together.
+  public init<Output>(_ regexes: [Regex<Output>]) {
+    self.init(programs: regexes.map { $0.program.loweredProgram })
+  }
+
+  /// Creates a regex set from the given regex patterns.
+  ///
+  /// - Parameter patterns: The patterns to match together, each using regex
+  ///   syntax.
+  /// - Throws: An error if any pattern is not a valid regex.
+  public init<Patterns: Sequence>(
+    _ patterns: Patterns
+  ) throws where Patterns.Element == String {
+    self.init(try patterns.map { try Regex<AnyRegexOutput>($0) })
+  }
+
+  /// The number of regexes in the set.
+  public var count: Int {
+    programs.count
+  }
+}
+
+@available(SwiftStdlib 6.1, *)
+extension RegexSet {
+  /// The first match of one of the regexes in a set.
+  public struct Match {
+    /// The position of the matching regex in the set.
+    public let index: Int
+
+    /// The range of the first match of the regex.
+    public let range: Range<String.Index>
+  }
+
+  /// Returns the indices of the regexes in this set that match somewhere in
+  /// the given string, in ascending order.
+  ///
+  /// - Parameter string: The string to search.
+  /// - Returns: The indices of the matching regexes.
+  public func matchingIndices(in string: String) throws -> [Int] {
+    try _matchingIndices(in: string[...])
+  }
+
+  /// Returns the indices of the regexes in this set that match somewhere in
+  /// the given substring, in ascending order.
+  ///
+  /// - Parameter string: The substring to search.
+  /// - Returns: The indices of the matching regexes.
+  public func matchingIndices(in string: Substring) throws -> [Int] {
+    try _matchingIndices(in: string)
+  }
+
+  /// Returns the first match of each regex in this set that matches
+  /// somewhere in the given string, in ascending order of the regexes'
+  /// indices.
+  ///
+  /// - Parameter string: The string to search.
+  /// - Returns: The first match of each matching regex.
+  public func firstMatches(in string: String) throws -> [Match] {
+    try _firstMatches(in: string[...])
+  }
+
+  /// Returns the first match of each regex in this set that matches
+  /// somewhere in the given substring, in ascending order of the regexes'
+  /// indices.
+  ///
+  /// - Parameter string: The substring to search.
+  /// - Returns: The first match of each matching regex.
+  public func firstMatches(in string: Substring) throws -> [Match] {
+    try _firstMatches(in: string)
+  }
+}
+
+@available(SwiftStdlib 6.1, *)
+extension RegexSet {
+  /// Returns the indices of the regexes that could match within `bounds`,
+  /// in ascending order.
+  func _candidates(in input: String, _ bounds: Range<String.Index>) -> [Int] {
+    guard let literalSearcher else { return unfilteredIndices }
+
+    var isCandidate = [Bool](repeating: false, count: programs.count)
+    for index in unfilteredIndices {
+      isCandidate[index] = true
+    }
+    var remaining = literalOwners.count
+    literalSearcher.forEachLiteral(in: input, bounds) { literal in
+      let owner = literalOwners[literal]
+      if !isCandidate[owner] {
+        isCandidate[owner] = true
+        remaining -= 1
+      }
+      return remaining > 0
+    }
+    return isCandidate.indices.filter { isCandidate[$0] }
+  }
+
+  func _matchingIndices(in string: Substring) throws -> [Int] {
+    let bounds = string.startIndex..<string.endIndex
+    return try _candidates(in: string.base, bounds).filter {
+      try Executor<AnyRegexOutput>.containsMatch(
+        programs[$0],
+        string.base,
+        subjectBounds: bounds,
+        searchBounds: bounds)
+    }
+  }
+
+  func _firstMatches(in string: Substring) throws -> [Match] {
+    let bounds = string.startIndex..<string.endIndex
+    var result: [Match] = []
+    for index in _candidates(in: string.base, bounds) {
+      if let match = try Executor<AnyRegexOutput>.firstMatch(
+        programs[index],
+        string.base,
+        subjectBounds: bounds,
+        searchBounds: bounds
+      ) {
+        result.append(Match(index: index, range: match.range))
+      }
+    }
+    return result
+  }
+}
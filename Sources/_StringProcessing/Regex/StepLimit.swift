@@ -0,0 +1,67 @@
+//===----------------------------------------------------------------------===//
+//
+// This source file is part of the Swift.org open source project
+//
+// Copyright (c) 2025 Apple Inc. and the Swift project authors
+// Licensed under Apache License v2.0 with Runtime Library Exception
+//
+// See https://swift.org/LICENSE.txt for license information
+//
+//===----------------------------------------------------------------------===//
+
+@available(SwiftStdlib 6.1, *)
+extension Regex {
+  /// Returns a regular expression that stops matching after the given
+  /// number of steps.
+  ///
+  /// A regex with nested or overlapping quantifiers, such as `(a|aa)+b`,
+  /// can take time exponential in the length of the input to find that a
+  /// match fails. The matching engine avoids this for many regexes by
+  /// remembering which parts of the input each part of the regex has
+  /// already failed to match, but a regex that uses backreferences, bounded
+  /// repetition, or atomic groups can still take a long time. Use a step
+  /// limit when matching regexes that come from an untrusted source:
+  ///
+  ///     let regex = try Regex(pattern).matchingStepLimit(1_000_000)
+  ///     do {
+  ///         if let match = try regex.firstMatch(in: input) {
+  ///             // ...
+  ///         }
+  ///     } catch is RegexStepLimitExceeded {
+  ///         // Matching took too long.
+  ///     }
+  ///
+  /// Each search for a match, such as each match found by
+  /// `matches(of:)`, can take up to `limit` steps. The number of steps a
+  /// search takes is roughly proportional to the time it takes. Methods
+  /// that throw, like `firstMatch(in:)`, throw a
+  /// ``RegexStepLimitExceeded`` error when a search reaches the limit;
+  /// methods that don't throw, like `firstMatch(of:)`, find no match.
+  ///
+  /// The limit applies when matching with this regex directly, not when it
+  /// is used as a component of another regex.
+  ///
+  /// - Parameter limit: The largest number of steps a search can take. Pass
+  ///   `nil` to remove the limit.
+  /// - Returns: The modified regular expression.
+  public func matchingStepLimit(_ limit: Int?) -> Regex<RegexOutput> {
+    precondition((limit ?? 0) >= 0, "Step limit must not be negative")
+    return Regex(program: program.withStepLimit(limit))
+  }
+}
+
+/// An error thrown when a search for a match reaches the step limit set with
+/// ``Regex/matchingStepLimit(_:)``.
+@available(SwiftStdlib 6.1, *)
+public struct RegexStepLimitExceeded: Error, Hashable, CustomStringConvertible {
+  /// The step limit that the search reached.
+  public var limit: Int
+
+  init(limit: Int) {
+    self.limit = limit
+  }
+
+  public var description: String {
+    "Matching stopped after reaching the step limit of \(limit)"
+  }
+}
@@ -0,0 +1,355 @@
+//===----------------------------------------------------------------------===//
+//
+// This source file is part of the Swift.org open source project
+//
+// Copyright (c) 2025 Apple Inc. and the Swift project authors
+// Licensed under Apache License v2.0 with Runtime Library Exception
+//
+// See https://swift.org/LICENSE.txt for license information
+//
+//===----------------------------------------------------------------------===//
+
+internal import _RegexParser
+
+/// A matcher that finds the matches of a regex in UTF-8 input that arrives
+/// a chunk at a time, such as from a file or socket.
+///
+/// Feed chunks of input to the matcher as they arrive, and call `finish()`
+/// after the last one. Each call returns the matches that can no longer be
+/// changed by further input, in order:
+///
+///     var matcher = RegexStreamMatcher(/ERROR: [^\n]+/)
+///     for chunk in chunks {
+///       for match in try matcher.feed(chunk) {
+///         print(match.utf8Offsets, match.output)
+///       }
+///     }
+///     for match in try matcher.finish() {
+///       print(match.utf8Offsets, match.output)
+///     }
+///
+/// Matches can span chunk boundaries. To keep memory bounded regardless of
+/// the length of the input, the matcher only retains the input needed for
+/// matches of up to `maximumMatchLength` UTF-8 code units, along with as
+/// much input before the current search position for lookbehind, `\b`, and
+/// similar assertions. A match is never longer than `maximumMatchLength`:
+/// the regex is matched against at most that much input from where each
+/// match begins, so where it would match further, the match it finds in
+/// that input is returned instead, by the usual leftmost-first rules, or
+/// none at all. A match is returned once `maximumMatchLength` code units
+/// of input after its start have arrived, or when the stream finishes.
+///
+/// Input that isn't valid UTF-8 is repaired as in `String(decoding:as:)`,
+/// and offsets refer to the repaired input.
+@available(SwiftStdlib 6.1, *)
+public struct RegexStreamMatcher<Output> {
+  /// A match found in the input stream.
+  public struct Match {
+    /// The match, within the portion of the input retained when it was
+    /// found.
+    public let match: Regex<Output>.Match
+
+    /// The offsets of the match in the UTF-8 input stream.
+    public let utf8Offsets: Range<Int>
+
+    /// The output produced from the match operation.
+    public var output: Output {
+      match.output
+    }
+  }
+
+  let program: MEProgram
+
+  /// The longest match that can be found, in UTF-8 code units.
+  public let maximumMatchLength: Int
+
+  /// The retained input.
+  var buffer = ""
+
+  /// The offset in the input stream of the start of `buffer`.
+  var bufferOffset = 0
+
+  /// The offset in `buffer` of the next position to search from.
+  var searchOffset = 0
+
+  /// The bytes at the end of the last chunk that don't yet form a complete
+  /// Unicode scalar.
+  var partialScalar: [UInt8] = []
+
+  var isFinished = false
+
+  /// Creates a stream matcher for `regex`.
+  ///
+  /// - Parameters:
+  ///   - regex: The regex to match.
+  ///   - maximumMatchLength: The longest match to find, in UTF-8 code
+  ///     units. This is also the amount of input retained before the search
+  ///     position for assertions that look behind it.
+  public init(_ regex: Regex<Output>, maximumMatchLength: Int = 4096) {
+    precondition(maximumMatchLength > 0, "maximumMatchLength must be positive")
+    self.program = regex.program.loweredProgram
+    self.maximumMatchLength = maximumMatchLength
+  }
+
+  /// Appends a chunk of UTF-8 input, returning the matches that it
+  /// completes.
+  ///
+  /// - Parameter chunk: The next bytes of the input stream.
+  /// - Returns: The matches that can no longer be changed by further input.
+  public mutating func feed<Bytes: Sequence>(
+    _ chunk: Bytes
+  ) throws -> [Match] where Bytes.Element == UInt8 {
+    precondition(!isFinished, "Fed input to a finished stream matcher")
+    // Contiguous chunks are decoded in place, unless there's the start of a
+    // scalar left over from the last one to put in front.
+    let decodedInPlace: Void? = partialScalar.isEmpty
+      ? chunk.withContiguousStorageIfAvailable { _append($0) }
+      : nil
+    if decodedInPlace == nil {
+      partialScalar.append(contentsOf: chunk)
+      let complete = Self._completeScalarsLength(partialScalar)
+      if complete > 0 {
+        buffer += String(decoding: partialScalar[..<complete], as: UTF8.self)
+        partialScalar.removeFirst(complete)
+      }
+    }
+    return try _drain(isFinal: false)
+  }
+
+  /// Finds the matches in a buffer of UTF-8 that's too large to copy at
+  /// once, such as a memory-mapped file, and then finishes the stream.
+  ///
+  /// The buffer is fed to the matcher a chunk at a time, so the input that's
+  /// copied at any one time is bounded by `chunkLength` and by the input the
+  /// matcher retains, rather than by the size of the buffer. A file mapped
+  /// with Foundation can be searched like this:
+  ///
+  ///     let log = try Data(contentsOf: url, options: .alwaysMapped)
+  ///     var matcher = RegexStreamMatcher(/ERROR: [^\n]+/)
+  ///     try log.withUnsafeBytes { bytes in
+  ///       try matcher.forEachMatch(in: bytes) { match in
+  ///         print(match.utf8Offsets)
+  ///       }
+  ///     }
+  ///
+  /// - Parameters:
+  ///   - utf8: The rest of the input stream.
+  ///   - chunkLength: The number of bytes to feed to the matcher at once.
+  ///   - body: A closure to call with each match, in order.
+  public mutating func forEachMatch(
+    in utf8: UnsafeRawBufferPointer,
+    chunkLength: Int = 1 << 16,
+    _ body: (Match) throws -> Void
+  ) throws {
+    precondition(chunkLength > 0, "chunkLength must be positive")
+    let bytes = UnsafeBufferPointer(
+      start: utf8.baseAddress?.assumingMemoryBound(to: UInt8.self),
+      count: utf8.count)
+    var start = 0
+    while start < bytes.count {
+      let end = start + Swift.min(chunkLength, bytes.count - start)
+      for match in try feed(UnsafeBufferPointer(rebasing: bytes[start..<end])) {
+        try body(match)
+      }
+      start = end
+    }
+    for match in try finish() {
+      try body(match)
+    }
+  }
+
+  /// Marks the end of the input stream, returning the remaining matches.
+  ///
+  /// - Returns: The matches in the input that haven't already been
+  ///   returned.
+  public mutating func finish() throws -> [Match] {
+    precondition(!isFinished, "Finished a stream matcher twice")
+    if !partialScalar.isEmpty {
+      buffer += String(decoding: partialScalar, as: UTF8.self)
+      partialScalar.removeAll()
+    }
+    defer { isFinished = true }
+    return try _drain(isFinal: true)
+  }
+}
+
+@available(SwiftStdlib 6.1, *)
+extension RegexStreamMatcher {
+  /// Appends the complete scalars in `bytes` to the retained input, and
+  /// keeps the rest for the next chunk.
+  mutating func _append(_ bytes: UnsafeBufferPointer<UInt8>) {
+    let complete = Self._completeScalarsLength(bytes)
+    if complete > 0 {
+      buffer += String(
+        decoding: UnsafeBufferPointer(rebasing: bytes[..<complete]),
+        as: UTF8.self)
+    }
+    partialScalar.append(contentsOf: bytes[complete...])
+  }
+
+  static func _completeScalarsLength(_ bytes: [UInt8]) -> Int {
+    bytes.withUnsafeBufferPointer { _completeScalarsLength($0) }
+  }
+
+  /// Returns the length of the prefix of `bytes` that doesn't end in the
+  /// middle of a multi-byte scalar.
+  static func _completeScalarsLength(
+    _ bytes: UnsafeBufferPointer<UInt8>
+  ) -> Int {
+    var i = bytes.count
+    var continuationCount = 0
+    while i > 0 && continuationCount < 4 {
+      let byte = bytes[i - 1]
+      if byte & 0b1100_0000 == 0b1000_0000 {
+        continuationCount += 1
+        i -= 1
+        continue
+      }
+      let scalarLength: Int
+      switch byte {
+      case 0b1111_0000...: scalarLength = 4
+      case 0b1110_0000...: scalarLength = 3
+      case 0b1100_0000...: scalarLength = 2
+      default: scalarLength = 1
+      }
+      return scalarLength > continuationCount + 1 ? i - 1 : bytes.count
+    }
+    return bytes.count
+  }
+
+  func _index(atOffset offset: Int) -> String.Index {
+    buffer.utf8.index(buffer.startIndex, offsetBy: offset)
+  }
+
+  func _offset(of index: String.Index) -> Int {
+    buffer.utf8.distance(from: buffer.startIndex, to: index)
+  }
+
+  /// Returns the offset of the last character boundary at or before
+  /// `offset`.
+  func _characterAligned(atOrBefore offset: Int) -> Int {
+    guard offset > 0 else { return 0 }
+    guard offset < buffer.utf8.count else { return buffer.utf8.count }
+    var i = _index(atOffset: offset)
+    while !buffer.isOnGraphemeClusterBoundary(i) {
+      i = buffer.utf8.index(before: i)
+    }
+    return _offset(of: i)
+  }
+
+  /// Returns the offset up to which the retained input is final.
+  ///
+  /// The last character could be extended by the next chunk, and an
+  /// assertion at the end of the one before it would look at the last, so
+  /// both are held back until more input arrives.
+  func _settledLength(isFinal: Bool) -> Int {
+    if isFinal {
+      return buffer.utf8.count
+    }
+    var i = buffer.endIndex
+    for _ in 0..<2 where i > buffer.startIndex {
+      i = buffer.index(before: i)
+    }
+    return _offset(of: i)
+  }
+
+  mutating func _drain(isFinal: Bool) throws -> [Match] {
+    var result: [Match] = []
+    let bounds = buffer.startIndex..<buffer.endIndex
+    let settled = _settledLength(isFinal: isFinal)
+
+    // Until the stream finishes, only starts with `maximumMatchLength` of
+    // settled input after them are tried, since more input could still
+    // change what matches at a later start. Each start is then tried by a
+    // single call, rather than again for every chunk that arrives while it
+    // waits.
+    let lastStart: Int
+    if isFinal {
+      lastStart = settled
+    } else {
+      guard settled - maximumMatchLength >= searchOffset else { return [] }
+      lastStart = Swift.max(
+        searchOffset,
+        _characterAligned(atOrBefore: settled - maximumMatchLength))
+    }
+    let startLimit = isFinal ? nil : _index(atOffset: lastStart)
+
+    while searchOffset <= lastStart {
+      let low = _index(atOffset: searchOffset)
+      var cpu = Processor(
+        program: program,
+        input: buffer,
+        subjectBounds: bounds,
+        searchBounds: low..<_index(atOffset: settled),
+        matchMode: .partialFromFront)
+      var lazyDFA: LazyDFA? = nil
+      guard let candidate = try Executor<Output>._firstMatch(
+        program, using: &cpu, lazyDFA: &lazyDFA, startLimit: startLimit)
+      else {
+        searchOffset = isFinal
+          ? settled + 1
+          : _offset(of: _nextPosition(after: startLimit!))
+        break
+      }
+      let start = _offset(of: candidate.range.lowerBound)
+
+      // Match again within the window, so the result doesn't depend on how
+      // much input happened to be retained.
+      let windowEnd = _characterAligned(
+        atOrBefore: Swift.min(settled, start + maximumMatchLength))
+      let match = try Executor<Output>.prefixMatch(
+        program,
+        buffer,
+        subjectBounds: bounds,
+        searchBounds: candidate.range.lowerBound..<_index(atOffset: windowEnd))
+
+      let nextSearch: String.Index
+      if let match {
+        let end = _offset(of: match.range.upperBound)
+        result.append(Match(
+          match: match,
+          utf8Offsets: (bufferOffset + start)..<(bufferOffset + end)))
+        nextSearch = match.range.isEmpty
+          ? _nextPosition(after: match.range.upperBound)
+          : match.range.upperBound
+      } else {
+        nextSearch = _nextPosition(after: candidate.range.lowerBound)
+      }
+      if nextSearch == buffer.endIndex && candidate.range.lowerBound == nextSearch {
+        searchOffset = settled + 1
+        break
+      }
+      searchOffset = _offset(of: nextSearch)
+    }
+
+    _discardSettledInput()
+    return result
+  }
+
+  /// Returns the position after `i` for the program's semantic level, or
+  /// `buffer.endIndex` if `i` is already there.
+  func _nextPosition(after i: String.Index) -> String.Index {
+    guard i < buffer.endIndex else { return buffer.endIndex }
+    switch program.initialOptions.semanticLevel {
+    case .graphemeCluster:
+      return buffer.index(after: i)
+    case .unicodeScalar:
+      return buffer.unicodeScalars.index(after: i)
+    }
+  }
+
+  /// Drops the retained input that's no longer needed, keeping
+  /// `maximumMatchLength` code units before the search position for
+  /// assertions that look behind it.
+  mutating func _discardSettledInput() {
+    let keep = _characterAligned(
+      atOrBefore: Swift.min(searchOffset, buffer.utf8.count)
+        - maximumMatchLength)
+    // Only copy the retained input once a good share of it can be dropped,
+    // so the cost is amortized over the input.
+    guard keep > 0, keep >= buffer.utf8.count / 2 else { return }
+    buffer = String(buffer[_index(atOffset: keep)...])
+    bufferOffset += keep
+    searchOffset -= keep
+  }
+}
@@ -73,6 +73,11 @@ extension UInt8 {
     return (_a..._z).contains(self) || (_A..._Z).contains(self)
   }
 
+  /// The lowercase of an ASCII letter, or `self` for any other byte.
+  var _asciiLowercased: UInt8 {
+    (_A..._Z).contains(self) ? self | 0x20 : self
+  }
+
   /// Assuming we're ASCII, whether we match `\w`
   var _asciiIsWord: Bool {
     assert(_isASCII)
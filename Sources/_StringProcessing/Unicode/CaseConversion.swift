@@ -2,13 +2,117 @@
 //
 // This source file is part of the Swift.org open source project
 //
-// Copyright (c) 2021-2022 Apple Inc. and the Swift project authors
+// Copyright (c) 2021-2025 Apple Inc. and the Swift project authors
 // Licensed under Apache License v2.0 with Runtime Library Exception
 //
 // See https://swift.org/LICENSE.txt for license information
 //
 //===----------------------------------------------------------------------===//
 
+@_silgen_name("_swift_string_processing_getSimpleCaseFolding")
+func _swift_string_processing_getSimpleCaseFolding(_: UInt32) -> UInt32
 
-// TODO
+@_silgen_name("_swift_string_processing_getFullCaseFolding")
+func _swift_string_processing_getFullCaseFolding(
+  _: UInt32,
+  _: UnsafeMutablePointer<UInt32>
+) -> Int
 
+@_silgen_name("_swift_string_processing_isCaseFoldingNormalizationSensitive")
+func _swift_string_processing_isCaseFoldingNormalizationSensitive(
+  _: UInt32
+) -> Bool
+
+extension Unicode.Scalar {
+  /// The simple case folding of this scalar, which is used to compare
+  /// scalars case-insensitively.
+  ///
+  /// The only scalars outside of ASCII whose simple case folding is ASCII are
+  /// U+017F LATIN SMALL LETTER LONG S and U+212A KELVIN SIGN, which fold to
+  /// `s` and `k`.
+  var simpleCaseFolded: Unicode.Scalar {
+    if value < 0x80 {
+      return Unicode.Scalar(UInt8(truncatingIfNeeded: value)._asciiLowercased)
+    }
+    return Unicode.Scalar(
+      _value: _swift_string_processing_getSimpleCaseFolding(value))
+  }
+}
+
+/// The full case folding of a sequence of scalars, produced a scalar at a
+/// time without allocating.
+struct CaseFoldedScalars<Base: IteratorProtocol>: Sequence, IteratorProtocol
+  where Base.Element == Unicode.Scalar
+{
+  var base: Base
+
+  /// The rest of the folding of the last scalar read from `base`, which is
+  /// at most three scalars long.
+  var pending: (UInt32, UInt32) = (0, 0)
+  var pendingCount = 0
+
+  init(_ base: Base) {
+    self.base = base
+  }
+
+  mutating func next() -> Unicode.Scalar? {
+    if pendingCount > 0 {
+      let scalar = pending.0
+      pending = (pending.1, 0)
+      pendingCount -= 1
+      return Unicode.Scalar(_value: scalar)
+    }
+
+    guard let scalar = base.next() else { return nil }
+    if scalar.value < 0x80 {
+      return scalar.simpleCaseFolded
+    }
+
+    var folding: (UInt32, UInt32, UInt32) = (0, 0, 0)
+    let count = withUnsafeMutableBytes(of: &folding) {
+      _swift_string_processing_getFullCaseFolding(
+        scalar.value, $0.baseAddress!.assumingMemoryBound(to: UInt32.self))
+    }
+    pending = (folding.1, folding.2)
+    pendingCount = count - 1
+    return Unicode.Scalar(_value: folding.0)
+  }
+}
+
+extension Character {
+  /// The full case folding of this character's scalars.
+  var caseFoldedScalars: CaseFoldedScalars<UnicodeScalarView.Iterator> {
+    CaseFoldedScalars(unicodeScalars.makeIterator())
+  }
+
+  /// Whether comparing this character's case folding scalar by scalar could
+  /// differ from comparing it under canonical equivalence.
+  var isCaseFoldingNormalizationSensitive: Bool {
+    // Nothing before U+00C0 decomposes or combines under normalization.
+    unicodeScalars.contains {
+      $0.value >= 0xC0
+        && _swift_string_processing_isCaseFoldingNormalizationSensitive(
+          $0.value)
+    }
+  }
+
+  /// Whether this character and `other` are equal when case-insensitive,
+  /// i.e. whether their full case foldings are canonically equivalent.
+  ///
+  /// Case foldings are compared scalar by scalar without allocating, unless
+  /// either character includes scalars that take part in normalization.
+  func caseFoldedEquals(_ other: Character) -> Bool {
+    if caseFoldedScalars.elementsEqual(other.caseFoldedScalars) {
+      return true
+    }
+    guard isCaseFoldingNormalizationSensitive
+            || other.isCaseFoldingNormalizationSensitive
+    else { return false }
+
+    var folded = ""
+    folded.unicodeScalars.append(contentsOf: caseFoldedScalars)
+    var otherFolded = ""
+    otherFolded.unicodeScalars.append(contentsOf: other.caseFoldedScalars)
+    return folded == otherFolded
+  }
+}
@@ -0,0 +1,141 @@
+//===----------------------------------------------------------------------===//
+//
+// This source file is part of the Swift.org open source project
+//
+// Copyright (c) 2025 Apple Inc. and the Swift project authors
+// Licensed under Apache License v2.0 with Runtime Library Exception
+//
+// See https://swift.org/LICENSE.txt for license information
+//
+//===----------------------------------------------------------------------===//
+
+@_silgen_name("_swift_string_processing_getGraphemeBreaks")
+func _swift_string_processing_getGraphemeBreaks(
+  _ utf8: UnsafePointer<UInt8>,
+  _ count: Int,
+  _ start: Int,
+  _ breaks: UnsafeMutablePointer<Int>,
+  _ capacity: Int
+) -> Int
+
+/// A batch of grapheme breaks in a processor's input, for stepping forward a
+/// character at a time.
+///
+/// Breaks are found a window at a time by the kernel in _CUnicode, which
+/// skips over ASCII a word at a time, rather than one at a time by the
+/// standard library. The kernel leaves breaks it can't be sure of to the
+/// standard library, so stepping from a position that's past the batch, or
+/// that the kernel stopped before, falls back to `index(after:)`.
+struct GraphemeBreakCache {
+  /// The number of breaks to find at once.
+  static var capacity: Int { 32 }
+
+  /// The breaks in the batch, as UTF-8 offsets from the start of the input.
+  private var breaks: [Int] = []
+
+  /// The number of valid breaks in `breaks`.
+  private var count = 0
+
+  /// The index in `breaks` of the break after `position`.
+  private var cursor = 0
+
+  /// The UTF-8 offset of the last break returned from the batch, or of the
+  /// position the batch was found from.
+  private var position = -1
+
+  /// Whether the input's UTF-8 is contiguous, or `nil` if that hasn't been
+  /// checked yet. Breaks are only found in batches for contiguous strings.
+  var isContiguousUTF8: Bool? = nil
+
+  /// Returns the break after `offset`, if it's the next one in the batch.
+  mutating func nextBreak(after offset: Int) -> Int? {
+    guard offset == position, cursor < count else { return nil }
+    position = breaks[cursor]
+    cursor += 1
+    return position
+  }
+
+  /// Replaces the batch with the breaks found after `offset` in `utf8`, and
+  /// returns the first of them, if any were found.
+  mutating func refill(
+    from utf8: UnsafeBufferPointer<UInt8>,
+    after offset: Int
+  ) -> Int? {
+    if breaks.isEmpty {
+      breaks = Array(repeating: 0, count: Self.capacity)
+    }
+    count = breaks.withUnsafeMutableBufferPointer {
+      _swift_string_processing_getGraphemeBreaks(
+        utf8.baseAddress!, utf8.count, offset, $0.baseAddress!, $0.count)
+    }
+    cursor = 0
+    position = offset
+    return nextBreak(after: offset)
+  }
+
+  /// Forgets the batch and what's known about the input, keeping the
+  /// batch's storage.
+  mutating func removeAll() {
+    count = 0
+    cursor = 0
+    position = -1
+    isContiguousUTF8 = nil
+  }
+}
+
+extension String {
+  /// Returns the position of the character after the one at `i`, as
+  /// `index(after:)` does, using the batch of breaks in `cache` where
+  /// possible.
+  func index(
+    after i: String.Index,
+    using cache: inout GraphemeBreakCache
+  ) -> String.Index {
+    // This is constant time for native strings.
+    let offset = utf8.distance(from: utf8.startIndex, to: i)
+    if let next = cache.nextBreak(after: offset) {
+      return utf8.index(utf8.startIndex, offsetBy: next)
+    }
+
+    if cache.isContiguousUTF8 != false {
+      let next = utf8.withContiguousStorageIfAvailable {
+        cache.refill(from: $0, after: offset)
+      }
+      cache.isContiguousUTF8 = next != nil
+      if let next = next ?? nil {
+        return utf8.index(utf8.startIndex, offsetBy: next)
+      }
+    }
+    return index(after: i)
+  }
+
+  /// Returns the start of the character that ends at `i`, if it can be found
+  /// from the few bytes before `i` without breaking grapheme clusters.
+  ///
+  /// An ASCII scalar other than LF only extends the character before it when
+  /// that character ends in a Prepend scalar, all of which are at or above
+  /// U+0600.
+  func _quickIndex(beforeCharacterEndingAt i: String.Index) -> String.Index? {
+    guard i > startIndex else { return nil }
+    let last = utf8.index(before: i)
+    let lastByte = utf8[last]
+    guard lastByte < 0x80 else { return nil }
+    guard last > startIndex else { return last }
+
+    let previous = utf8.index(before: last)
+    let previousByte = utf8[previous]
+    if previousByte < 0x80 {
+      // CR-LF is a single character.
+      return lastByte == ._lineFeed && previousByte == ._carriageReturn
+        ? previous
+        : last
+    }
+
+    // A two-byte scalar whose lead byte is at most 0xD7 is below U+0600.
+    guard previousByte & 0xC0 == 0x80, previous > startIndex else {
+      return nil
+    }
+    let lead = utf8[utf8.index(before: previous)]
+    return (0xC2...0xD7).contains(lead) ? last : nil
+  }
+}
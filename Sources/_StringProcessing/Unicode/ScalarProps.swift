@@ -14,6 +14,13 @@ internal import _RegexParser
 @_silgen_name("_swift_string_processing_getScript")
 func _swift_string_processing_getScript(_: UInt32) -> UInt8
 
+@_silgen_name("_swift_string_processing_getScripts")
+func _swift_string_processing_getScripts(
+  _: UnsafePointer<UInt32>,
+  _: Int,
+  _: UnsafeMutablePointer<UInt8>
+)
+
 @_silgen_name("_swift_string_processing_getScriptExtensions")
 func _swift_string_processing_getScriptExtensions(
   _: UInt32,
@@ -28,6 +35,25 @@ extension Unicode.Script {
     
     self = unsafeBitCast(rawValue, to: Self.self)
   }
+
+  /// Writes the script of each scalar in `scalars` to the corresponding
+  /// element of `scripts`, which must be at least as long.
+  static func classify(
+    _ scalars: UnsafeBufferPointer<Unicode.Scalar>,
+    into scripts: UnsafeMutableBufferPointer<Unicode.Script>
+  ) {
+    precondition(scripts.count >= scalars.count)
+    guard let scalarBase = scalars.baseAddress,
+          let scriptBase = scripts.baseAddress
+    else { return }
+
+    let count = scalars.count
+    scalarBase.withMemoryRebound(to: UInt32.self, capacity: count) { values in
+      scriptBase.withMemoryRebound(to: UInt8.self, capacity: count) { raw in
+        _swift_string_processing_getScripts(values, count, raw)
+      }
+    }
+  }
   
   static func extensions(for scalar: Unicode.Scalar) -> [Unicode.Script] {
     var count: UInt8 = 0
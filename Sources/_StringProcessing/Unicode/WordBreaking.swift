@@ -52,52 +52,191 @@ extension Processor {
   }
 }
 
+/// The word boundaries found so far in a processor's subject, for default
+/// word boundary assertions.
+///
+/// Boundaries are found in order from the start of the subject and recorded
+/// in a bitmap indexed by UTF-8 offset, so each position is only looked at
+/// once, however many searches and backtracking attempts test it.
+struct WordBoundaryCache {
+  /// A bit for each UTF-8 offset from the start of the subject, set where
+  /// there's a boundary. Complete for offsets before `scannedEnd`.
+  private var bits: [UInt64] = []
+
+  /// The first boundary that hasn't been recorded in `bits`, or `nil` if
+  /// none have been.
+  var scannedEnd: String.Index? = nil
+
+  func contains(_ offset: Int) -> Bool {
+    let word = offset &>> 6
+    return word < bits.count && bits[word] & (1 &<< (offset & 63)) != 0
+  }
+
+  mutating func insert(_ offset: Int) {
+    let word = offset &>> 6
+    if word >= bits.count {
+      bits.append(contentsOf: repeatElement(0, count: word + 1 - bits.count))
+    }
+    bits[word] |= 1 &<< (offset & 63)
+  }
+
+  /// Forgets every boundary, keeping the bitmap's storage.
+  mutating func removeAll() {
+    bits.removeAll(keepingCapacity: true)
+    scannedEnd = nil
+  }
+}
+
 extension String {
   func isOnWordBoundary(
     at i: String.Index,
     in range: Range<String.Index>,
-    using cache: inout Set<String.Index>?,
-    _ maxIndex: inout String.Index?
+    using cache: inout WordBoundaryCache
   ) -> Bool {
-    // TODO: needs benchmark coverage
     guard i != range.lowerBound, i != range.upperBound else {
       return true
     }
     assert(range.contains(i))
 
-    // If our index is already in our cache, then this is obviously on a
-    // boundary.
-    if let cache = cache, cache.contains(i) {
-      return true
-    }
-    
-    // If its not in the cache AND our max index is larger than our index, it
-    // means this index is never on a word boundary in our string. If our index
-    // is larger than max index, we may need to still do work to determine if
-    // i is on a boundary. If it's equal to max index, then it should've been
-    // taken the cache path.
-    if let maxIndex = maxIndex, i < maxIndex {
-      return false
+    // This is constant time for native strings.
+    let offset = utf8.distance(from: range.lowerBound, to: i)
+
+    // Positions before the scanned end are boundaries exactly when they've
+    // been recorded as one.
+    if let scannedEnd = cache.scannedEnd, i < scannedEnd {
+      return cache.contains(offset)
     }
-    
+
     if #available(SwiftStdlib 5.7, *) {
-      if cache == nil {
-        cache = []
-      }
-      var j = maxIndex ?? range.lowerBound
-      
+      var j = cache.scannedEnd ?? range.lowerBound
       while j < range.upperBound, j <= i {
+        cache.insert(utf8.distance(from: range.lowerBound, to: j))
+        let next = _asciiWordIndex(after: j) ?? _wordIndex(after: j)
         // Workaround for underlying issue in https://github.com/swiftlang/swift-experimental-string-processing/issues/818
-        let (inserted, _) = cache!.insert(j)
-        guard inserted else { return true }
-        
-        j = _wordIndex(after: j)
+        guard next > j else { return true }
+        j = next
       }
-      
-      maxIndex = j
-      return cache!.contains(i)
+
+      cache.scannedEnd = j
+      return cache.contains(offset)
     } else {
       return false
     }
   }
 }
+
+/// The word break properties of ASCII scalars, from UAX #29.
+private enum ASCIIWordBreakProperty {
+  case cr
+  case lf
+  case newline
+  case wSegSpace
+  case aLetter
+  case numeric
+  case extendNumLet
+  case midLetter
+  case midNum
+  case midNumLet
+  case singleQuote
+  case doubleQuote
+  case other
+
+  init(_ byte: UInt8) {
+    switch byte {
+    case 0x0D: self = .cr
+    case 0x0A: self = .lf
+    case 0x0B, 0x0C: self = .newline
+    case 0x20: self = .wSegSpace
+    case UInt8(ascii: "a")...UInt8(ascii: "z"),
+         UInt8(ascii: "A")...UInt8(ascii: "Z"):
+      self = .aLetter
+    case UInt8(ascii: "0")...UInt8(ascii: "9"): self = .numeric
+    case UInt8(ascii: "_"): self = .extendNumLet
+    case UInt8(ascii: ":"): self = .midLetter
+    case UInt8(ascii: ","), UInt8(ascii: ";"): self = .midNum
+    case UInt8(ascii: "."): self = .midNumLet
+    case UInt8(ascii: "'"): self = .singleQuote
+    case UInt8(ascii: "\""): self = .doubleQuote
+    default: self = .other
+    }
+  }
+
+  /// Whether there's no break between two scalars with these properties,
+  /// by WB5, WB8-WB10, and WB13a-b.
+  var isWordPart: Bool {
+    self == .aLetter || self == .numeric || self == .extendNumLet
+  }
+
+  /// Whether there's no break around a scalar with this property that's
+  /// between two scalars with the property `outer`, by WB6-WB7 and
+  /// WB11-WB12.
+  func joins(_ outer: Self) -> Bool {
+    switch (outer, self) {
+    case (.aLetter, .midLetter), (.aLetter, .midNumLet),
+         (.aLetter, .singleQuote),
+         (.numeric, .midNum), (.numeric, .midNumLet),
+         (.numeric, .singleQuote):
+      return true
+    default:
+      return false
+    }
+  }
+}
+
+extension String {
+  /// Returns the word boundary after `i`, found by applying the rules of
+  /// UAX #29 to ASCII text directly, or `nil` if the boundary depends on a
+  /// non-ASCII scalar.
+  ///
+  /// `i` must be a word boundary. The result is the same as
+  /// `_wordIndex(after: i)` whenever it's non-`nil`.
+  func _asciiWordIndex(after i: String.Index) -> String.Index? {
+    let length: Int?? = utf8.withContiguousStorageIfAvailable { bytes in
+      let start = utf8.distance(from: startIndex, to: i)
+      guard start < bytes.count, bytes[start] < 0x80 else { return nil }
+      var previous = ASCIIWordBreakProperty(bytes[start])
+      switch previous {
+      case .cr:
+        // WB3, WB3a
+        let hasLF = start + 1 < bytes.count && bytes[start + 1] == 0x0A
+        return hasLF ? 2 : 1
+      case .lf, .newline:
+        // WB3a
+        return 1
+      case .midLetter, .midNum, .midNumLet, .singleQuote, .doubleQuote:
+        // Whether there's a break after these depends on the scalar before.
+        return nil
+      default:
+        break
+      }
+
+      var position = start + 1
+      while position < bytes.count {
+        // A non-ASCII scalar may be ignored by WB4, or have rules of its own.
+        guard bytes[position] < 0x80 else { return nil }
+        let current = ASCIIWordBreakProperty(bytes[position])
+        if previous == .wSegSpace && current == .wSegSpace {
+          // WB3d
+          position += 1
+        } else if previous.isWordPart && current.isWordPart {
+          previous = current
+          position += 1
+        } else if current.joins(previous) {
+          guard position + 1 < bytes.count else { return position - start }
+          guard bytes[position + 1] < 0x80 else { return nil }
+          guard ASCIIWordBreakProperty(bytes[position + 1]) == previous else {
+            return position - start
+          }
+          position += 2
+        } else {
+          // WB999
+          return position - start
+        }
+      }
+      // WB2
+      return position - start
+    }
+    guard let length = length ?? nil else { return nil }
+    return utf8.index(i, offsetBy: length)
+  }
+}
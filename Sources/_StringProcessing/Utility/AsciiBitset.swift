@@ -11,7 +11,7 @@
 
 // TODO: Probably refactor out of DSLTree
 extension DSLTree.CustomCharacterClass {
-  internal struct AsciiBitset {
+  internal struct AsciiBitset: Equatable {
     let isInverted: Bool
     var a: UInt64 = 0
     var b: UInt64 = 0
@@ -0,0 +1,49 @@
+//===----------------------------------------------------------------------===//
+//
+// This source file is part of the Swift.org open source project
+//
+// Copyright (c) 2025 Apple Inc. and the Swift project authors
+// Licensed under Apache License v2.0 with Runtime Library Exception
+//
+// See https://swift.org/LICENSE.txt for license information
+//
+//===----------------------------------------------------------------------===//
+
+@_silgen_name("_swift_string_processing_createLock")
+func _swift_string_processing_createLock() -> UnsafeMutableRawPointer?
+
+@_silgen_name("_swift_string_processing_destroyLock")
+func _swift_string_processing_destroyLock(_: UnsafeMutableRawPointer)
+
+@_silgen_name("_swift_string_processing_lock")
+func _swift_string_processing_lock(_: UnsafeMutableRawPointer)
+
+@_silgen_name("_swift_string_processing_unlock")
+func _swift_string_processing_unlock(_: UnsafeMutableRawPointer)
+
+/// A mutual exclusion lock.
+///
+/// This module can't import a platform module, so the platform's lock is
+/// reached through `_CUnicode`. Threads waiting for the lock block instead
+/// of spinning, so a descheduled or lower-priority owner doesn't leave them
+/// burning CPU.
+final class Lock {
+  private let handle: UnsafeMutableRawPointer
+
+  init() {
+    guard let handle = _swift_string_processing_createLock() else {
+      fatalError("Couldn't allocate a lock")
+    }
+    self.handle = handle
+  }
+
+  deinit {
+    _swift_string_processing_destroyLock(handle)
+  }
+
+  func withLock<R>(_ body: () throws -> R) rethrows -> R {
+    _swift_string_processing_lock(handle)
+    defer { _swift_string_processing_unlock(handle) }
+    return try body()
+  }
+}
@@ -135,6 +135,14 @@ enum _StringRegister {}
 typealias AsciiBitsetRegister = TypedInt<_AsciiBitsetRegister>
 enum _AsciiBitsetRegister {}
 
+/// Used for matching runs of scalars with a property, e.g. `\p{L}+`
+typealias ScalarRunSetRegister = TypedInt<_ScalarRunSetRegister>
+enum _ScalarRunSetRegister {}
+
+/// Used for matching alternations of literals, e.g. `GET|POST|PUT`
+typealias LiteralTrieRegister = TypedInt<_LiteralTrieRegister>
+enum _LiteralTrieRegister {}
+
 /// Used for consume functions, e.g. character classes
 typealias ConsumeFunctionRegister = TypedInt<_ConsumeFunctionRegister>
 enum _ConsumeFunctionRegister {}
@@ -237,6 +237,74 @@ class AlgorithmTests: XCTestCase {
     expectSplit("a____a____a", "_+", ["a", "a", "a"])
     expectSplit("____a____a____a____", "_+", ["", "a", "a", "a", ""])
   }
+
+  @available(SwiftStdlib 6.1, *)
+  func testRegexForEachSplitRange() throws {
+    func splitRanges(
+      _ string: some StringProtocol,
+      separator: Regex<AnyRegexOutput>,
+      maxSplits: Int = .max,
+      omittingEmptySubsequences: Bool = true
+    ) throws -> [Substring] {
+      var result: [Substring] = []
+      try string.forEachSplitRange(
+        separator: separator,
+        maxSplits: maxSplits,
+        omittingEmptySubsequences: omittingEmptySubsequences
+      ) { result.append(string[$0]) }
+      return result
+    }
+
+    func expectSplitRanges(
+      _ string: String,
+      _ regex: String,
+      file: StaticString = #file, line: UInt = #line
+    ) {
+      let regex = try! Regex(regex)
+      for maxSplits in [0, 1, 2, Int.max] {
+        for omitting in [false, true] {
+          let expected = string.split(
+            separator: regex,
+            maxSplits: maxSplits,
+            omittingEmptySubsequences: omitting)
+          let actual = try! splitRanges(
+            string,
+            separator: regex,
+            maxSplits: maxSplits,
+            omittingEmptySubsequences: omitting)
+          XCTAssertEqual(
+            actual, expected,
+            "maxSplits: \(maxSplits), omitting: \(omitting)",
+            file: file, line: line)
+        }
+      }
+    }
+
+    expectSplitRanges("", "")
+    expectSplitRanges("", "x")
+    expectSplitRanges("a", "")
+    expectSplitRanges("a", "x")
+    expectSplitRanges("a", "a")
+    expectSplitRanges("a____a____a", "_+")
+    expectSplitRanges("____a____a____a____", "_+")
+    expectSplitRanges("a,b,,c,", ",")
+
+    // Ranges in a substring are relative to the base string.
+    let substring = "x,a,b,x".dropFirst(2).dropLast(2)
+    XCTAssertEqual(
+      try splitRanges(substring, separator: try Regex(",")), ["a", "b"])
+
+    // A search that reaches the step limit stops the split.
+    let input = "x," + String(repeating: "a", count: 30) + "!b"
+    let limited = try Regex(#",|(a|aa)+\1b"#).matchingStepLimit(10_000)
+    var ranges: [Range<String.Index>] = []
+    XCTAssertThrowsError(
+      try input.forEachSplitRange(separator: limited) { ranges.append($0) }
+    ) { error in
+      XCTAssert(error is RegexStepLimitExceeded)
+    }
+    XCTAssertEqual(ranges.map { input[$0] }, ["x"])
+  }
   
   func testStringSplit() {
     func expectSplit(
@@ -488,6 +556,86 @@ class AlgorithmTests: XCTestCase {
     // FIXME: Test closure-based replacement
   }
 
+  @available(SwiftStdlib 6.1, *)
+  func testRegexReplaceInto() {
+    func expectReplace(
+      _ string: String,
+      _ regex: String,
+      _ replacement: String,
+      maxReplacements: Int = .max,
+      file: StaticString = #file, line: UInt = #line
+    ) {
+      let regex = try! Regex(regex)
+      let expected = string.replacing(
+        regex, with: replacement, maxReplacements: maxReplacements)
+
+      var bytes: [UInt8] = []
+      try! string.replacing(
+        regex, with: replacement, maxReplacements: maxReplacements,
+        into: { bytes.append(contentsOf: $0) })
+      XCTAssertEqual(String(decoding: bytes, as: UTF8.self), expected,
+                     file: file, line: line)
+
+      let capacity = expected.utf8.count
+      var buffer = [UInt8](repeating: 0, count: capacity)
+      let count = buffer.withUnsafeMutableBufferPointer {
+        try! string.replacing(
+          regex, with: replacement, maxReplacements: maxReplacements,
+          into: $0)
+      }
+      XCTAssertEqual(count, capacity, file: file, line: line)
+      XCTAssertEqual(String(decoding: buffer, as: UTF8.self), expected,
+                     file: file, line: line)
+
+      if capacity > 0 {
+        var small = [UInt8](repeating: 0, count: capacity - 1)
+        XCTAssertNil(
+          small.withUnsafeMutableBufferPointer {
+            try! string.replacing(
+              regex, with: replacement, maxReplacements: maxReplacements,
+              into: $0)
+          },
+          file: file, line: line)
+      }
+    }
+
+    expectReplace("", "", "X")
+    expectReplace("", "x", "X")
+    expectReplace("", "x*", "X")
+    expectReplace("a", "", "X")
+    expectReplace("a", "x", "X")
+    expectReplace("aab", "a", "X")
+    expectReplace("aab", "a*", "X")
+    expectReplace("aab", "a", "")
+    expectReplace("aabaaabaab", "aab", "Z", maxReplacements: 2)
+    expectReplace("aabaaabaab", "aab", "Z", maxReplacements: 0)
+    expectReplace("café résumé", "é", "e\u{301}")
+
+    var bytes: [UInt8] = []
+    try! "name: Jo, age: 42".dropFirst(6).replacing(
+      try! Regex(#"(\w+): (\w+)"#), into: { bytes.append(contentsOf: $0) },
+      with: { match in "\(match[2].substring!)=\(match[1].substring!)" })
+    XCTAssertEqual(String(decoding: bytes, as: UTF8.self), "Jo, 42=age")
+
+    // A search that reaches the step limit throws instead of writing the
+    // rest of the input unreplaced.
+    let secret = "ssn 1 " + String(repeating: "a", count: 30) + "!b"
+    let limited = try! Regex(#"\d|(a|aa)+\1b"#).matchingStepLimit(10_000)
+    bytes = []
+    XCTAssertThrowsError(
+      try secret.replacing(
+        limited, with: "#", into: { bytes.append(contentsOf: $0) })
+    ) { error in
+      XCTAssert(error is RegexStepLimitExceeded)
+    }
+    XCTAssertEqual(String(decoding: bytes, as: UTF8.self), "ssn #")
+    var buffer = [UInt8](repeating: 0, count: 100)
+    XCTAssertThrowsError(
+      try buffer.withUnsafeMutableBufferPointer {
+        try secret.replacing(limited, with: "#", into: $0)
+      })
+  }
+
   func testStringReplace() {
     func expectReplace(
       _ string: String,
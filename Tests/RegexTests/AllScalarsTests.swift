@@ -10,7 +10,7 @@
 //===----------------------------------------------------------------------===//
 
 import XCTest
-import _StringProcessing
+@testable import _StringProcessing
 
 let allScalars = Unicode.Scalar.allScalars
 
@@ -52,4 +52,29 @@ class AllScalarsTests: XCTestCase {
     XCTAssertEqual(2835, digitSum)
     XCTAssertEqual(4.5, digitSum / Double(numericIndices.count))
   }
+
+  func testScripts() {
+    XCTAssertEqual(Unicode.Script("a"), .latin)
+    XCTAssertEqual(Unicode.Script("\u{4E00}"), .han)
+    XCTAssertEqual(Unicode.Script("\u{416}"), .cyrillic)
+    XCTAssertEqual(Unicode.Script("\u{30FC}"), .common)
+    XCTAssertEqual(Unicode.Script("\u{301}"), .inherited)
+    XCTAssertEqual(Unicode.Script("\u{10FFFF}"), .unknown)
+    XCTAssertEqual(Unicode.Script.extensions(for: "\u{30FC}"), [.hiragana, .katakana])
+    XCTAssertEqual(Unicode.Script.extensions(for: "a"), [.latin])
+
+    // Classifying many scalars at once agrees with classifying each one.
+    let scalars = Array(allScalars)
+    var scripts = [Unicode.Script](repeating: .unknown, count: scalars.count)
+    scalars.withUnsafeBufferPointer { scalars in
+      scripts.withUnsafeMutableBufferPointer { scripts in
+        Unicode.Script.classify(scalars, into: scripts)
+      }
+    }
+    for (scalar, script) in zip(scalars, scripts)
+    where script != Unicode.Script(scalar) {
+      XCTFail("Mismatched script for U+\(String(scalar.value, radix: 16))")
+      break
+    }
+  }
 }
@@ -0,0 +1,128 @@
+//===----------------------------------------------------------------------===//
+//
+// This source file is part of the Swift.org open source project
+//
+// Copyright (c) 2025 Apple Inc. and the Swift project authors
+// Licensed under Apache License v2.0 with Runtime Library Exception
+//
+// See https://swift.org/LICENSE.txt for license information
+//
+//===----------------------------------------------------------------------===//
+
+@testable import _StringProcessing
+import XCTest
+
+class CaseFoldingTests: XCTestCase {
+  func testSimpleCaseFolding() {
+    func folded(_ s: Unicode.Scalar) -> Unicode.Scalar {
+      s.simpleCaseFolded
+    }
+    XCTAssertEqual(folded("A"), "a")
+    XCTAssertEqual(folded("a"), "a")
+    XCTAssertEqual(folded("1"), "1")
+    XCTAssertEqual(folded("\u{C9}"), "\u{E9}")
+    XCTAssertEqual(folded("\u{212A}"), "k")
+    XCTAssertEqual(folded("\u{17F}"), "s")
+    XCTAssertEqual(folded("\u{3A3}"), "\u{3C3}")
+    XCTAssertEqual(folded("\u{3C2}"), "\u{3C3}")
+    XCTAssertEqual(folded("\u{1E9E}"), "\u{DF}")
+    XCTAssertEqual(folded("\u{10400}"), "\u{10428}")
+    // Scalars without a simple case folding fold to themselves.
+    XCTAssertEqual(folded("\u{DF}"), "\u{DF}")
+    XCTAssertEqual(folded("\u{130}"), "\u{130}")
+    XCTAssertEqual(folded("\u{1F600}"), "\u{1F600}")
+  }
+
+  func testFullCaseFolding() {
+    func folded(_ s: String) -> String {
+      var result = ""
+      result.unicodeScalars.append(
+        contentsOf: CaseFoldedScalars(s.unicodeScalars.makeIterator()))
+      return result
+    }
+    XCTAssertEqual(folded("Hello"), "hello")
+    XCTAssertEqual(folded("Stra\u{DF}e"), "strasse")
+    XCTAssertEqual(folded("\u{1E9E}"), "ss")
+    XCTAssertEqual(folded("\u{130}"), "i\u{307}")
+    XCTAssertEqual(folded("\u{FB03}x"), "ffix")
+    XCTAssertEqual(folded("\u{390}"), "\u{3B9}\u{308}\u{301}")
+    XCTAssertEqual(folded("\u{3A3}\u{3C2}"), "\u{3C3}\u{3C3}")
+  }
+
+  func testCaseFoldedEquals() {
+    func equals(_ a: Character, _ b: Character) -> Bool {
+      a.caseFoldedEquals(b) && b.caseFoldedEquals(a)
+    }
+    XCTAssert(equals("a", "A"))
+    XCTAssert(equals("k", "\u{212A}"))
+    XCTAssert(equals("\u{DF}", "\u{1E9E}"))
+    XCTAssert(equals("\u{3A3}", "\u{3C2}"))
+    XCTAssertFalse(equals("a", "b"))
+    XCTAssertFalse(equals("\u{DF}", "s"))
+
+    // Case foldings are compared under canonical equivalence.
+    XCTAssert(equals("\u{C9}", "e\u{301}"))
+    XCTAssert(equals("\u{212B}", "a\u{30A}"))
+    XCTAssertFalse(equals("\u{C9}", "e"))
+  }
+
+  func testCaseInsensitiveMatching() {
+    for semanticLevel in [RegexSemanticLevel.graphemeCluster, .unicodeScalar] {
+      firstMatchTest(
+        #"(?i)\u{212A}elvin"#, input: "KELVIN", match: "KELVIN",
+        semanticLevel: semanticLevel)
+      firstMatchTest(
+        #"(?i)mask"#, input: "MA\u{17F}\u{212A}", match: "MA\u{17F}\u{212A}",
+        semanticLevel: semanticLevel)
+      firstMatchTest(
+        #"(?i)\u{3A3}\u{3A3}"#, input: "x\u{3C3}\u{3C2}", match: "\u{3C3}\u{3C2}",
+        semanticLevel: semanticLevel)
+    }
+
+    // Full case foldings only apply when comparing characters.
+    firstMatchTest(#"(?i)\u{DF}"#, input: "\u{1E9E}", match: "\u{1E9E}")
+    firstMatchTest(
+      #"(?i)\u{DF}"#, input: "\u{1E9E}", match: "\u{1E9E}",
+      semanticLevel: .unicodeScalar)
+    firstMatchTest(#"(?i)\u{DF}"#, input: "SS", match: nil)
+
+    firstMatchTest(#"(?i)CAF\u{C9}"#, input: "le cafe\u{301}", match: "cafe\u{301}")
+    firstMatchTest(#"(?i)caf\u{E9}"#, input: "CAFE\u{301}", match: "CAFE\u{301}")
+  }
+
+  @available(SwiftStdlib 6.1, *)
+  func testCaseInsensitiveLiterals() throws {
+    // Long ASCII literals are matched a byte at a time.
+    let pattern = #"(?i)content-type: text/html"#
+    let input = "X-Other: 1\r\nCONTENT-TYPE: Text/HTML; charset=utf-8"
+    for semanticLevel in [RegexSemanticLevel.graphemeCluster, .unicodeScalar] {
+      firstMatchTest(
+        pattern, input: input, match: "CONTENT-TYPE: Text/HTML",
+        semanticLevel: semanticLevel)
+      allMatchesTest(
+        #"(?i)needle"#, input: "NEEDLE haystack nEeDlE needles",
+        matches: ["NEEDLE", "nEeDlE", "needle"],
+        semanticLevel: semanticLevel)
+      firstMatchTest(
+        #"(?i)snake"#, input: "\u{17F}na\u{212A}e", match: "\u{17F}na\u{212A}e",
+        semanticLevel: semanticLevel)
+    }
+
+    // A literal can't end in the middle of a grapheme cluster.
+    firstMatchTest(#"(?i)needle"#, input: "NEEDLE\u{301}", match: nil)
+    firstMatchTest(
+      #"(?i)needle"#, input: "NEEDLE\u{301}", match: "NEEDLE",
+      semanticLevel: .unicodeScalar)
+
+    // Case-sensitive literals around case-insensitive ones stay
+    // case-sensitive.
+    firstMatchTest(
+      #"ID=(?i:abc)-XYZ"#, input: "id=ABC-XYZ ID=aBc-xyz ID=AbC-XYZ",
+      match: "ID=AbC-XYZ")
+
+    // Regex sets run regexes with case-insensitive literals unfiltered.
+    let set = try RegexSet([#"(?i)error: \d+"#, #"(?i)warning"#, "Error"])
+    XCTAssertEqual(
+      try set.matchingIndices(in: "WARNING then ERROR: 42"), [0, 1])
+  }
+}
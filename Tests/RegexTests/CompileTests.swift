@@ -10,7 +10,7 @@
 //===----------------------------------------------------------------------===//
 
 @testable import _RegexParser
-@testable import _StringProcessing
+@testable @_spi(RegexBenchmark) import _StringProcessing
 import TestSupport
 
 import XCTest
@@ -42,6 +42,7 @@ enum DecodedInstr {
   case matchBitset
   case matchBuiltin
   case matchUTF8
+  case matchLiteralTrie
   case consumeBy
   case assertBy
   case matchBy
@@ -144,6 +145,8 @@ extension DecodedInstr {
       return .matchBuiltin
     case .matchUTF8:
       return .matchUTF8
+    case .matchLiteralTrie:
+      return .matchLiteralTrie
     }
   }
 }
@@ -320,13 +323,15 @@ extension RegexTests {
     for regex: String,
     syntax: SyntaxOptions = .traditional,
     semanticLevel: RegexSemanticLevel? = nil,
+    compileOptions: _CompileOptions = .default,
     contains targets: Set<DecodedInstr> = [],
     doesNotContain invalid: Set<DecodedInstr> = [],
     file: StaticString = #file,
     line: UInt = #line
   ) {
     do {
-      let prog = try _compileRegex(regex, syntax, semanticLevel)
+      let prog = try _compileRegex(
+        regex, syntax, semanticLevel, compileOptions: compileOptions)
       var found: Set<DecodedInstr> = []
       for inst in prog.instructions {
         let decoded = DecodedInstr.decode(inst)
@@ -418,56 +423,93 @@ extension RegexTests {
       doesNotContain: [.matchBitsetScalar])
   }
 
+  func testScalarRunCompile() {
+    expectProgram(
+      for: #"\p{L}+"#,
+      contains: [.quantify],
+      doesNotContain: [.consumeBy])
+    expectProgram(
+      for: #"[\p{Nd}\p{Pc}]*"#,
+      semanticLevel: .unicodeScalar,
+      contains: [.quantify],
+      doesNotContain: [.consumeBy])
+    expectProgram(
+      for: #"[^\p{Han}]{2,5}"#,
+      contains: [.quantify],
+      doesNotContain: [.consumeBy])
+    expectProgram(
+      for: #"\p{Alphabetic}+"#,
+      contains: [.consumeBy],
+      doesNotContain: [.quantify])
+    expectProgram(
+      for: #"\p{L}+?"#,
+      contains: [.consumeBy],
+      doesNotContain: [.quantify])
+  }
+
+  // The following check the instructions that codegen chooses, before
+  // optimization passes fuse them.
+
   func testScalarOptimizeCompilation() {
     // all ascii quoted literal -> elide boundary checks
     expectProgram(
       for: "abcd",
+      compileOptions: .disableOptimizationPasses,
       contains: [.matchScalar, .matchScalarUnchecked],
       doesNotContain: [.match, .consumeBy])
     // ascii character -> matchScalar with boundary check
     expectProgram(
       for: "a",
+      compileOptions: .disableOptimizationPasses,
       contains: [.matchScalar],
       doesNotContain: [.match, .consumeBy, .matchScalarUnchecked])
     // quoted literal is not all ascii -> match scalar when possible, always do boundary checks
     expectProgram(
       for: "aaa\u{301}",
+      compileOptions: .disableOptimizationPasses,
       contains: [.match, .matchScalar],
       doesNotContain: [.consumeBy, .matchScalarUnchecked])
     // scalar mode -> always emit match scalar without boundary checks
     expectProgram(
       for: "abcd",
       semanticLevel: .unicodeScalar,
+      compileOptions: .disableOptimizationPasses,
       contains: [.matchScalarUnchecked],
       doesNotContain: [.match, .consumeBy, .matchScalar])
     expectProgram(
       for: "a",
       semanticLevel: .unicodeScalar,
+      compileOptions: .disableOptimizationPasses,
       contains: [.matchScalarUnchecked],
       doesNotContain: [.match, .consumeBy, .matchScalar])
     expectProgram(
       for: "a\u{301}",
       semanticLevel: .unicodeScalar,
+      compileOptions: .disableOptimizationPasses,
       contains: [.matchScalarUnchecked],
       doesNotContain: [.match, .consumeBy, .matchScalar])
     expectProgram(
       for: "abcdefg",
       semanticLevel: .unicodeScalar,
+      compileOptions: .disableOptimizationPasses,
       contains: [.matchUTF8],
       doesNotContain: [.match, .consumeBy, .matchScalar])
     expectProgram(
       for: "abcdefg",
       semanticLevel: .graphemeCluster,
+      compileOptions: .disableOptimizationPasses,
       contains: [.matchUTF8],
       doesNotContain: [.match, .consumeBy, .matchScalar])
     expectProgram(
       for: "aaa\u{301}",
       semanticLevel: .unicodeScalar,
+      compileOptions: .disableOptimizationPasses,
       contains: [.matchUTF8],
       doesNotContain: [.match, .consumeBy, .matchScalar])
     expectProgram(
       for: "aaa\u{301}",
       semanticLevel: .graphemeCluster,
+      compileOptions: .disableOptimizationPasses,
       contains: [.match],
       doesNotContain: [.matchUTF8, .consumeBy])
   }
@@ -477,11 +519,13 @@ extension RegexTests {
     // boundary checks
     expectProgram(
       for: "(?i)abcd",
+      compileOptions: .disableOptimizationPasses,
       contains: [.matchScalarCaseInsensitiveUnchecked, .matchScalarCaseInsensitive],
       doesNotContain: [.match, .matchCaseInsensitive, .matchScalar, .matchScalarUnchecked])
     // quoted literal is all non-cased ascii -> emit match scalar instructions
     expectProgram(
       for: "(?i)&&&&",
+      compileOptions: .disableOptimizationPasses,
       contains: [.matchScalar, .matchScalarUnchecked],
       doesNotContain: [.match, .matchCaseInsensitive,
         .matchScalarCaseInsensitive, .matchScalarCaseInsensitiveUnchecked])
@@ -490,16 +534,19 @@ extension RegexTests {
     // boundary check
     expectProgram(
       for: "(?i)abcd\u{301}",
+      compileOptions: .disableOptimizationPasses,
       contains: [.matchCaseInsensitive, .matchScalarCaseInsensitive],
       doesNotContain: [.matchScalarCaseInsensitiveUnchecked, .match, .matchScalar])
     // same as before but contains ascii non cased characters -> emit matchScalar for them
     expectProgram(
       for: "(?i)abcd\u{301};.'!",
+      compileOptions: .disableOptimizationPasses,
       contains: [.matchCaseInsensitive, .matchScalarCaseInsensitive, .matchScalar],
       doesNotContain: [.matchScalarCaseInsensitiveUnchecked, .match])
     // contains non-ascii non-cased characters -> emit match
     expectProgram(
       for: "(?i)abcd\u{301};.'!💖",
+      compileOptions: .disableOptimizationPasses,
       contains: [.matchCaseInsensitive, .matchScalarCaseInsensitive, .matchScalar, .match],
       doesNotContain: [.matchScalarCaseInsensitiveUnchecked])
     
@@ -508,11 +555,13 @@ extension RegexTests {
     expectProgram(
       for: "(?i);.'!💖",
       semanticLevel: .unicodeScalar,
+      compileOptions: .disableOptimizationPasses,
       contains: [.matchScalarUnchecked],
       doesNotContain: [.matchScalarCaseInsensitiveUnchecked])
     expectProgram(
       for: "(?i)abcdé",
       semanticLevel: .unicodeScalar,
+      compileOptions: .disableOptimizationPasses,
       contains: [.matchScalarCaseInsensitiveUnchecked],
       doesNotContain: [.matchScalarUnchecked])
   }
@@ -599,4 +648,253 @@ extension RegexTests {
     try expectCanOnlyMatchAtStart("(?=^)foo", true)
     try expectCanOnlyMatchAtStart("(?!^)foo", false)
   }
+
+  func testRequiredLiteralPrefilter() throws {
+    func expectPrefilter(
+      _ regexStr: String,
+      prefix: String = "",
+      required: String = "",
+      leadingBytes: String? = nil,
+      isCaseInsensitive: Bool = false,
+      file: StaticString = #file,
+      line: UInt = #line
+    ) throws {
+      let regex = try Regex(regexStr)
+      let prefilter = regex.program.loweredProgram.prefilter
+      XCTAssertEqual(
+        prefilter?.isCaseInsensitive ?? false, isCaseInsensitive,
+        "case-insensitive", file: file, line: line)
+      XCTAssertEqual(
+        prefilter?.prefix ?? [], Array(prefix.utf8),
+        "prefix", file: file, line: line)
+      XCTAssertEqual(
+        prefilter?.requiredLiteral ?? [], Array(required.utf8),
+        "required literal", file: file, line: line)
+      let leading = prefilter?.leadingBytes.map { bitset in
+        String(decoding: (0..<128).filter { bitset.matches(UInt8($0)) }
+          .map(UInt8.init), as: UTF8.self)
+      }
+      XCTAssertEqual(
+        leading, leadingBytes,
+        "leading bytes", file: file, line: line)
+    }
+
+    try expectPrefilter("foo", prefix: "foo", required: "foo")
+    try expectPrefilter(#"\bfoo\b"#, prefix: "foo", required: "foo")
+    try expectPrefilter(#"(foo)bar"#, prefix: "foobar", required: "foobar")
+    try expectPrefilter(#"ERROR: (\d+) .*timeout"#,
+                        prefix: "ERROR: ", required: "ERROR: ")
+    try expectPrefilter(#"\d+ timeout"#, required: " timeout")
+    try expectPrefilter(#"a+bc"#, prefix: "a", required: "bc")
+    try expectPrefilter(#"x?abc"#, required: "abc")
+
+    // Leading bytes are only computed without a prefix.
+    try expectPrefilter(#"(?:GET|POST) /"#, required: " /", leadingBytes: "GP")
+    try expectPrefilter(#"(?:GET|\d)"#)
+
+    // Case-insensitive ASCII letters are searched for in lowercase, except
+    // for k and s, which also match KELVIN SIGN and LONG S.
+    try expectPrefilter(#"(?i)aBc"#,
+                        prefix: "abc", required: "abc", isCaseInsensitive: true)
+    try expectPrefilter(#"(?i)a1-2"#,
+                        prefix: "a1-2", required: "a1-2", isCaseInsensitive: true)
+    try expectPrefilter(#"AB(?i)C"#,
+                        prefix: "abc", required: "abc", isCaseInsensitive: true)
+    try expectPrefilter(#"(?i:ab)cd"#,
+                        prefix: "abcd", required: "abcd", isCaseInsensitive: true)
+    try expectPrefilter(#"(?i)xkyz"#,
+                        prefix: "x", required: "yz", isCaseInsensitive: true)
+    try expectPrefilter(#"(?i)s\d"#)
+
+    // Non-ASCII characters can match other spellings under canonical
+    // equivalence.
+    try expectPrefilter("caf\u{E9}s", prefix: "caf", required: "caf")
+
+    // Lookarounds and alternations aren't required to appear in the match.
+    try expectPrefilter(#"(?=abc)\w"#)
+    try expectPrefilter(#"(?<=abc)def"#, required: "def")
+    try expectPrefilter(#"abc|def"#, leadingBytes: "ad")
+  }
+
+  func testLazyDFAEligibility() throws {
+    func expectLazyDFA(
+      _ regexStr: String,
+      _ expected: Bool,
+      file: StaticString = #file,
+      line: UInt = #line
+    ) throws {
+      let regex = try Regex(regexStr)
+      XCTAssertEqual(
+        regex.program.loweredProgram.canUseLazyDFA, expected,
+        regexStr, file: file, line: line)
+    }
+
+    try expectLazyDFA(#"abc"#, true)
+    try expectLazyDFA(#"(a|b)*c"#, true)
+    try expectLazyDFA(#"^\w+@\w+\.com$"#, true)
+    try expectLazyDFA(#"(?i)foo\b"#, true)
+    try expectLazyDFA(#"[a-z]+\d*"#, true)
+    try expectLazyDFA(#"a{2,3}b"#, true)
+    try expectLazyDFA(#"a.*?b"#, true)
+    try expectLazyDFA(#"(?i)\b(?:get|post|put)\b"#, true)
+
+    // Features that depend on backtracking order or on captured text.
+    try expectLazyDFA(#"(a)\1"#, false)
+    try expectLazyDFA(#"a(?=b)"#, false)
+    try expectLazyDFA(#"(?<=a)b"#, false)
+    try expectLazyDFA(#"(?>a+)b"#, false)
+    try expectLazyDFA(#"a++b"#, false)
+
+    // Counted repetition of a group keeps its trip counts in registers.
+    try expectLazyDFA(#"(?:ab){2,3}"#, false)
+  }
+
+  func testLiteralTrieCompile() {
+    // Alternations of three or more literals are matched with a trie.
+    expectProgram(
+      for: #"(?:GET|POST|PUT|DELETE) /"#,
+      contains: [.matchLiteralTrie],
+      doesNotContain: [.save, .splitSaving])
+    expectProgram(
+      for: #"(?:ab|a\.c|)d"#,
+      contains: [.matchLiteralTrie],
+      doesNotContain: [.save, .splitSaving])
+    expectProgram(
+      for: #"(?i:get|post|put)"#,
+      contains: [.matchLiteralTrie])
+    expectProgram(
+      for: "caf\u{E9}|th\u{E9}|eau",
+      semanticLevel: .unicodeScalar,
+      contains: [.matchLiteralTrie])
+    expectProgram(for: #"a|b"#, doesNotContain: [.matchLiteralTrie])
+
+    // Literals that could match other spellings of a character aren't.
+    expectProgram(
+      for: "caf\u{E9}|th\u{E9}|eau",
+      doesNotContain: [.matchLiteralTrie])
+    expectProgram(
+      for: "(?i:caf\u{E9}|th\u{E9}|eau)",
+      semanticLevel: .unicodeScalar,
+      doesNotContain: [.matchLiteralTrie])
+    expectProgram(for: #"a\r|b|c"#, doesNotContain: [.matchLiteralTrie])
+
+    // Nor are alternatives that aren't literals.
+    expectProgram(for: #"a|b|\d"#, doesNotContain: [.matchLiteralTrie])
+    expectProgram(for: #"a|b|(c)"#, doesNotContain: [.matchLiteralTrie])
+    expectProgram(for: #"a|b|c(?i)d"#, doesNotContain: [.matchLiteralTrie])
+    expectProgram(
+      for: #"(?:GET|POST|PUT) /"#,
+      compileOptions: .disableOptimizations,
+      doesNotContain: [.matchLiteralTrie])
+  }
+
+  func testOptimizationPasses() throws {
+    func instructionCount(
+      _ regex: String,
+      compileOptions: _CompileOptions = .default
+    ) throws -> Int {
+      try _compileRegex(regex, compileOptions: compileOptions)
+        .instructions.count
+    }
+
+    XCTAssertEqual(try instructionCount("abcd"), 2)
+    XCTAssertEqual(
+      try instructionCount("abcd", compileOptions: .disableOptimizationPasses),
+      5)
+
+    // Literal runs become a single UTF-8 match, unless a grapheme boundary
+    // check in the middle could fail.
+    expectProgram(
+      for: "abcd",
+      contains: [.matchUTF8],
+      doesNotContain: [.matchScalar, .matchScalarUnchecked])
+    expectProgram(
+      for: "a\u{301}b",
+      semanticLevel: .unicodeScalar,
+      contains: [.matchUTF8],
+      doesNotContain: [.matchScalarUnchecked])
+    expectProgram(
+      for: #"\r\n"#,
+      contains: [.matchScalar],
+      doesNotContain: [.matchUTF8])
+    expectProgram(
+      for: "(?i)abcd",
+      contains: [.matchScalarCaseInsensitive],
+      doesNotContain: [.matchUTF8])
+
+    // A single match before a quantification of the same element is folded
+    // into the quantification.
+    expectProgram(
+      for: #"\d\d*"#,
+      contains: [.quantify],
+      doesNotContain: [.matchBuiltin])
+    expectProgram(
+      for: #"[a-c][a-c]{2,4}"#,
+      contains: [.quantify],
+      doesNotContain: [.matchBitset])
+    expectProgram(
+      for: #"a[a-c]+"#,
+      contains: [.matchScalar, .quantify])
+  }
+
+  func testOptimizationPassesMatching() throws {
+    let patterns = [
+      "abcd",
+      #"\r\n"#,
+      #"a\r\nb"#,
+      "ab\u{301}c",
+      #"\d\d*"#,
+      #"[a-c][a-c]+"#,
+      #"x\w\w{2,4}"#,
+      #"..*b"#,
+      #"(?:ab|cd)+e"#,
+      #"(?:a|b|)c"#,
+      #"(a)(b)c|(ab)"#,
+      #"(?i)ab\d\d+"#,
+      #"(?:(?:ab|b)|(?:cd|d))e"#,
+      #"(?:ab)++c"#,
+      #"(?>ab|a)c"#,
+    ]
+    let inputs = [
+      "abcd",
+      "a\r\nb\r\n",
+      "ab\u{301}c abc",
+      "12345 x_1a2 xyz",
+      "cdcdabe ace bce ee dde",
+      "aab aabc ababc AB12",
+    ]
+
+    for pattern in patterns {
+      for semantics in [RegexSemanticLevel.graphemeCluster, .unicodeScalar] {
+        let regex = try Regex(pattern).matchingSemantics(semantics)
+        var reference = try Regex(pattern).matchingSemantics(semantics)
+        XCTAssert(
+          reference._forceAction(.addOptions(.disableOptimizationPasses)))
+
+        for input in inputs {
+          XCTAssertEqual(
+            input.matches(of: regex).map { $0.output.map(\.range) },
+            input.matches(of: reference).map { $0.output.map(\.range) },
+            "\(pattern) in \(input.debugDescription) (\(semantics))")
+        }
+      }
+    }
+  }
+
+  func testLargePatterns() throws {
+    // Named references are resolved by name in patterns with many captures.
+    let count = 2_000
+    let named = (0..<count).map { #"(?<g\#($0)>[a-z])\k<g\#($0)>"# }.joined()
+    let regex = try Regex(named)
+    let input = String(repeating: "qq", count: count)
+    XCTAssertNotNil(try regex.wholeMatch(in: input))
+    XCTAssertNil(try regex.wholeMatch(in: input.dropLast() + "r"))
+    XCTAssertThrowsError(try Regex(named + #"\k<g\#(count)>"#))
+
+    // A long concatenation of literals and escapes coalesces into one
+    // literal.
+    let literal = String(repeating: #"ab\"\\c\u{301}"#, count: count)
+    let expected = String(repeating: "ab\"\\c\u{301}", count: count)
+    XCTAssertNotNil(try Regex(literal).wholeMatch(in: expected))
+  }
 }
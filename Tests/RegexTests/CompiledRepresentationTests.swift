@@ -0,0 +1,249 @@
+//===----------------------------------------------------------------------===//
+//
+// This source file is part of the Swift.org open source project
+//
+// Copyright (c) 2025 Apple Inc. and the Swift project authors
+// Licensed under Apache License v2.0 with Runtime Library Exception
+//
+// See https://swift.org/LICENSE.txt for license information
+//
+//===----------------------------------------------------------------------===//
+
+@testable @_spi(RegexBenchmark) import _StringProcessing
+import XCTest
+import RegexBuilder
+
+@available(SwiftStdlib 6.1, *)
+class CompiledRepresentationTests: XCTestCase {
+  func loaded<Output>(_ regex: Regex<Output>) throws -> Regex<AnyRegexOutput> {
+    try Regex(compiledRepresentation: regex.compiledRepresentation())
+  }
+
+  /// Checks that `regex` loaded from its compiled representation finds the
+  /// same matches in `input` as `regex` does.
+  func expectSameMatches<Output>(
+    _ regex: Regex<Output>,
+    in input: String,
+    file: StaticString = #filePath,
+    line: UInt = #line
+  ) throws {
+    let loaded = try loaded(regex)
+    func outputs(_ regex: Regex<some Any>) -> [[String?]] {
+      input.matches(of: Regex<AnyRegexOutput>(regex)).map {
+        $0.output.map { $0.substring.map(String.init) }
+      }
+    }
+    XCTAssertEqual(
+      outputs(loaded), outputs(regex), file: file, line: line)
+    XCTAssertEqual(
+      try loaded.wholeMatch(in: input)?.range,
+      try regex.wholeMatch(in: input)?.range,
+      file: file, line: line)
+  }
+
+  func testRoundTrip() throws {
+    let input = "Jo Smith <jo@example.com>, ΑΒΓ 12.5 — bob@test.org 127.0.0.1"
+    let patterns = [
+      #"(?<user>[\w.+-]+)@(?<host>[\w-]+\.\w+)"#,
+      #"(?i)[a-z]+ (smith)?"#,
+      #"\p{Greek}+|\p{Nd}+(?:\.\d+)?"#,
+      #"(?:\d{1,3}\.){3}\d{1,3}"#,
+      #"\b\w+\b(?=,)"#,
+      #"(a|b)?c*"#,
+      #"(\w)\1"#,
+      #"(?:\w\d)++|(?>\w+|\d)\."#,
+      #"(?i)\b(?:smith|jo|bob)\b"#,
+      #"(?x) [[:upper:]] \w+ \s"#,
+      ".",
+    ]
+    for pattern in patterns {
+      try expectSameMatches(try Regex(pattern), in: input)
+    }
+    try expectSameMatches(
+      try Regex(#"é+"#).matchingSemantics(.unicodeScalar), in: "e\u{301}é")
+    try expectSameMatches(#/(\d+)-(\d+)/#, in: "pages 10-12, 20-21")
+    try expectSameMatches(
+      Regex {
+        OneOrMore(.digit)
+        Optionally { "."; OneOrMore(.digit) }
+      },
+      in: "12.5")
+  }
+
+  func testLoadedRegex() throws {
+    let regex = try loaded(try Regex(#"(?<key>\w+): (?<value>\w+)"#))
+    let match = try XCTUnwrap(try regex.firstMatch(in: "color: red"))
+    XCTAssertEqual(match["key"]?.substring, "color")
+    XCTAssertEqual(match[2].substring, "red")
+    XCTAssert(regex.contains(captureNamed: "value"))
+
+    // Regexes loaded from a compiled representation can be composed and
+    // converted, which parses their patterns.
+    let typed = try XCTUnwrap(
+      Regex<(Substring, Substring, Substring)>(regex))
+    XCTAssertEqual(try typed.wholeMatch(in: "a: b")?.output.2, "b")
+    XCTAssertNotNil(try regex.ignoresCase().firstMatch(in: "A: B"))
+
+    // ... and saved again.
+    let reloaded = try loaded(regex)
+    XCTAssertNotNil(try reloaded.wholeMatch(in: "x: y"))
+  }
+
+  func testStepLimit() throws {
+    let regex = try loaded(
+      try Regex(#"(a|aa)+\1b"#).matchingStepLimit(1_000))
+    XCTAssertThrowsError(
+      try regex.firstMatch(in: String(repeating: "a", count: 30) + "!b")
+    ) { error in
+      XCTAssertEqual(
+        error as? RegexStepLimitExceeded,
+        RegexStepLimitExceeded(limit: 1_000))
+    }
+  }
+
+  func testUnsupportedComponents() throws {
+    func expectUnsupported<Output>(
+      _ regex: Regex<Output>,
+      file: StaticString = #filePath,
+      line: UInt = #line
+    ) {
+      XCTAssertThrowsError(
+        try regex.compiledRepresentation(), file: file, line: line
+      ) { error in
+        XCTAssertEqual(
+          error as? CompiledRegexError, .unsupportedComponent,
+          file: file, line: line)
+      }
+    }
+
+    expectUnsupported(Regex {
+      Capture { OneOrMore(.digit) } transform: { Int($0)! }
+    })
+    let word = Reference(Substring.self)
+    expectUnsupported(Regex {
+      Capture(as: word) { OneOrMore(.word) }
+      " "
+      word
+    })
+  }
+
+  func testInvalidData() throws {
+    let bytes = try Regex("a+b").compiledRepresentation()
+
+    func expectError(
+      _ bytes: [UInt8],
+      _ expected: CompiledRegexError,
+      file: StaticString = #filePath,
+      line: UInt = #line
+    ) {
+      XCTAssertThrowsError(
+        try Regex(compiledRepresentation: bytes), file: file, line: line
+      ) { error in
+        XCTAssertEqual(
+          error as? CompiledRegexError, expected, file: file, line: line)
+      }
+    }
+
+    expectError([], .invalidData)
+    expectError(Array(bytes.dropLast()), .invalidData)
+    expectError(bytes + [0], .invalidData)
+
+    var corrupted = bytes
+    corrupted[corrupted.count - 3] ^= 1
+    expectError(corrupted, .invalidData)
+
+    var newer = bytes
+    newer[4] &+= 1
+    expectError(newer, .unsupportedVersion)
+
+    // Loading from memory that isn't aligned.
+    let unaligned = [0] + bytes
+    try unaligned.withUnsafeBytes { buffer in
+      let regex = try Regex(
+        compiledRepresentation: UnsafeRawBufferPointer(
+          rebasing: buffer.dropFirst()))
+      XCTAssertNotNil(try regex.wholeMatch(in: "aab"))
+    }
+  }
+
+  func testInvalidContents() throws {
+    let regex = try Regex("(a)+b")
+    let bytes = try regex.compiledRepresentation()
+    XCTAssertNotNil(try Regex(compiledRepresentation: bytes).wholeMatch(in: "aab"))
+
+    /// Returns `bytes` with its checksum updated, so that only the checks of
+    /// its contents can reject it.
+    func resealed(_ bytes: [UInt8]) -> [UInt8] {
+      var hash: UInt64 = 0xcbf2_9ce4_8422_2325
+      for byte in bytes.dropFirst(24) {
+        hash = (hash ^ UInt64(byte)) &* 0x100_0000_01b3
+      }
+      var result = bytes
+      withUnsafeBytes(of: hash.littleEndian) {
+        result.replaceSubrange(16..<24, with: $0)
+      }
+      return result
+    }
+
+    func expectInvalid(
+      _ bytes: [UInt8],
+      file: StaticString = #filePath,
+      line: UInt = #line
+    ) {
+      XCTAssertThrowsError(
+        try Regex(compiledRepresentation: resealed(bytes)),
+        file: file, line: line
+      ) { error in
+        XCTAssertEqual(
+          error as? CompiledRegexError, .invalidData, file: file, line: line)
+      }
+    }
+
+    // The pattern follows its length at the start of the payload.
+    let patternStart = 32
+    XCTAssertEqual(
+      Array(bytes[patternStart..<patternStart + 5]), Array("(a)+b".utf8))
+    func replacingPattern(with pattern: String) -> [UInt8] {
+      var result = bytes
+      result.replaceSubrange(
+        patternStart..<patternStart + 5, with: Array(pattern.utf8))
+      return result
+    }
+    // A pattern that doesn't parse, and one with different captures.
+    expectInvalid(replacingPattern(with: "(a)+("))
+    expectInvalid(replacingPattern(with: "a|a+b"))
+
+    // The instructions end the representation.
+    let instructionCount = regex.program.loweredProgram.instructions.count
+    let instructionsStart = bytes.count - 8 * instructionCount
+    func replacingInstruction(
+      _ opcodes: Instruction.OpCode...,
+      with transform: (UInt64) -> UInt64
+    ) throws -> [UInt8] {
+      let offsets = stride(from: instructionsStart, to: bytes.count, by: 8)
+      let offset = try XCTUnwrap(offsets.first { start in
+        opcodes.contains { UInt64(bytes[start + 7]) == $0.rawValue }
+      })
+      let word = bytes[offset..<offset + 8].reversed().reduce(UInt64(0)) {
+        $0 << 8 | UInt64($1)
+      }
+      var result = bytes
+      withUnsafeBytes(of: transform(word).littleEndian) {
+        result.replaceSubrange(offset..<offset + 8, with: $0)
+      }
+      return result
+    }
+    // A capture that doesn't exist.
+    expectInvalid(try replacingInstruction(.beginCapture) {
+      $0 & _opcodeMask | 1
+    })
+    // A surrogate, which isn't a scalar.
+    expectInvalid(try replacingInstruction(.matchScalar) {
+      $0 & ~0xFFFF_FFFF | 0xD800
+    })
+    // An instruction address past the end.
+    expectInvalid(try replacingInstruction(.save, .splitSaving, .branch) {
+      $0 & _opcodeMask | UInt64(instructionCount)
+    })
+  }
+}
@@ -0,0 +1,130 @@
+//===----------------------------------------------------------------------===//
+//
+// This source file is part of the Swift.org open source project
+//
+// Copyright (c) 2025 Apple Inc. and the Swift project authors
+// Licensed under Apache License v2.0 with Runtime Library Exception
+//
+// See https://swift.org/LICENSE.txt for license information
+//
+//===----------------------------------------------------------------------===//
+
+@testable import _StringProcessing
+import XCTest
+
+private let graphemeBreakingInputs: [String] = [
+  "",
+  "a",
+  "plain ASCII that is long enough to be skipped a word at a time",
+  "line one\r\nline two\r\n\r\n\n\rthree",
+  "Cafe\u{301} cre\u{300}me bru\u{302}le\u{301}e",
+  "\u{1100}\u{1161}\u{11A8}\u{AC00}\u{11A8}\u{AC01}\u{1161} 한국어",
+  "👨‍👩‍👧‍👦 👍🏽 ❤️ a\u{200D}👍 👨\u{301}\u{200D}👩",
+  "🇯🇵🇫🇷🇺 🇸🇪🇸",
+  "\u{600}1\u{605}\u{301}x \u{903}\u{915}\u{93F}",
+  // Viramas may join Indic conjuncts.
+  "\u{915}\u{94D}\u{937} \u{915}\u{94D}\u{200D}\u{937} \u{915}\u{94D} a",
+  // Scalars that are newer than the kernel's data.
+  "a\u{1FAE8}\u{1F3FB}b \u{11F00}\u{11F41} \u{E0061}",
+  "\u{0}\u{7F}\u{85}\u{AD}\u{2028}x\u{200B}\u{FEFF}",
+  String(repeating: "aé\r\n👍🏽", count: 40),
+]
+
+class GraphemeBreakingTests: XCTestCase {
+  func testIndexAfterUsingCache() {
+    for input in graphemeBreakingInputs {
+      var cache = GraphemeBreakCache()
+      var expected = Array(input.indices) + [input.endIndex]
+      var i = input.startIndex
+      var actual = [i]
+      while i < input.endIndex {
+        i = input.index(after: i, using: &cache)
+        actual.append(i)
+      }
+      XCTAssertEqual(actual, expected, input.debugDescription)
+
+      // Stepping from scalars that aren't at the start of a character finds
+      // the same breaks as the standard library.
+      expected = input.unicodeScalars.indices.map { input.index(after: $0) }
+      actual = input.unicodeScalars.indices.map {
+        input.index(after: $0, using: &cache)
+      }
+      XCTAssertEqual(actual, expected, input.debugDescription)
+    }
+  }
+
+  func testAllScalars() {
+    // The kernel's data is older than the standard library's, so every
+    // scalar is checked where its class matters: after a letter, before a
+    // letter, before a combining mark, and before a ZWJ emoji sequence.
+    let shapes: [(Unicode.Scalar) -> String] = [
+      { "a\($0)" },
+      { "\($0)a" },
+      { "\($0)\u{301}" },
+      { "\($0)\u{200D}👍" },
+    ]
+
+    func breaksMatch(_ input: String) -> Bool {
+      var cache = GraphemeBreakCache()
+      var i = input.startIndex
+      for expected in input.indices.dropFirst() + [input.endIndex] {
+        i = input.index(after: i, using: &cache)
+        guard i == expected else { return false }
+      }
+      return true
+    }
+
+    let scalars = Array(allScalars)
+    for chunkStart in stride(from: 0, to: scalars.count, by: 1024) {
+      let chunk = scalars[chunkStart..<min(chunkStart + 1024, scalars.count)]
+      for shape in shapes {
+        // Line feeds break on both sides, so each sample breaks as it would
+        // on its own.
+        let samples = chunk.map(shape)
+        guard !breaksMatch(samples.joined(separator: "\n")) else { continue }
+        for (scalar, sample) in zip(chunk, samples) where !breaksMatch(sample) {
+          XCTFail("""
+            U+\(String(scalar.value, radix: 16, uppercase: true)) \
+            in \(sample.debugDescription)
+            """)
+        }
+      }
+    }
+  }
+
+  func testQuickIndexBefore() {
+    for input in graphemeBreakingInputs {
+      for i in input.indices.dropFirst() + [input.endIndex] {
+        guard let quick = input._quickIndex(beforeCharacterEndingAt: i) else {
+          continue
+        }
+        XCTAssertEqual(quick, input.index(before: i), input.debugDescription)
+      }
+    }
+    XCTAssertNil("\u{600}a"._quickIndex(beforeCharacterEndingAt: "\u{600}a".endIndex))
+    XCTAssertNotNil("é\r\n"._quickIndex(beforeCharacterEndingAt: "é\r\n".endIndex))
+  }
+
+  func testMatchingSteppedCharacters() {
+    for input in graphemeBreakingInputs {
+      let expected = input.split(
+        omittingEmptySubsequences: false, whereSeparator: \.isNewline)
+      allMatchesTest(
+        #"(?m)^.*$"#, input: input, matches: expected.map(String.init))
+      firstMatchTest(#"(?s).+"#, input: input, match: input.isEmpty ? nil : input)
+    }
+
+    firstMatchTest(
+      #"(.*)\u{301}"#, input: "Cafe\u{301}", match: nil)
+    firstMatchTest(
+      #"(.*)e"#, input: "Cafe\u{301} bue", match: "Cafe\u{301} bue")
+    firstMatchTest(
+      #"(.+)🇫🇷"#, input: "🇯🇵🇫🇷🇺", match: "🇯🇵🇫🇷")
+    firstMatchTest(
+      #".{2}\r\n"#, input: "é👍🏽\r\n", match: "é👍🏽\r\n")
+    firstMatchTest(
+      #"[a-z]\d"#, input: "\u{AC00}\u{11A8}é👨‍👩‍👧‍👦x1", match: "x1")
+    firstMatchTest(
+      #"\u{915}.\u{937}"#, input: "\u{915}\u{94D}\u{937}", match: nil)
+  }
+}
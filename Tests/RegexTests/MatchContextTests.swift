@@ -0,0 +1,199 @@
+//===----------------------------------------------------------------------===//
+//
+// This source file is part of the Swift.org open source project
+//
+// Copyright (c) 2025 Apple Inc. and the Swift project authors
+// Licensed under Apache License v2.0 with Runtime Library Exception
+//
+// See https://swift.org/LICENSE.txt for license information
+//
+//===----------------------------------------------------------------------===//
+
+@testable import _StringProcessing
+import XCTest
+
+private let matchContextInputs: [String] = [
+  "key=42",
+  "",
+  "a longer line with key=7 in the middle",
+  "key=",
+  "K\u{301}EY=1",
+  "caf\u{E9}=99 and caf\u{E9}=100",
+  "x",
+  "key=42",
+  "\u{1F468}\u{200D}\u{1F469}=1\r\nkey=2",
+]
+
+@available(SwiftStdlib 6.1, *)
+class MatchContextTests: XCTestCase {
+  func expectContextMatches(
+    _ pattern: String,
+    semanticLevel: RegexSemanticLevel = .graphemeCluster,
+    file: StaticString = #filePath,
+    line: UInt = #line
+  ) throws {
+    let regex = try Regex(pattern).matchingSemantics(semanticLevel)
+    var context = RegexMatchContext(regex)
+
+    func output(_ match: Regex<AnyRegexOutput>.Match?) -> [String?]? {
+      match?.output.map { $0.substring.map(String.init) }
+    }
+
+    // Interleave the operations, so each one starts from a context left in
+    // a different state by the last.
+    for input in matchContextInputs + matchContextInputs.reversed() {
+      let message = "\(pattern) in \(input.debugDescription)"
+      let substring = input.dropFirst(input.isEmpty ? 0 : 1)
+
+      XCTAssertEqual(
+        output(try context.wholeMatch(in: input)),
+        output(try regex.wholeMatch(in: input)),
+        message, file: file, line: line)
+      XCTAssertEqual(
+        try context.wholeMatchRange(in: input),
+        try regex.wholeMatch(in: input)?.range,
+        message, file: file, line: line)
+      XCTAssertEqual(
+        output(try context.firstMatch(in: substring)),
+        output(try regex.firstMatch(in: substring)),
+        message, file: file, line: line)
+      XCTAssertEqual(
+        try context.firstMatchRange(in: input),
+        try regex.firstMatch(in: input)?.range,
+        message, file: file, line: line)
+      XCTAssertEqual(
+        output(try context.prefixMatch(in: input)),
+        output(try regex.prefixMatch(in: input)),
+        message, file: file, line: line)
+    }
+  }
+
+  func testMatchContext() throws {
+    for semanticLevel in [RegexSemanticLevel.graphemeCluster, .unicodeScalar] {
+      for pattern in [
+        #"(\w+)=(\d+)"#,
+        #"key=\d*"#,
+        #"(?i)key=(?<value>\d+)?"#,
+        #"\b\w+\b"#,
+        #"^.*$"#,
+        #"(?m)^(.+)$"#,
+        #"(a|ab)(c|bcd)?(d*)"#,
+        #"(\w)\1*="#,
+        #"\w="#,
+      ] {
+        try expectContextMatches(pattern, semanticLevel: semanticLevel)
+      }
+    }
+  }
+
+  func expectContextOffsets(
+    _ pattern: String,
+    semanticLevel: RegexSemanticLevel = .graphemeCluster,
+    file: StaticString = #filePath,
+    line: UInt = #line
+  ) throws {
+    let regex = try Regex(pattern).matchingSemantics(semanticLevel)
+    var context = RegexMatchContext(regex)
+    var buffer = [Int](repeating: .min, count: 2 * (context.captureCount + 1))
+
+    func offsets(
+      _ match: Regex<AnyRegexOutput>.Match, in string: Substring
+    ) -> [Int] {
+      match.output.flatMap { element -> [Int] in
+        guard let range = element.range else { return [-1, -1] }
+        return [
+          string.utf8.distance(from: string.startIndex, to: range.lowerBound),
+          string.utf8.distance(from: string.startIndex, to: range.upperBound),
+        ]
+      }
+    }
+
+    for input in matchContextInputs + matchContextInputs.reversed() {
+      let message = "\(pattern) in \(input.debugDescription)"
+      let substring = input.dropFirst(input.isEmpty ? 0 : 1)
+
+      try buffer.withUnsafeMutableBufferPointer { buffer in
+        let wholeMatch = try regex.wholeMatch(in: input)
+        XCTAssertEqual(
+          try context.wholeMatch(in: input[...], offsets: buffer),
+          wholeMatch != nil,
+          message, file: file, line: line)
+        if let wholeMatch {
+          XCTAssertEqual(
+            Array(buffer), offsets(wholeMatch, in: input[...]),
+            message, file: file, line: line)
+        }
+
+        let firstMatch = try regex.firstMatch(in: substring)
+        XCTAssertEqual(
+          try context.firstMatch(in: substring, offsets: buffer),
+          firstMatch != nil,
+          message, file: file, line: line)
+        if let firstMatch {
+          XCTAssertEqual(
+            Array(buffer), offsets(firstMatch, in: substring),
+            message, file: file, line: line)
+        }
+
+        var allOffsets: [[Int]] = []
+        try context.forEachMatch(in: substring, offsets: buffer) {
+          allOffsets.append(Array(buffer))
+        }
+        XCTAssertEqual(
+          allOffsets,
+          substring.matches(of: regex).map { offsets($0, in: substring) },
+          message, file: file, line: line)
+      }
+    }
+  }
+
+  func testMatchContextOffsets() throws {
+    for semanticLevel in [RegexSemanticLevel.graphemeCluster, .unicodeScalar] {
+      for pattern in [
+        #"(\w+)=(\d+)"#,
+        #"key=\d*"#,
+        #"(?i)key=(?<value>\d+)?"#,
+        #"\b\w+\b"#,
+        #"(?m)^(.+)$"#,
+        #"(a|ab)(c|bcd)?(d*)"#,
+        #"(\w)\1*="#,
+        #"(x)|(=)"#,
+        #"\d*"#,
+      ] {
+        try expectContextOffsets(pattern, semanticLevel: semanticLevel)
+      }
+    }
+  }
+
+  func testMatchContextOffsetsLayout() throws {
+    var context = RegexMatchContext(try Regex(#"(\w+)@(\w+)(!)?"#))
+    XCTAssertEqual(context.captureCount, 3)
+
+    // Offsets past the ones for the regex's captures are left alone, and
+    // unmatched captures are -1.
+    var buffer = [Int](repeating: 99, count: 10)
+    let matched = try buffer.withUnsafeMutableBufferPointer {
+      try context.firstMatch(in: "to: caf\u{E9}@example"[...], offsets: $0)
+    }
+    XCTAssertTrue(matched)
+    XCTAssertEqual(buffer, [4, 17, 4, 9, 10, 17, -1, -1, 99, 99])
+
+    // Nothing is written without a match.
+    buffer = [Int](repeating: 99, count: 8)
+    let matchedAgain = try buffer.withUnsafeMutableBufferPointer {
+      try context.wholeMatch(in: "no match"[...], offsets: $0)
+    }
+    XCTAssertFalse(matchedAgain)
+    XCTAssertEqual(buffer, [Int](repeating: 99, count: 8))
+  }
+
+  func testMatchContextAfterError() throws {
+    let regex = try Regex(#"(a|aa)+\1b"#).matchingStepLimit(1_000)
+    var context = RegexMatchContext(regex)
+
+    XCTAssertThrowsError(
+      try context.firstMatch(in: String(repeating: "a", count: 30) + "!b"))
+    XCTAssertNotNil(try context.wholeMatch(in: "aaaab"))
+    XCTAssertNil(try context.firstMatchRange(in: "aaa!b"))
+  }
+}
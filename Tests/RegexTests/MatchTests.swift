@@ -145,6 +145,21 @@ func _firstMatch(
     _ = try regex.firstMatch(in: str[lower...])
   }
 
+  do {
+    var threaded = regex
+    precondition(threaded._forceAction(.addOptions(.enableThreadedCode)))
+    let threadedResult = try threaded.firstMatch(in: input)
+    if threadedResult?.range != result?.range
+        || threadedResult?.output.slices(from: input)
+          != result?.output.slices(from: input) {
+      throw MatchError("""
+
+      Interpreted regex returned: \(result.map { input[$0.range] } ?? "nil")
+      Threaded regex returned: \(threadedResult.map { input[$0.range] } ?? "nil")
+      """)
+    }
+  }
+
   if validateOptimizations {
     precondition(regex._forceAction(.addOptions(.disableOptimizations)))
     let unoptResult = try regex.firstMatch(in: input)
@@ -2036,6 +2051,21 @@ extension RegexTests {
       ("bacada", nil),
       (":a:boco", ["a"])          // this matches only the ':a:' prefix
     )
+
+    // Captures set inside a successful lookahead are undone when
+    // backtracking to a save point pushed before it.
+    flatCaptureTest(
+      #"(?=(a))ab|(?=(a))ac"#,
+      ("ab", ["a", nil]),
+      ("ac", [nil, "a"]))
+    flatCaptureTest(
+      #"(?:(a)|(b)){2}c|(ab)d"#,
+      ("abc", ["a", "b", nil]),
+      ("abd", [nil, nil, "ab"]))
+    flatCaptureTest(
+      #"(?:(a)|(b))+?c"#,
+      ("abc", ["a", "b"]),
+      ("bac", ["a", "b"]))
   }
 
   func testMatchReferences() {
@@ -2787,6 +2817,25 @@ extension RegexTests {
     firstMatchTest(#"\Q\E"#, input: "", match: "")
   }
   
+  func testRequiredLiteralPrefilter() throws {
+    firstMatchTest(
+      #"ERROR: (\d+) .*timeout"#,
+      input: "INFO: 1 ok\nERROR: 2 ok\nERROR: 42 request timeout",
+      match: "ERROR: 42 request timeout")
+    firstMatchTest(#"\d+abc"#, input: "123ab 456 abc", match: nil)
+    firstMatchTest(#"\d+abc"#, input: "123ab 456abc", match: "456abc")
+
+    // A literal occurrence inside a grapheme cluster can't start a match
+    // under grapheme cluster semantics. (U+0600 is a prepended mark.)
+    allMatchesTest("foo", input: "\u{600}foo foo", matches: ["foo"])
+    allMatchesTest(
+      "foo", input: "\u{600}foo foo", matches: ["foo", "foo"],
+      semanticLevel: .unicodeScalar)
+    allMatchesTest(
+      #"(?:GET|POST) /\w+"#, input: "\u{600}GET /x GET /a PUT /b POST /c",
+      matches: ["GET /a", "POST /c"])
+  }
+
   func testCase() {
     let regex = try! Regex(#".\N{SPARKLING HEART}."#)
     let input = "🧟‍♀️💖🧠 or 🧠💖☕️"
@@ -2876,6 +2925,119 @@ extension RegexTests {
     expectCompletion(regex: #"(?:(?!\d)[0-9]*)*"#, in: "a")
   }
 
+  func testLazyDFA() throws {
+    // Inputs without a match are rejected in linear time, even by patterns
+    // that backtrack exponentially. (These patterns have no required literal,
+    // so the prefilter can't rule them out.)
+    let as64 = String(repeating: "a", count: 64)
+    expectCompletion(regex: #"(a*)*[bc]"#, in: as64)
+    expectCompletion(regex: #"(a|aa)+[bc]"#, in: as64)
+    expectCompletion(
+      regex: #"^(\w+\s?)*$"#, in: String(repeating: "word ", count: 20) + "!")
+    XCTAssertFalse(as64.contains(try Regex(#"(a|a)*\d"#)))
+    XCTAssertNil(try Regex(#"(a*)*b"#).wholeMatch(in: as64))
+
+    // `wholeMatch` and `contains` are answered by the lazy DFA directly, so
+    // compare them against the backtracking engine.
+    let cases: [(pattern: String, input: String)] = [
+      (#"(?:a|aa)+"#, as64),
+      (#"(?:a|aa)+b"#, as64 + "b"),
+      (#"\w+@\w+\.com"#, "user@example.com"),
+      (#"\w+@\w+\.com"#, "user@example.org"),
+      (#"(?i)CAF\u{E9}"#, "cafe\u{301}"),
+      (#"caf."#, "cafe\u{301}"),
+      (#"a.b"#, "a\r\nb"),
+      (#"a\Rb"#, "a\r\nb"),
+      (#"(?m)^\d+$"#, "12\n34"),
+      (#"\bfoo\b"#, "a foo b"),
+      (#"\bfoo\b"#, "afoob"),
+      (#"a{2,3}b"#, "aaab"),
+      (#"a{2,3}b"#, "aaaab"),
+      (#"a.*?b"#, "a\u{1F600}b"),
+      (#"[^a-z]+"#, "123\u{E9}"),
+      (#"(?:a|ab|abc)+c"#, "ababcabcc"),
+      (#"(?i)(?:ok|kb|mb)+!"#, "OK\u{212A}bmB!"),
+      (#"(?:fo|foo|f)\b"#, "foo\u{301} fo"),
+    ]
+    for (pattern, input) in cases {
+      let regex = try Regex(pattern)
+      var backtracking = try Regex(pattern)
+      XCTAssert(backtracking._forceAction(.addOptions(.disableOptimizations)))
+      XCTAssertEqual(
+        try regex.wholeMatch(in: input)?.range,
+        try backtracking.wholeMatch(in: input)?.range,
+        "wholeMatch of \(pattern) in \(input)")
+      XCTAssertEqual(
+        input.contains(regex), input.contains(backtracking),
+        "contains \(pattern) in \(input)")
+      XCTAssertEqual(
+        input.matches(of: regex).map(\.range),
+        input.matches(of: backtracking).map(\.range),
+        "matches of \(pattern) in \(input)")
+    }
+
+    firstMatchTest(#"(a|b)*c"#, input: "ababx abc", match: "abc")
+    firstMatchTest(#"\d+(?:\.\d+)?%"#, input: "1.5 or 2.25%", match: "2.25%")
+    firstMatchTest(#"caf\u{E9}"#, input: "le cafe\u{301}", match: "cafe\u{301}")
+    firstMatchTest(#"e"#, input: "cafe\u{301}", match: nil)
+    firstMatchTest(
+      #"e"#, input: "cafe\u{301}", match: "e", semanticLevel: .unicodeScalar)
+  }
+
+  func testLiteralAlternation() throws {
+    firstMatchTests(
+      #"(?:GET|POST|PUT|PATCH|DELETE) /"#,
+      ("PATCH /x", "PATCH /"),
+      ("PUTS /", nil),
+      ("xDELETE /", "DELETE /"))
+
+    // Alternatives are tried in order, not by length, and backtracking
+    // reaches the later ones.
+    firstMatchTest(#"(?:a|ab|abc)"#, input: "abc", match: "a")
+    firstMatchTest(#"(?:abc|ab|a)"#, input: "abc", match: "abc")
+    firstMatchTest(#"(?:a|ab|abc)c"#, input: "abcc", match: "abc")
+    firstMatchTest(#"(?:a|ab|abc)$"#, input: "abc", match: "abc")
+    firstMatchTest(#"x(?:|y|yz)z"#, input: "xyz", match: "xyz")
+    firstMatchTest(#"(?>a|ab|abc)c"#, input: "abc", match: nil)
+    firstMatchTest(#"(?:ab|ab|a)b"#, input: "ab", match: "ab")
+
+    // Under grapheme cluster semantics, a match must end on a boundary.
+    firstMatchTest(#"(?:cafe|tea|water)"#, input: "cafe\u{301}", match: nil)
+    firstMatchTest(#"(?:caf|cafe|tea)"#, input: "cafe\u{301}", match: "caf")
+    firstMatchTest(
+      #"(?:cafe|tea|water)"#, input: "cafe\u{301}", match: "cafe",
+      semanticLevel: .unicodeScalar)
+    firstMatchTest(
+      "(?:\u{E9}|\u{FC}|\u{F6})", input: "e\u{301}\u{E9}", match: "\u{E9}",
+      semanticLevel: .unicodeScalar)
+    firstMatchTest(
+      "(?:\u{E9}|\u{FC}|\u{F6})", input: "e\u{301}", match: "e\u{301}")
+
+    // Case-insensitive matching folds non-ASCII scalars whose case folding
+    // is ASCII.
+    firstMatchTests(
+      #"(?i)(?:get|post|put)\b"#,
+      ("Post", "Post"),
+      ("PUTS put", "put"))
+    for semanticLevel in [RegexSemanticLevel.graphemeCluster, .unicodeScalar] {
+      firstMatchTest(
+        #"(?i)(?:ok|kb|mb)"#, input: "\u{212A}B", match: "\u{212A}B",
+        semanticLevel: semanticLevel)
+      firstMatchTest(
+        #"(?i)(?:ss|st|sp)"#, input: "\u{17F}s", match: "\u{17F}s",
+        semanticLevel: semanticLevel)
+    }
+    firstMatchTest(
+      #"(?i)(?:ok|kb|mb)"#, input: "\u{212A}\u{301}b kB", match: "kB")
+
+    // Large keyword lists.
+    let words = (0..<2_000).map { "word\($0)x" }
+    let regex = try Regex(#"\b(?:\#(words.joined(separator: "|")))\b"#)
+    XCTAssertEqual(
+      "word17 word1999x word20000x word7x".matches(of: regex).map(\.0),
+      ["word1999x", "word7x"])
+  }
+
   func testQuantifyOptimization() throws {
     // test that the maximum values for minTrips and maxExtraTrips are handled correctly
     let maxStorable = Int(QuantifyPayload.maxStorableTrips)
@@ -0,0 +1,179 @@
+//===----------------------------------------------------------------------===//
+//
+// This source file is part of the Swift.org open source project
+//
+// Copyright (c) 2025 Apple Inc. and the Swift project authors
+// Licensed under Apache License v2.0 with Runtime Library Exception
+//
+// See https://swift.org/LICENSE.txt for license information
+//
+//===----------------------------------------------------------------------===//
+
+@testable @_spi(RegexBenchmark) import _StringProcessing
+import RegexBuilder
+import XCTest
+
+@available(SwiftStdlib 6.1, *)
+class MemoizationTests: XCTestCase {
+  func memoRows(_ pattern: String) throws -> [Int]? {
+    try Regex(pattern).program.loweredProgram.memoRows
+  }
+
+  func testMemoizationRows() throws {
+    XCTAssertNotNil(try memoRows(#"(a|aa)+b"#))
+    XCTAssertNotNil(try memoRows(#"(?:a+)+b|c"#))
+    XCTAssertNotNil(try memoRows(#"[a-z]+@[a-z]+\.com"#))
+
+    // Counters, position registers, and cuts make the state more than the
+    // instruction and position.
+    XCTAssertNil(try memoRows(#"(a|aa)+\1"#))
+    XCTAssertNil(try memoRows(#"(?:a|aa){2,5}b"#))
+    XCTAssertNil(try memoRows(#"(?:a|aa)+(?=b)"#))
+    XCTAssertNil(try memoRows(#"(?>a|aa)+b"#))
+    XCTAssertNil(try memoRows(#"(?:a*)*b"#))
+  }
+
+  /// Checks that `pattern` matches the same in `input` as it does without
+  /// optimizations, which emit programs that aren't memoized.
+  func expectSameMatches(
+    _ pattern: String,
+    in input: String,
+    file: StaticString = #filePath,
+    line: UInt = #line
+  ) throws {
+    let regex = try Regex(pattern)
+    var reference = try Regex(pattern)
+    XCTAssert(reference._forceAction(.addOptions(.disableOptimizations)))
+    XCTAssertNil(reference.program.loweredProgram.memoRows)
+
+    func output(_ match: Regex<AnyRegexOutput>.Match?) -> [String?]? {
+      match?.output.map { $0.substring.map(String.init) }
+    }
+    XCTAssertEqual(
+      output(try regex.firstMatch(in: input)),
+      output(try reference.firstMatch(in: input)),
+      "firstMatch of \(pattern) in \(input)",
+      file: file, line: line)
+    XCTAssertEqual(
+      output(try regex.prefixMatch(in: input)),
+      output(try reference.prefixMatch(in: input)),
+      "prefixMatch of \(pattern) in \(input)",
+      file: file, line: line)
+    XCTAssertEqual(
+      input.matches(of: regex).map(\.range),
+      input.matches(of: reference).map(\.range),
+      "matches of \(pattern) in \(input)",
+      file: file, line: line)
+  }
+
+  func testMemoizedMatches() throws {
+    let a18 = String(repeating: "a", count: 18)
+    let inputs = [
+      a18,
+      a18 + "b",
+      a18 + "c",
+      a18 + "!" + a18 + "b",
+      "ab" + a18 + "aab" + a18,
+    ]
+    let patterns = [
+      #"(a|aa)+b"#,
+      #"(a|aa)+b|c"#,
+      #"(?:(a)|(aa))+(b|$)"#,
+      #"(a+)+b"#,
+      #"(a+?)+?c"#,
+      #"(?:a|a)*(a)b"#,
+      #"^(a|aa|aaa)+$"#,
+    ]
+    for pattern in patterns {
+      for input in inputs {
+        try expectSameMatches(pattern, in: input)
+      }
+    }
+  }
+
+  func testPathologicalInput() throws {
+    // Each of these would take time exponential in the length of the input
+    // without memoization.
+    let input = String(repeating: "a", count: 2_000)
+
+    let alternation = try Regex(#"(a|aa)+b|!"#)
+    XCTAssertNil(try alternation.firstMatch(in: input))
+    XCTAssertNil(try alternation.prefixMatch(in: input))
+    XCTAssertEqual(
+      try alternation.firstMatch(in: input + "!")?.range,
+      input.endIndex..<(input + "!").endIndex)
+
+    let nested = try Regex(#"(?:a+)+b"#)
+    XCTAssertNil(try nested.prefixMatch(in: input))
+    XCTAssertEqual(input.matches(of: nested).count, 0)
+  }
+
+  func testMemoizationWithTransforms() throws {
+    // Whether a transform succeeds depends on where its capture began,
+    // which isn't part of the memoized state. This search backtracks long
+    // enough to turn memoization on before it reaches the one capture that
+    // succeeds.
+    let input = String(repeating: "a", count: 16) + "b"
+    let regex = Regex {
+      ZeroOrMore { ChoiceOf { "a"; "aa" } }
+      TryCapture {
+        ZeroOrMore { ChoiceOf { "a"; "aa" } }
+      } transform: { $0.count == 16 ? $0.count : nil }
+      "b"
+    }
+    XCTAssertNil(regex.program.loweredProgram.memoRows)
+    XCTAssertEqual(try regex.wholeMatch(in: input)?.output.1, 16)
+    XCTAssertEqual(try regex.firstMatch(in: input)?.output.1, 16)
+  }
+
+  func testLazyDFAExistenceCheck() throws {
+    // The lazy DFA only checks for a match once backtracking has run long,
+    // after which the interrupted attempt is tried again.
+    let input = String(repeating: "a", count: 5_000)
+    let regex = try Regex(#"(a|aa)+b|!"#)
+    XCTAssertNil(try regex.firstMatch(in: input))
+    XCTAssertEqual(
+      try regex.firstMatch(in: input + "!")?.range,
+      input.endIndex..<(input + "!").endIndex)
+    XCTAssertEqual((input + "!").matches(of: regex).count, 1)
+
+    // Matches found right away are unaffected.
+    let words = String(repeating: "abc1 ", count: 1_000)
+    XCTAssertEqual(words.matches(of: /[a-z]+[0-9]/).count, 1_000)
+
+    // Whole matches with captures are checked the same way.
+    let captures = try Regex(#"(a|aa)+(b)"#)
+    XCTAssertNil(try captures.wholeMatch(in: input))
+    XCTAssertEqual(
+      try captures.wholeMatch(in: input + "b")?.output[2].substring, "b")
+    XCTAssertNil(try captures.wholeMatch(in: input + "b!"))
+  }
+
+  func testStepLimit() throws {
+    // Backreferences aren't memoized.
+    let input = String(repeating: "a", count: 30) + "!b"
+    let regex = try Regex(#"(a|aa)+\1b"#).matchingStepLimit(10_000)
+    XCTAssertThrowsError(try regex.firstMatch(in: input)) { error in
+      XCTAssertEqual(
+        error as? RegexStepLimitExceeded,
+        RegexStepLimitExceeded(limit: 10_000))
+    }
+    XCTAssertThrowsError(try regex.wholeMatch(in: input))
+    XCTAssertNil(input.firstMatch(of: regex))
+    XCTAssertFalse(input.contains(regex))
+
+    // The limit applies to each search for a match.
+    let pairs = try Regex(#"(\w)\1"#).matchingStepLimit(50)
+    let sentence = String(repeating: "aa bb cc ", count: 100)
+    XCTAssertEqual(sentence.matches(of: pairs).count, 300)
+
+    // Removing the limit.
+    let unlimited = try Regex(#"(a|aa)+\1b"#)
+      .matchingStepLimit(10).matchingStepLimit(nil)
+    XCTAssertNil(try unlimited.firstMatch(in: "aaaaaaaa!b"))
+
+    // A limit of zero stops every search before it starts.
+    XCTAssertThrowsError(
+      try Regex("a").matchingStepLimit(0).firstMatch(in: "a"))
+  }
+}
@@ -0,0 +1,110 @@
+//===----------------------------------------------------------------------===//
+//
+// This source file is part of the Swift.org open source project
+//
+// Copyright (c) 2025 Apple Inc. and the Swift project authors
+// Licensed under Apache License v2.0 with Runtime Library Exception
+//
+// See https://swift.org/LICENSE.txt for license information
+//
+//===----------------------------------------------------------------------===//
+
+@testable import _StringProcessing
+import XCTest
+
+/// Runs each iteration in turn, in reverse order so that no chunk can rely
+/// on an earlier one having finished.
+private func reversePerform(_ iterations: Int, _ body: (Int) -> Void) {
+  for i in (0..<iterations).reversed() {
+    body(i)
+  }
+}
+
+@available(SwiftStdlib 6.1, *)
+class ParallelMatchesTests: XCTestCase {
+  func expectParallelMatches(
+    _ pattern: String,
+    in input: String,
+    file: StaticString = #filePath,
+    line: UInt = #line
+  ) throws {
+    let regex = try Regex(pattern)
+    let expected = input.matches(of: regex).map(\.range)
+    for chunkCount in [1, 2, 3, 8, 64] {
+      let actual = input.ranges(
+        of: regex, chunkCount: chunkCount, concurrentPerform: reversePerform)
+      XCTAssertEqual(
+        actual, expected, "\(pattern) in \(chunkCount) chunks",
+        file: file, line: line)
+    }
+  }
+
+  func testParallelMatches() throws {
+    let lines = (0..<2000).map { i in
+      "\(i) caf\u{E9} \(i % 7 == 0 ? "ERROR" : "INFO") e\u{301}t\u{E9} \u{1F1FA}\u{1F1F8}"
+    }
+    let log = lines.joined(separator: "\n")
+
+    try expectParallelMatches(#"\d+"#, in: log)
+    try expectParallelMatches(#"ERROR"#, in: log)
+    try expectParallelMatches(#"(?m)^\d+ caf\u{E9} ERROR$"#, in: log)
+    try expectParallelMatches(#"(?m)^.*$"#, in: log)
+    try expectParallelMatches(#"\b\w+\b"#, in: log)
+    try expectParallelMatches(#"(?<=ERROR )\w"#, in: log)
+    try expectParallelMatches(#"x*"#, in: log)
+    try expectParallelMatches(#"(?u)."#, in: log)
+    try expectParallelMatches(#"nothing"#, in: log)
+
+    // Matches that span many chunks push the sequential search past the
+    // starts that later chunks tried.
+    try expectParallelMatches(#"1[^x]{0,9000}?9"#, in: log)
+    try expectParallelMatches(#"\d(?s:.){5000}"#, in: log)
+    try expectParallelMatches(#"ERROR[^x]{5000}"#, in: log)
+    try expectParallelMatches(
+      #"a[^x]*"#, in: "a" + String(repeating: "b", count: 20_000))
+
+    // Without newlines, splits fall on character boundaries.
+    let flat = String(repeating: "ab\u{E9}e\u{301}\u{1F1FA}\u{1F1F8}", count: 5000)
+    try expectParallelMatches(#"b.e"#, in: flat)
+    try expectParallelMatches(#"(?u)\u{301}"#, in: flat)
+    try expectParallelMatches(#"[^b]+"#, in: flat)
+  }
+
+  func testParallelMatchesFallBack() throws {
+    let input = String(repeating: "aab\n", count: 5000)
+
+    // `\G` depends on where each search resumes.
+    try expectParallelMatches(#"\Ga"#, in: input)
+    // Start-anchored regexes only match once.
+    try expectParallelMatches(#"^a"#, in: input)
+    // Short input is searched in one chunk.
+    try expectParallelMatches(#"a"#, in: "banana")
+    try expectParallelMatches(#"a*"#, in: "")
+
+    // Substrings are searched within their bounds.
+    let middle = input.dropFirst(3).dropLast(5)
+    let regex = try Regex(#"(?m)b$|^a"#)
+    XCTAssertEqual(
+      middle.ranges(of: regex, chunkCount: 8, concurrentPerform: reversePerform),
+      middle.ranges(of: regex))
+  }
+
+  func testChunkBoundaries() {
+    let input = String(repeating: "abcdefg\n", count: 4096)
+    let bounds = input.startIndex..<input.endIndex
+    let boundaries = Executor<Substring>._chunkBoundaries(
+      input, bounds, chunkCount: 4)
+    XCTAssertEqual(boundaries.count, 5)
+    XCTAssertEqual(boundaries.first, input.startIndex)
+    XCTAssertEqual(boundaries.last, input.endIndex)
+    for i in boundaries.dropFirst().dropLast() {
+      XCTAssertEqual(input[input.index(before: i)], "\n")
+    }
+
+    // No more chunks than the input is worth splitting into.
+    XCTAssertEqual(
+      Executor<Substring>._chunkBoundaries(
+        "short", "short".startIndex..<"short".endIndex, chunkCount: 4).count,
+      2)
+  }
+}
@@ -0,0 +1,96 @@
+//===----------------------------------------------------------------------===//
+//
+// This source file is part of the Swift.org open source project
+//
+// Copyright (c) 2025 Apple Inc. and the Swift project authors
+// Licensed under Apache License v2.0 with Runtime Library Exception
+//
+// See https://swift.org/LICENSE.txt for license information
+//
+//===----------------------------------------------------------------------===//
+
+@testable import _StringProcessing
+import Foundation
+import XCTest
+
+@available(SwiftStdlib 6.1, *)
+class ProfileTests: XCTestCase {
+  func testProfileMatchesSame() throws {
+    let regex = try Regex(#"(\w+)=(\d+);"#)
+    let input = "a=1; bb=22; ccc=x; dddd=4444;"
+    let profile = RegexProfile()
+    let profiled = regex.profiling(into: profile)
+
+    XCTAssertEqual(
+      input.matches(of: profiled).map(\.range),
+      input.matches(of: regex).map(\.range))
+    XCTAssertEqual(
+      input.firstMatch(of: profiled)?.range,
+      input.firstMatch(of: regex)?.range)
+
+    let report = profile.report()
+    XCTAssertEqual(report.pattern, #"(\w+)=(\d+);"#)
+    XCTAssertGreaterThan(report.steps, 0)
+    XCTAssertGreaterThan(report.matchAttempts, 0)
+    XCTAssertEqual(report.steps, report.instructions.map(\.steps).reduce(0, +))
+  }
+
+  func testRegions() throws {
+    let pattern = #"key: (.*?);"#
+    let profile = RegexProfile()
+    let regex = try Regex(pattern).profiling(into: profile)
+    _ = "key: some long value; key: other;".matches(of: regex)
+
+    let report = profile.report()
+    XCTAssertFalse(report.regions.isEmpty)
+    for region in report.regions {
+      let characters = Array(pattern)
+      XCTAssertEqual(region.source, String(characters[region.columns]))
+    }
+    // The lazy quantification's steps are counted in its group too.
+    let quantification = try XCTUnwrap(
+      report.regions.first { $0.source == ".*?" })
+    let group = try XCTUnwrap(
+      report.regions.first { $0.source == "(.*?)" })
+    XCTAssertEqual(quantification.columns, 6..<9)
+    XCTAssertGreaterThan(quantification.steps, 0)
+    XCTAssertGreaterThan(quantification.maxSavePoints, 0)
+    XCTAssertGreaterThanOrEqual(group.steps, quantification.steps)
+    XCTAssertTrue(report.description.contains("`.*?` at columns 7-9"))
+  }
+
+  func testBacktracks() throws {
+    let profile = RegexProfile()
+    let regex = try Regex(#"(?:a|ab)c"#).profiling(into: profile)
+    XCTAssertNotNil(try regex.wholeMatch(in: "abc"))
+
+    // Matching `c` fails after the first alternative, and backtracks to
+    // try the second.
+    let report = profile.report()
+    XCTAssertGreaterThan(report.backtracks, 0)
+    let literal = try XCTUnwrap(report.regions.first { $0.source == "c" })
+    XCTAssertGreaterThan(literal.backtracks, 0)
+  }
+
+  func testResetAndExport() throws {
+    let profile = RegexProfile()
+    let regex = try Regex(#"\d+"#).profiling(into: profile)
+    _ = "1 22 333".matches(of: regex)
+    XCTAssertGreaterThan(profile.report().steps, 0)
+
+    let data = try JSONEncoder().encode(profile.report())
+    let decoded = try JSONDecoder().decode(
+      RegexProfile.Report.self, from: data)
+    XCTAssertEqual(decoded, profile.report())
+
+    profile.reset()
+    XCTAssertEqual(profile.report().steps, 0)
+    XCTAssertEqual(profile.report().matchAttempts, 0)
+
+    // Profiling another regex replaces the instructions.
+    let other = try Regex(#"[a-z]+"#).profiling(into: profile)
+    _ = "abc".firstMatch(of: other)
+    XCTAssertEqual(profile.report().pattern, #"[a-z]+"#)
+    XCTAssertGreaterThan(profile.report().steps, 0)
+  }
+}
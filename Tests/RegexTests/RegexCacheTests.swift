@@ -0,0 +1,100 @@
+//===----------------------------------------------------------------------===//
+//
+// This source file is part of the Swift.org open source project
+//
+// Copyright (c) 2025 Apple Inc. and the Swift project authors
+// Licensed under Apache License v2.0 with Runtime Library Exception
+//
+// See https://swift.org/LICENSE.txt for license information
+//
+//===----------------------------------------------------------------------===//
+
+@testable @_spi(RegexBenchmark) import _StringProcessing
+import XCTest
+
+@available(SwiftStdlib 6.1, *)
+class RegexCacheTests: XCTestCase {
+  override func setUp() {
+    RegexCache.removeAll()
+    RegexCache.resetStatistics()
+  }
+
+  override func tearDown() {
+    RegexCache.capacity = 256
+  }
+
+  func testSharedPrograms() throws {
+    let a = try Regex(#"(\w+)@(\w+)"#)
+    let b = try Regex(#"(\w+)@(\w+)"#)
+    XCTAssert(a.program === b.program)
+    XCTAssertEqual(
+      RegexCache.statistics,
+      .init(hits: 1, misses: 1, evictions: 0, count: 1))
+
+    // The first match compiles the program for both.
+    XCTAssertNotNil(try a.firstMatch(in: "me@example"))
+    XCTAssertNotNil(try b.firstMatch(in: "me@example"))
+
+    // Different output types, options, and patterns don't share programs.
+    let typed = try Regex(
+      #"(\w+)@(\w+)"#, as: (Substring, Substring, Substring).self)
+    XCTAssert(typed.program !== a.program)
+    XCTAssert(try Regex(#"(\w+)@(\w+)"#).ignoresCase().program !== a.program)
+    XCTAssert(try Regex(#"(\w+)@(\w*)"#).program !== a.program)
+    XCTAssertEqual(RegexCache.statistics.count, 4)
+  }
+
+  func testOptions() throws {
+    let a = try Regex("abc").ignoresCase().matchingSemantics(.unicodeScalar)
+    let b = try Regex("abc").ignoresCase().matchingSemantics(.unicodeScalar)
+    XCTAssert(a.program === b.program)
+    XCTAssertEqual(try a.wholeMatch(in: "ABC")?.range, try b.wholeMatch(in: "ABC")?.range)
+
+    // Turning an option off is a different key from turning it on.
+    let c = try Regex("abc").ignoresCase(false)
+    XCTAssert(try Regex("abc").ignoresCase().program !== c.program)
+    XCTAssertNil(try c.wholeMatch(in: "ABC"))
+  }
+
+  func testTypedOutput() throws {
+    typealias Output = (Substring, Substring)
+    let a = try Regex("a(b)", as: Output.self)
+    let b = try Regex("a(b)", as: Output.self)
+    XCTAssert(a.program === b.program)
+    XCTAssertEqual(try b.wholeMatch(in: "ab")?.output.1, "b")
+
+    // Patterns that don't match the output type aren't cached.
+    XCTAssertThrowsError(try Regex("ab", as: Output.self))
+    XCTAssertThrowsError(try Regex("ab", as: Output.self))
+    XCTAssertEqual(RegexCache.statistics.count, 1)
+  }
+
+  func testEviction() throws {
+    RegexCache.capacity = 2
+    let a = try Regex("a")
+    _ = try Regex("b")
+    _ = try Regex("a")
+    _ = try Regex("c")  // Evicts "b", the least recently used.
+    XCTAssertEqual(
+      RegexCache.statistics,
+      .init(hits: 1, misses: 3, evictions: 1, count: 2))
+
+    XCTAssert(try Regex("a").program === a.program)
+    _ = try Regex("b")
+    XCTAssertEqual(RegexCache.statistics.misses, 4)
+
+    RegexCache.capacity = 0
+    XCTAssertEqual(RegexCache.statistics.count, 0)
+    XCTAssert(try Regex("a").program !== Regex("a").program)
+  }
+
+  func testModifyingCachedRegex() throws {
+    var regex = try Regex("a+")
+    XCTAssert(regex._forceAction(.addOptions(.disableOptimizations)))
+    XCTAssert(try Regex("a+").program !== regex.program)
+
+    let limited = try Regex("a+").matchingStepLimit(1)
+    XCTAssert(try Regex("a+").program !== limited.program)
+    XCTAssertNotNil(try Regex("a+").firstMatch(in: "aaa"))
+  }
+}
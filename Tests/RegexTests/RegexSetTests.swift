@@ -0,0 +1,98 @@
+//===----------------------------------------------------------------------===//
+//
+// This source file is part of the Swift.org open source project
+//
+// Copyright (c) 2025 Apple Inc. and the Swift project authors
+// Licensed under Apache License v2.0 with Runtime Library Exception
+//
+// See https://swift.org/LICENSE.txt for license information
+//
+//===----------------------------------------------------------------------===//
+
+@testable import _StringProcessing
+import XCTest
+
+@available(SwiftStdlib 6.1, *)
+class RegexSetTests: XCTestCase {
+  func testMultiLiteralSearcher() {
+    let literals = ["he", "she", "his", "hers", "\u{E9}t\u{E9}"]
+    let searcher = MultiLiteralSearcher(literals.map { Array($0.utf8) })
+
+    func found(in input: String) -> [String] {
+      var indices = Set<Int>()
+      searcher.forEachLiteral(in: input, input.startIndex..<input.endIndex) {
+        indices.insert($0)
+        return true
+      }
+      return indices.sorted().map { literals[$0] }
+    }
+
+    XCTAssertEqual(found(in: "ushers"), ["he", "she", "hers"])
+    XCTAssertEqual(found(in: "this"), ["his"])
+    XCTAssertEqual(found(in: "h e s"), [])
+    XCTAssertEqual(found(in: "l'\u{E9}t\u{E9}"), ["\u{E9}t\u{E9}"])
+    XCTAssertEqual(found(in: ""), [])
+
+    // Only the bytes within the range are searched.
+    let input = "she said"
+    var indices: [Int] = []
+    searcher.forEachLiteral(
+      in: input, input.index(after: input.startIndex)..<input.endIndex
+    ) {
+      indices.append($0)
+      return true
+    }
+    XCTAssertEqual(indices, [0])
+  }
+
+  func testMatchingIndices() throws {
+    let patterns = [
+      #"ERROR \w+"#,
+      #"timeout after \d+ms"#,
+      #"user=(\w+)"#,
+      #"\d{3}-\d{4}"#,      // no required literal
+      #"(?i)warning"#,       // no required literal
+      #"^GET /"#,
+    ]
+    let set = try RegexSet(patterns)
+    XCTAssertEqual(set.count, patterns.count)
+
+    let inputs = [
+      "ERROR net: timeout after 300ms",
+      "user=alice called 555-1234",
+      "WARNING: disk almost full",
+      "GET /index.html user=bob",
+      "POST /GET / ERROR",
+      "",
+    ]
+    for input in inputs {
+      let expected = try patterns.indices.filter {
+        try Regex(patterns[$0]).firstMatch(in: input) != nil
+      }
+      XCTAssertEqual(try set.matchingIndices(in: input), expected, input)
+
+      let expectedRanges = try expected.map {
+        try Regex(patterns[$0]).firstMatch(in: input)!.range
+      }
+      let matches = try set.firstMatches(in: input)
+      XCTAssertEqual(matches.map(\.index), expected, input)
+      XCTAssertEqual(matches.map(\.range), expectedRanges, input)
+    }
+
+    // Searching a substring doesn't look outside of its bounds.
+    let line = "ERROR net: user=carol"
+    let tail = line[line.firstIndex(of: ":")!...]
+    XCTAssertEqual(try set.matchingIndices(in: tail), [2])
+  }
+
+  func testRegexSetFromRegexes() throws {
+    let set = RegexSet([
+      try Regex(#"a+b"#),
+      try Regex(#"c"#),
+    ])
+    XCTAssertEqual(try set.matchingIndices(in: "xxaab"), [0])
+    XCTAssertEqual(try set.matchingIndices(in: "cab"), [0, 1])
+    XCTAssertEqual(try set.matchingIndices(in: "xyz"), [])
+    XCTAssertThrowsError(try RegexSet(["a(", "b"]))
+  }
+}
@@ -0,0 +1,117 @@
+//===----------------------------------------------------------------------===//
+//
+// This source file is part of the Swift.org open source project
+//
+// Copyright (c) 2025 Apple Inc. and the Swift project authors
+// Licensed under Apache License v2.0 with Runtime Library Exception
+//
+// See https://swift.org/LICENSE.txt for license information
+//
+//===----------------------------------------------------------------------===//
+
+@testable import _StringProcessing
+import XCTest
+
+class ScalarRunTests: XCTestCase {
+  /// Checks that `pattern` matches the same in `input` as it does without
+  /// optimizations, which match properties one consume function at a time.
+  func expectSameMatches(
+    _ pattern: String,
+    in input: String,
+    file: StaticString = #filePath,
+    line: UInt = #line
+  ) throws {
+    for semantics in [RegexSemanticLevel.graphemeCluster, .unicodeScalar] {
+      let regex = try Regex(pattern).matchingSemantics(semantics)
+      var backtracking = try Regex(pattern).matchingSemantics(semantics)
+      XCTAssert(backtracking._forceAction(.addOptions(.disableOptimizations)))
+
+      XCTAssertEqual(
+        input.matches(of: regex).map(\.range),
+        input.matches(of: backtracking).map(\.range),
+        "matches of \(pattern) in \(input) (\(semantics))",
+        file: file, line: line)
+      XCTAssertEqual(
+        try regex.wholeMatch(in: input)?.range,
+        try backtracking.wholeMatch(in: input)?.range,
+        "wholeMatch of \(pattern) in \(input) (\(semantics))",
+        file: file, line: line)
+
+      // Search bounds that end partway through a run.
+      let prefix = input.dropLast(3)
+      XCTAssertEqual(
+        prefix.matches(of: regex).map(\.range),
+        prefix.matches(of: backtracking).map(\.range),
+        "matches of \(pattern) in \(prefix) (\(semantics))",
+        file: file, line: line)
+    }
+  }
+
+  func testScalarRuns() throws {
+    let inputs = [
+      "",
+      "abc",
+      "Hello, w\u{F6}rld! 123 \u{3B1}\u{3B2}\u{3B3} caf\u{E9} cafe\u{301}",
+      "\u{41F}\u{440}\u{438}\u{432}\u{435}\u{442} \u{43C}\u{438}\u{440}_42",
+      "\u{6F22}\u{5B57}\u{304B}\u{306A}\u{30AB}\u{30CA}\u{30FC}\u{3002}abc\u{FF11}",
+      "\u{1F1FA}\u{1F1F8}\u{1F600} x\u{20AC}5\u{A0}\u{2028}\u{10400}\u{10428}",
+      String(repeating: "word ", count: 40) + "\u{E9}" + String(repeating: "z", count: 33),
+    ]
+    let patterns = [
+      #"\p{L}+"#,
+      #"\p{L}*"#,
+      #"\P{L}+"#,
+      #"\p{Lu}\p{Ll}+"#,
+      #"\p{Nd}{2,}"#,
+      #"\p{L}{2,3}"#,
+      #"\p{L}++\p{N}"#,
+      #"[\p{Nd}\p{Pc}]+"#,
+      #"[^\p{L}\p{Zs}]+"#,
+      #"[\p{L}\P{Lu}]+"#,
+      #"\p{Han}+"#,
+      #"\P{Han}+"#,
+      #"[\p{Cyrillic}\p{Greek}]+"#,
+      #"[\p{Latin}\P{Han}]+"#,
+      #"\p{scx=Hira}+"#,
+      #"[^\p{scx=Hira}\p{scx=Kana}]+"#,
+      #"\p{Assigned}+"#,
+      #"\p{L}+?\p{Ll}"#,
+      #"(\p{L}+)\s\1"#,
+    ]
+    for pattern in patterns {
+      for input in inputs {
+        try expectSameMatches(pattern, in: input)
+      }
+    }
+  }
+
+  func testScalarRunSet() throws {
+    func set(_ pattern: String) throws -> ScalarRunSet? {
+      let regex = try Regex(pattern)
+      let program = regex.program.loweredProgram
+      return program.registers.scalarRunSets.first
+    }
+    XCTAssertNotNil(try set(#"\p{L}+"#))
+    XCTAssertNotNil(try set(#"[\p{Nd}\p{Pc}]*"#))
+    XCTAssertNotNil(try set(#"[^\p{Greek}]{2,}"#))
+    // Properties that look at more than a single scalar aren't runs.
+    XCTAssertNil(try set(#"\p{ASCII}+"#))
+    XCTAssertNil(try set(#"[\p{L}a]+"#))
+    XCTAssertNil(try set(#"\p{Alphabetic}+"#))
+
+    // Script sets decide every scalar; other sets only the ones below U+0800.
+    let han = try XCTUnwrap(set(#"\p{Han}+"#))
+    XCTAssertEqual(
+      han.words[ScalarRunSet.flagsWord], ScalarRunSet.hasScriptsFlag)
+    let letters = try XCTUnwrap(set(#"\p{L}+"#))
+    XCTAssertEqual(letters.words[ScalarRunSet.flagsWord], 0)
+
+    let input = "\u{6F22}\u{5B57}\u{6F22}a"
+    XCTAssertEqual(
+      input._scalarRunEnd(han, from: input.startIndex, limitedBy: input.endIndex),
+      input.unicodeScalars.index(input.startIndex, offsetBy: 3))
+    XCTAssertEqual(
+      input._scalarRunEnd(letters, from: input.startIndex, limitedBy: input.endIndex),
+      input.endIndex)
+  }
+}
@@ -0,0 +1,153 @@
+//===----------------------------------------------------------------------===//
+//
+// This source file is part of the Swift.org open source project
+//
+// Copyright (c) 2025 Apple Inc. and the Swift project authors
+// Licensed under Apache License v2.0 with Runtime Library Exception
+//
+// See https://swift.org/LICENSE.txt for license information
+//
+//===----------------------------------------------------------------------===//
+
+@testable import _StringProcessing
+import XCTest
+
+@available(SwiftStdlib 6.1, *)
+class StreamMatcherTests: XCTestCase {
+  /// Feeds `input` to a stream matcher in chunks of `chunkSize` bytes and
+  /// returns the matched offsets and text.
+  func streamMatches(
+    _ pattern: String,
+    in input: String,
+    chunkSize: Int,
+    maximumMatchLength: Int = 64
+  ) throws -> [(Range<Int>, String)] {
+    var matcher = RegexStreamMatcher(
+      try Regex(pattern), maximumMatchLength: maximumMatchLength)
+    let bytes = Array(input.utf8)
+    var matches: [RegexStreamMatcher<AnyRegexOutput>.Match] = []
+    for start in stride(from: 0, to: bytes.count, by: chunkSize) {
+      let chunk = bytes[start..<min(start + chunkSize, bytes.count)]
+      matches += try matcher.feed(chunk)
+    }
+    matches += try matcher.finish()
+    return matches.map {
+      ($0.utf8Offsets, String($0.match.output[0].substring!))
+    }
+  }
+
+  func expectStreamMatches(
+    _ pattern: String,
+    in input: String,
+    file: StaticString = #filePath,
+    line: UInt = #line
+  ) throws {
+    let expected = try input.matches(of: Regex(pattern)).map { match in
+      let start = input.utf8.distance(
+        from: input.startIndex, to: match.range.lowerBound)
+      let end = input.utf8.distance(
+        from: input.startIndex, to: match.range.upperBound)
+      return (start..<end, String(input[match.range]))
+    }
+    for chunkSize in [1, 2, 3, 5, 16, 1000] {
+      let actual = try streamMatches(pattern, in: input, chunkSize: chunkSize)
+      XCTAssertEqual(
+        actual.map(\.0), expected.map(\.0),
+        "\(pattern) in chunks of \(chunkSize)", file: file, line: line)
+      XCTAssertEqual(
+        actual.map(\.1), expected.map(\.1),
+        "\(pattern) in chunks of \(chunkSize)", file: file, line: line)
+    }
+  }
+
+  func testStreamMatches() throws {
+    let log = """
+      12:00:01 INFO start
+      12:00:02 ERROR disk full
+      12:00:03 WARN caf\u{E9} ferm\u{E9}
+      12:00:04 ERROR net down\r
+      12:00:05 INFO \u{1F1FA}\u{1F1F8} e\u{301}t\u{E9}
+      """
+    try expectStreamMatches(#"\d+"#, in: log)
+    try expectStreamMatches(#"ERROR [^\n]+"#, in: log)
+    try expectStreamMatches(#"(?m)^\S+ INFO .*$"#, in: log)
+    try expectStreamMatches(#"\b\w+\b"#, in: log)
+    try expectStreamMatches(#"\u{E9}"#, in: log)
+    try expectStreamMatches(#"."#, in: log)
+    try expectStreamMatches(#"\R"#, in: log)
+    try expectStreamMatches(#"(?<=ERROR )\w+"#, in: log)
+    try expectStreamMatches(#"x*"#, in: "axxb")
+    // An earlier start can need input after a later one has matched.
+    try expectStreamMatches(#"a.*z|b"#, in: "axbyyz")
+    try expectStreamMatches(#"\z"#, in: log)
+    try expectStreamMatches(#"nothing"#, in: log)
+  }
+
+  func testStreamMatchesInBuffer() throws {
+    let input = String(
+      repeating: "12:00:02 ERROR caf\u{E9} \u{1F1FA}\u{1F1F8} down\r\n", count: 20)
+    let pattern = #"ERROR [^\r\n]+"#
+    let expected = try streamMatches(pattern, in: input, chunkSize: 1000)
+    XCTAssertEqual(expected.count, 20)
+
+    for chunkLength in [1, 2, 7, 64, 1 << 16] {
+      var matcher = RegexStreamMatcher(
+        try Regex(pattern), maximumMatchLength: 64)
+      var actual: [(Range<Int>, String)] = []
+      try Array(input.utf8).withUnsafeBytes { bytes in
+        try matcher.forEachMatch(in: bytes, chunkLength: chunkLength) {
+          actual.append(($0.utf8Offsets, String($0.match.output[0].substring!)))
+        }
+      }
+      XCTAssertEqual(
+        actual.map(\.0), expected.map(\.0), "chunks of \(chunkLength)")
+      XCTAssertEqual(
+        actual.map(\.1), expected.map(\.1), "chunks of \(chunkLength)")
+    }
+  }
+
+  func testStreamMatchLength() throws {
+    // Matches are limited to the maximum match length.
+    let input = String(repeating: "a", count: 10) + "b" + String(repeating: "a", count: 3)
+    let matches = try streamMatches(
+      #"a+"#, in: input, chunkSize: 4, maximumMatchLength: 4)
+    XCTAssertEqual(matches.map(\.0), [0..<4, 4..<8, 8..<10, 11..<14])
+
+    // Only a bounded amount of input is retained.
+    var matcher = RegexStreamMatcher(
+      try Regex(#"needle"#), maximumMatchLength: 16)
+    let chunk = Array(String(repeating: "hay ", count: 64).utf8)
+    for _ in 0..<100 {
+      XCTAssertEqual(try matcher.feed(chunk).count, 0)
+      XCTAssertLessThanOrEqual(matcher.buffer.utf8.count, 4 * chunk.count)
+    }
+    XCTAssertEqual(try matcher.feed(Array("needle".utf8)).count, 0)
+    XCTAssertEqual(
+      try matcher.finish().map(\.utf8Offsets), [(100 * chunk.count)..<(100 * chunk.count + 6)])
+  }
+
+  func testStreamMatchAttempts() throws {
+    // Each start is tried about once, however small the chunks are.
+    let profile = RegexProfile()
+    let regex = try Regex(#"[0-9]+x"#).profiling(into: profile)
+    var matcher = RegexStreamMatcher(regex, maximumMatchLength: 64)
+    let input = Array(String(repeating: "hay 42 ", count: 150).utf8)
+    for byte in input {
+      XCTAssertEqual(try matcher.feed(CollectionOfOne(byte)).count, 0)
+    }
+    XCTAssertEqual(try matcher.finish().count, 0)
+    XCTAssertLessThan(profile.report().matchAttempts, 2 * input.count)
+  }
+
+  func testIncompleteScalars() {
+    typealias M = RegexStreamMatcher<Substring>
+    XCTAssertEqual(M._completeScalarsLength([]), 0)
+    XCTAssertEqual(M._completeScalarsLength([0x61]), 1)
+    XCTAssertEqual(M._completeScalarsLength([0x61, 0xE2]), 1)
+    XCTAssertEqual(M._completeScalarsLength([0x61, 0xE2, 0x82]), 1)
+    XCTAssertEqual(M._completeScalarsLength([0x61, 0xE2, 0x82, 0xAC]), 4)
+    XCTAssertEqual(M._completeScalarsLength([0xF0, 0x9F, 0x98]), 0)
+    // Stray continuation bytes are left for decoding to repair.
+    XCTAssertEqual(M._completeScalarsLength([0x80, 0x80, 0x80, 0x80, 0x80]), 5)
+  }
+}
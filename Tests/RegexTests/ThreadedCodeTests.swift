@@ -0,0 +1,129 @@
+//===----------------------------------------------------------------------===//
+//
+// This source file is part of the Swift.org open source project
+//
+// Copyright (c) 2025 Apple Inc. and the Swift project authors
+// Licensed under Apache License v2.0 with Runtime Library Exception
+//
+// See https://swift.org/LICENSE.txt for license information
+//
+//===----------------------------------------------------------------------===//
+
+@testable @_spi(RegexBenchmark) import _StringProcessing
+import RegexBuilder
+import XCTest
+
+@available(SwiftStdlib 6.1, *)
+class ThreadedCodeTests: XCTestCase {
+  func threaded<Output>(_ regex: Regex<Output>) -> Regex<Output> {
+    var regex = regex
+    XCTAssert(regex._forceAction(.addOptions(.enableThreadedCode)))
+    return regex
+  }
+
+  func testThreadedCodeIsOptional() throws {
+    let regex = try Regex(#"(\w+)@(\w+)"#)
+    XCTAssertNil(regex.program.loweredProgram.threadedCode)
+
+    let program = threaded(regex).program.loweredProgram
+    XCTAssertEqual(
+      program.threadedCode?.steps.count, program.instructions.count)
+
+    // Tracing is only done by the interpreter.
+    var traced = threaded(regex)
+    XCTAssert(traced._forceAction(.addOptions(.enableTracing)))
+    XCTAssertNil(traced.program.loweredProgram.threadedCode)
+  }
+
+  /// Checks that `pattern` matches the same in `input` when it's run as
+  /// threaded code as when it's interpreted.
+  func expectSameMatches(
+    _ pattern: String,
+    in input: String,
+    file: StaticString = #filePath,
+    line: UInt = #line
+  ) throws {
+    for semanticLevel in [RegexSemanticLevel.graphemeCluster, .unicodeScalar] {
+      let regex = try Regex(pattern).matchingSemantics(semanticLevel)
+      let threadedRegex = threaded(regex)
+
+      func output(_ match: Regex<AnyRegexOutput>.Match?) -> [String?]? {
+        match?.output.map { $0.substring.map(String.init) }
+      }
+      let message = "\(pattern) in \(input.debugDescription)"
+      XCTAssertEqual(
+        output(try threadedRegex.wholeMatch(in: input)),
+        output(try regex.wholeMatch(in: input)),
+        message, file: file, line: line)
+      XCTAssertEqual(
+        output(try threadedRegex.prefixMatch(in: input)),
+        output(try regex.prefixMatch(in: input)),
+        message, file: file, line: line)
+      XCTAssertEqual(
+        input.matches(of: threadedRegex).map { output($0) },
+        input.matches(of: regex).map { output($0) },
+        message, file: file, line: line)
+    }
+  }
+
+  func testThreadedCodeMatches() throws {
+    let inputs = [
+      "",
+      "key=42 KEY=7 k\u{212A}y=1",
+      "caf\u{E9} cafe\u{301} CAF\u{C9}\r\nline two",
+      "a1b2c3x a1b2c3d4e5y aab",
+      "\u{1F468}\u{200D}\u{1F469} \u{1F1FA}\u{1F1F8} !",
+    ]
+    let patterns = [
+      #"(\w+)=(\d+)"#,
+      #"(?i)key=(?<value>\d+)?"#,
+      #"(?i)caf\u{E9}"#,
+      #"caf."#,
+      #"^.*$"#,
+      #"(?m)^(.+)$"#,
+      #"\b\w+\b"#,
+      #"[a-c]+\d"#,
+      #"(?:(\w)(\d)){2,4}x"#,
+      #"(a|ab)(c|bcd)?(d*)"#,
+      #"(\w)\1"#,
+      #"(?>a|aa)+b"#,
+      #"\w+(?=\d)"#,
+      #"\s+|\X"#,
+      #"\r\n|\n"#,
+    ]
+    for input in inputs {
+      for pattern in patterns {
+        try expectSameMatches(pattern, in: input)
+      }
+    }
+  }
+
+  func testThreadedCodeWithTransforms() throws {
+    let regex = Regex {
+      TryCapture {
+        OneOrMore(.digit)
+      } transform: { Int($0).flatMap { value in value < 100 ? value : nil } }
+      "!"
+    }
+    let threadedRegex = threaded(regex)
+    XCTAssertEqual(
+      try threadedRegex.firstMatch(in: "500! 42!")?.output.1,
+      try regex.firstMatch(in: "500! 42!")?.output.1)
+    XCTAssertEqual(try threadedRegex.firstMatch(in: "500! 42!")?.output.1, 42)
+  }
+
+  func testThreadedCodeStepLimit() throws {
+    let regex = threaded(try Regex(#"(a|aa)+\1b"#)).matchingStepLimit(1_000)
+    XCTAssertThrowsError(
+      try regex.firstMatch(in: String(repeating: "a", count: 30) + "!b"))
+    XCTAssertNotNil(try regex.wholeMatch(in: "aaaab"))
+  }
+
+  func testThreadedCodeProfile() throws {
+    // Profiled searches are run by the interpreter, which counts their steps.
+    let profile = RegexProfile()
+    let regex = threaded(try Regex(#"(a|aa)+b"#)).profiling(into: profile)
+    XCTAssertNotNil(try regex.firstMatch(in: "aaaab"))
+    XCTAssertGreaterThan(profile.report().steps, 0)
+  }
+}
@@ -0,0 +1,91 @@
+//===----------------------------------------------------------------------===//
+//
+// This source file is part of the Swift.org open source project
+//
+// Copyright (c) 2025 Apple Inc. and the Swift project authors
+// Licensed under Apache License v2.0 with Runtime Library Exception
+//
+// See https://swift.org/LICENSE.txt for license information
+//
+//===----------------------------------------------------------------------===//
+
+@testable import _StringProcessing
+@_spi(_Unicode) import Swift
+import TestSupport
+import XCTest
+
+class WordBoundaryTests: XCTestCase {
+  let inputs = [
+    "The quick brown fox",
+    "don't stop: a.b, 3.14 and 1,000,000; x_1 _y 'q' \"z\"",
+    "a:b a: :b 1.a a.1 1'2 a''b a..b 1,,2 .5 5. ,",
+    "  two  spaces\tand\ttabs   ",
+    "lines\r\nwith\rall\nkinds\u{B}of\u{C}breaks\r\n\r\n",
+    "a.\u{301}b cafe\u{301}. e\u{301}.e\u{301} 1\u{200D}2",
+    "ASCII then 日本語 and Ελληνικά, 👍🏽 a👍 _👍",
+    "",
+    ".",
+    "a",
+  ]
+
+  func testASCIIFastPath() throws {
+    guard ensureNewStdlib() else { return }
+    // Check the fast path from every position that the stdlib finds to be a
+    // boundary, as the processor uses it.
+    for input in inputs {
+      var i = input.startIndex
+      while i < input.endIndex {
+        let expected = input._wordIndex(after: i)
+        if let next = input._asciiWordIndex(after: i) {
+          XCTAssertEqual(
+            next, expected,
+            "After offset \(input.utf8.distance(from: input.startIndex, to: i)) in \(input.debugDescription)")
+        }
+        i = expected
+      }
+    }
+  }
+
+  /// Returns the UTF-8 offsets of the word boundaries in `input`, as found
+  /// by the stdlib.
+  func boundaryOffsets(_ input: String) -> [Int] {
+    var result: [Int] = []
+    var i = input.startIndex
+    while i < input.endIndex {
+      result.append(input.utf8.distance(from: input.startIndex, to: i))
+      i = input._wordIndex(after: i)
+    }
+    result.append(input.utf8.count)
+    return result
+  }
+
+  func testBoundaryAssertions() throws {
+    guard ensureNewStdlib() else { return }
+    let boundary = try Regex(#"\b"#)
+    for input in inputs {
+      XCTAssertEqual(
+        input.matches(of: boundary).map {
+          input.utf8.distance(from: input.startIndex, to: $0.range.lowerBound)
+        },
+        boundaryOffsets(input),
+        input.debugDescription)
+
+      // Boundaries in a substring are found from its start.
+      let substring = input.dropFirst(2)
+      XCTAssertEqual(
+        substring.matches(of: boundary).map {
+          substring.utf8.distance(
+            from: substring.startIndex, to: $0.range.lowerBound)
+        },
+        boundaryOffsets(String(substring)),
+        substring.debugDescription)
+    }
+
+    // Backtracking tests the same positions many times.
+    let sentence = String(repeating: "one two, three. ", count: 50)
+    XCTAssertEqual(
+      sentence.matches(of: try Regex(#"\b\w+\b(?=\W+\b\w+\b\.)"#)).count,
+      50)
+    XCTAssertNil(try Regex(#"(?:\b\w+\b\W*)+!"#).firstMatch(in: sentence))
+  }
+}
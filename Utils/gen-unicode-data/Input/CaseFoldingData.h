@@ -0,0 +1,19 @@
+//===----------------------------------------------------------------------===//
+//
+// This source file is part of the Swift.org open source project
+//
+// Copyright (c) 2025 Apple Inc. and the Swift project authors
+// Licensed under Apache License v2.0 with Runtime Library Exception
+//
+// See https://swift.org/LICENSE.txt for license information
+//
+//===----------------------------------------------------------------------===//
+
+// This was auto-generated by utils/gen-unicode-data/GenCaseFolding,
+// please do not edit this file yourself!
+
+#ifndef CASE_FOLDING_DATA_H
+#define CASE_FOLDING_DATA_H
+
+#include "stdint.h"
+
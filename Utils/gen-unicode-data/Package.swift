@@ -10,6 +10,10 @@ let package = Package(
       name: "GenUtils",
       dependencies: []
     ),
+    .executableTarget(
+      name: "GenCaseFolding",
+      dependencies: ["GenUtils"]
+    ),
     .executableTarget(
       name: "GenGraphemeBreakProperty",
       dependencies: ["GenUtils"]
@@ -21,6 +25,10 @@ let package = Package(
     .executableTarget(
       name: "GenScalarProps",
       dependencies: ["GenUtils"]
+    ),
+    .executableTarget(
+      name: "GenScripts",
+      dependencies: ["GenUtils"]
     )
   ]
 )
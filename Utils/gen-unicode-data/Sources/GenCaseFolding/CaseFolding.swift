@@ -0,0 +1,218 @@
+//===----------------------------------------------------------------------===//
+//
+// This source file is part of the Swift.org open source project
+//
+// Copyright (c) 2025 Apple Inc. and the Swift project authors
+// Licensed under Apache License v2.0 with Runtime Library Exception
+//
+// See https://swift.org/LICENSE.txt for license information
+//
+//===----------------------------------------------------------------------===//
+
+import GenUtils
+
+// The most scalars that a full case folding maps a scalar to.
+let maxFullFoldingLength = 3
+
+// Parses the scalar or scalar range in the first field of a UCD data line.
+func parseScalars(_ field: Substring) -> ClosedRange<UInt32> {
+  let filteredScalars = field.filter { !$0.isWhitespace }
+
+  if filteredScalars.contains(".") {
+    let range = filteredScalars.split(separator: ".")
+
+    return UInt32(range[0], radix: 16)! ... UInt32(range[1], radix: 16)!
+  } else {
+    let scalar = UInt32(filteredScalars, radix: 16)!
+
+    return scalar ... scalar
+  }
+}
+
+// Returns the simple and full case foldings of the scalars that change when
+// case folded.
+//
+// Each line in CaseFolding.txt is formatted like the following:
+//
+//     0041; C; 0061; # LATIN CAPITAL LETTER A
+//     00DF; F; 0073 0073; # LATIN SMALL LETTER SHARP S
+//     1E9E; S; 00DF; # LATIN CAPITAL LETTER SHARP S
+//
+// Simple case folding uses the mappings with status C (common) and S
+// (simple), and full case folding uses those with status C and F (full).
+// Only the full foldings that differ from the simple ones are returned. The
+// Turkic mappings, with status T, aren't used.
+func getCaseFoldings(
+  from data: String
+) -> (simple: [UInt32: UInt32], full: [UInt32: [UInt32]]) {
+  var simple: [UInt32: UInt32] = [:]
+  var full: [UInt32: [UInt32]] = [:]
+
+  for line in data.split(separator: "\n") {
+    guard !line.hasPrefix("#") else {
+      continue
+    }
+
+    let components = line.split(separator: ";")
+    guard components.count >= 3 else {
+      continue
+    }
+
+    let scalar = UInt32(components[0], radix: 16)!
+    let status = components[1].filter { !$0.isWhitespace }
+    let mapping = components[2].split(separator: " ").map {
+      UInt32($0, radix: 16)!
+    }
+
+    switch status {
+    case "C", "S":
+      simple[scalar] = mapping[0]
+    case "F":
+      precondition(mapping.count <= maxFullFoldingLength)
+      full[scalar] = mapping
+    default:
+      continue
+    }
+  }
+
+  return (simple, full)
+}
+
+// Returns the scalars that take part in canonical normalization: those with
+// a canonical decomposition, a nonzero canonical combining class, or that may
+// combine with the scalar before them under NFC.
+func getNormalizationSensitiveScalars(
+  derivedNormalizationProps: String,
+  unicodeData: String
+) -> Set<UInt32> {
+  var result: Set<UInt32> = []
+
+  for line in derivedNormalizationProps.split(separator: "\n") {
+    guard !line.hasPrefix("#") else {
+      continue
+    }
+
+    let info = line.split(separator: "#")
+    let components = info[0].split(separator: ";")
+    guard components.count == 3 else {
+      continue
+    }
+
+    let property = components[1].filter { !$0.isWhitespace }
+    guard property == "NFD_QC" || property == "NFC_QC" else {
+      continue
+    }
+
+    result.formUnion(parseScalars(components[0]))
+  }
+
+  for line in unicodeData.split(separator: "\n") {
+    let components = line.split(
+      separator: ";", omittingEmptySubsequences: false)
+
+    if components[3] != "0" {
+      result.insert(UInt32(components[0], radix: 16)!)
+    }
+  }
+
+  return result
+}
+
+// Emits a three-stage table from every scalar to its case folding data:
+//
+// - The low 8 bits are the index of the distance from the scalar to its simple
+//   case folding in `_swift_stdlib_case_folding_distances`.
+// - The next 7 bits are one more than the index of the scalar's full case
+//   folding in `_swift_stdlib_full_case_folding_data`, or zero if its full
+//   case folding is its simple case folding.
+// - The top bit is set when the scalar or its full case folding takes part in
+//   canonical normalization, so that comparing case foldings scalar by scalar
+//   might not respect canonical equivalence.
+func emitCaseFolding(
+  simple: [UInt32: UInt32],
+  full: [UInt32: [UInt32]],
+  normalizationSensitive: Set<UInt32>,
+  into result: inout String
+) {
+  let distances = [0] + Set(
+    simple.map { Int32($0.value) - Int32($0.key) }
+  ).sorted()
+  precondition(distances.count <= 1 << 8, "Too many case folding distances")
+
+  var fullData: [UInt32] = []
+  var fullIndices: [UInt32: Int] = [:]
+  for (scalar, mapping) in full.sorted(by: { $0.key < $1.key }) {
+    fullIndices[scalar] = fullData.count / maxFullFoldingLength
+    fullData += mapping
+    fullData += repeatElement(0, count: maxFullFoldingLength - mapping.count)
+  }
+  precondition(full.count < 1 << 7, "Too many full case foldings")
+
+  var scalarValues = [UInt16](repeating: 0, count: 0x110000)
+  for scalar in 0 ..< UInt32(0x110000) {
+    var value: UInt16 = 0
+
+    if let folded = simple[scalar] {
+      let distance = Int32(folded) - Int32(scalar)
+      value |= UInt16(distances.firstIndex(of: distance)!)
+    }
+
+    if let index = fullIndices[scalar] {
+      value |= UInt16(index + 1) << 8
+    }
+
+    let folding = full[scalar] ?? [simple[scalar] ?? scalar]
+    if normalizationSensitive.contains(scalar)
+        || folding.contains(where: normalizationSensitive.contains) {
+      value |= 1 << 15
+    }
+
+    scalarValues[Int(scalar)] = value
+  }
+
+  let table = ThreeStageTable(scalarValues)
+  result += """
+  #define CASE_FOLDING_TRIE_BLOCK_BITS \(table.blockBits)
+  #define CASE_FOLDING_TRIE_VALUE_BITS \(table.valueBits)
+  #define CASE_FOLDING_MAX_LENGTH \(maxFullFoldingLength)
+
+
+  """
+
+  emitCollection(
+    distances,
+    name: "_swift_stdlib_case_folding_distances",
+    type: "int32_t",
+    into: &result
+  ) {
+    "\($0)"
+  }
+  emitCollection(
+    fullData,
+    name: "_swift_stdlib_full_case_folding_data",
+    type: "uint32_t",
+    into: &result
+  ) {
+    "0x\(String($0, radix: 16, uppercase: true))"
+  }
+  emitThreeStageTable(
+    table,
+    name: "_swift_stdlib_case_folding",
+    valueType: "uint16_t",
+    into: &result
+  )
+}
+
+func generateCaseFolding(into result: inout String) {
+  let (simple, full) = getCaseFoldings(
+    from: readFile("Data/CaseFolding.txt"))
+  let normalizationSensitive = getNormalizationSensitiveScalars(
+    derivedNormalizationProps: readFile("Data/DerivedNormalizationProps.txt"),
+    unicodeData: readFile("Data/UnicodeData.txt"))
+
+  emitCaseFolding(
+    simple: simple,
+    full: full,
+    normalizationSensitive: normalizationSensitive,
+    into: &result)
+}
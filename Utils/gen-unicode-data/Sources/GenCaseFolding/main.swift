@@ -0,0 +1,29 @@
+//===----------------------------------------------------------------------===//
+//
+// This source file is part of the Swift.org open source project
+//
+// Copyright (c) 2025 Apple Inc. and the Swift project authors
+// Licensed under Apache License v2.0 with Runtime Library Exception
+//
+// See https://swift.org/LICENSE.txt for license information
+//
+//===----------------------------------------------------------------------===//
+
+import GenUtils
+
+// Reads CaseFolding.txt, DerivedNormalizationProps.txt, and UnicodeData.txt
+// from the UCD in Data/.
+func generateCaseFoldingData() {
+  var result = readFile("Input/CaseFoldingData.h")
+
+  generateCaseFolding(into: &result)
+
+  result += """
+  #endif // #ifndef CASE_FOLDING_DATA_H
+
+  """
+
+  write(result, to: "Output/Common/CaseFoldingData.h")
+}
+
+generateCaseFoldingData()
@@ -0,0 +1,233 @@
+//===----------------------------------------------------------------------===//
+//
+// This source file is part of the Swift.org open source project
+//
+// Copyright (c) 2025 Apple Inc. and the Swift project authors
+// Licensed under Apache License v2.0 with Runtime Library Exception
+//
+// See https://swift.org/LICENSE.txt for license information
+//
+//===----------------------------------------------------------------------===//
+
+import GenUtils
+
+// Every value of the Grapheme_Cluster_Break property, plus
+// Extended_Pictographic, as used by the grapheme breaking kernel in
+// _CUnicode. The raw values must match `GraphemeBreakClass` in
+// UnicodeGraphemeBreaking.c.
+enum GraphemeBreakClass: UInt8 {
+  case any = 0
+  case cr = 1
+  case lf = 2
+  case control = 3
+  case extend = 4
+  case zwj = 5
+  case regionalIndicator = 6
+  case prepend = 7
+  case spacingMark = 8
+  case l = 9
+  case v = 10
+  case t = 11
+  case lv = 12
+  case lvt = 13
+  case extendedPictographic = 14
+
+  init?(_ str: String) {
+    switch str {
+    case "CR": self = .cr
+    case "LF": self = .lf
+    case "Control": self = .control
+    case "Extend": self = .extend
+    case "ZWJ": self = .zwj
+    case "Regional_Indicator": self = .regionalIndicator
+    case "Prepend": self = .prepend
+    case "SpacingMark": self = .spacingMark
+    case "L": self = .l
+    case "V": self = .v
+    case "T": self = .t
+    case "LV": self = .lv
+    case "LVT": self = .lvt
+    case "Extended_Pictographic": self = .extendedPictographic
+    default: return nil
+    }
+  }
+}
+
+// Set on scalars whose breaks the kernel leaves to the standard library:
+// scalars that weren't assigned as of the data's Unicode version, whose
+// properties may differ in the standard library's, and viramas, which can
+// link Indic conjuncts (GB9c).
+let graphemeBreakDeferredBit: UInt8 = 0x10
+
+// Parses the scalar or scalar range in the first field of a UCD data line.
+func parseGraphemeBreakScalars(_ field: Substring) -> ClosedRange<UInt32> {
+  let filteredScalars = field.filter { !$0.isWhitespace }
+
+  if filteredScalars.contains(".") {
+    let range = filteredScalars.split(separator: ".")
+
+    return UInt32(range[0], radix: 16)! ... UInt32(range[1], radix: 16)!
+  } else {
+    let scalar = UInt32(filteredScalars, radix: 16)!
+
+    return scalar ... scalar
+  }
+}
+
+// Parses the Unicode version, e.g. "13.0", from the first line of a UCD file
+// such as "# GraphemeBreakProperty-13.0.0.txt".
+func getUnicodeVersion(from data: String) -> [Int] {
+  let firstLine = data.prefix { $0 != "\n" }
+  let version = firstLine
+    .drop { $0 != "-" }
+    .dropFirst()
+    .prefix { $0.isNumber || $0 == "." }
+  return version.split(separator: ".").prefix(2).map { Int($0)! }
+}
+
+// Sets the grapheme break class of every scalar listed in `data`, which is
+// formatted like GraphemeBreakProperty.txt:
+//
+//     0600..0605    ; Prepend # Cf   [6] ARABIC NUMBER SIGN..ARABIC NUMBER MARK ABOVE
+//     200D          ; ZWJ # Cf       ZERO WIDTH JOINER
+//
+// Lines for other properties, such as those in emoji-data.txt, are skipped.
+func readGraphemeBreakClasses(
+  from data: String,
+  into classes: inout [GraphemeBreakClass]
+) {
+  for line in data.split(separator: "\n") {
+    guard !line.hasPrefix("#") else {
+      continue
+    }
+
+    let info = line.split(separator: "#")
+    let components = info[0].split(separator: ";")
+    guard components.count == 2,
+          let gbc = GraphemeBreakClass(
+            components[1].filter { !$0.isWhitespace })
+    else {
+      continue
+    }
+
+    for scalar in parseGraphemeBreakScalars(components[0]) {
+      classes[Int(scalar)] = gbc
+    }
+  }
+}
+
+// Returns the scalars that were assigned as of `version`, according to
+// DerivedAge.txt:
+//
+//     0000..001F    ; 1.1 #  [32] <control-0000>..<control-001F>
+func getAssignedScalars(
+  from derivedAge: String,
+  asOf version: [Int]
+) -> [Bool] {
+  var result = [Bool](repeating: false, count: 0x110000)
+
+  for line in derivedAge.split(separator: "\n") {
+    guard !line.hasPrefix("#") else {
+      continue
+    }
+
+    let info = line.split(separator: "#")
+    let components = info[0].split(separator: ";")
+    guard components.count == 2 else {
+      continue
+    }
+
+    let age = components[1].filter { !$0.isWhitespace }
+      .split(separator: ".").map { Int($0)! }
+    guard age.lexicographicallyPrecedes(version) || age == version else {
+      continue
+    }
+
+    for scalar in parseGraphemeBreakScalars(components[0]) {
+      result[Int(scalar)] = true
+    }
+  }
+
+  return result
+}
+
+// Returns the scalars with the Virama canonical combining class (9).
+func getViramas(from unicodeData: String) -> Set<UInt32> {
+  var result: Set<UInt32> = []
+
+  for line in unicodeData.split(separator: "\n") {
+    let components = line.split(
+      separator: ";", omittingEmptySubsequences: false)
+
+    if components[3] == "9" {
+      result.insert(UInt32(components[0], radix: 16)!)
+    }
+  }
+
+  return result
+}
+
+// Emits a three-stage table from every scalar to its grapheme break class in
+// the low 4 bits, with `graphemeBreakDeferredBit` set on the scalars that the
+// kernel defers on.
+func emitGraphemeBreakTable(
+  classes: [GraphemeBreakClass],
+  assigned: [Bool],
+  viramas: Set<UInt32>,
+  into result: inout String
+) {
+  var scalarValues = [UInt8](repeating: 0, count: 0x110000)
+  for scalar in 0 ..< 0x110000 {
+    var value = classes[scalar].rawValue
+    if !assigned[scalar] || viramas.contains(UInt32(scalar)) {
+      value |= graphemeBreakDeferredBit
+    }
+    scalarValues[scalar] = value
+  }
+
+  let table = ThreeStageTable(scalarValues)
+  result += """
+  #define GRAPHEME_BREAK_TRIE_BLOCK_BITS \(table.blockBits)
+  #define GRAPHEME_BREAK_TRIE_VALUE_BITS \(table.valueBits)
+
+
+  """
+
+  emitThreeStageTable(
+    table,
+    name: "_swift_stdlib_grapheme_break",
+    valueType: "uint8_t",
+    into: &result
+  )
+}
+
+// Generates the grapheme break table for _CUnicode from
+// GraphemeBreakProperty.txt and emoji-data.txt, along with DerivedAge.txt and
+// UnicodeData.txt for the scalars the kernel defers on.
+func generateGraphemeBreakTable() {
+  var result = readFile("Input/GraphemeBreakData.h")
+
+  let graphemeBreakProperty = readFile("Data/GraphemeBreakProperty.txt")
+  var classes = [GraphemeBreakClass](repeating: .any, count: 0x110000)
+  readGraphemeBreakClasses(from: graphemeBreakProperty, into: &classes)
+  readGraphemeBreakClasses(
+    from: readFile("Data/emoji-data.txt"), into: &classes)
+
+  let assigned = getAssignedScalars(
+    from: readFile("Data/DerivedAge.txt"),
+    asOf: getUnicodeVersion(from: graphemeBreakProperty))
+  let viramas = getViramas(from: readFile("Data/UnicodeData.txt"))
+
+  emitGraphemeBreakTable(
+    classes: classes,
+    assigned: assigned,
+    viramas: viramas,
+    into: &result)
+
+  result += """
+  #endif // #ifndef GRAPHEME_BREAK_DATA_H
+
+  """
+
+  write(result, to: "Output/Common/GraphemeBreakData.h")
+}
@@ -206,3 +206,4 @@ func generateGraphemeBreakProperty() {
 }
 
 generateGraphemeBreakProperty()
+generateGraphemeBreakTable()
@@ -0,0 +1,201 @@
+//===----------------------------------------------------------------------===//
+//
+// This source file is part of the Swift.org open source project
+//
+// Copyright (c) 2025 Apple Inc. and the Swift project authors
+// Licensed under Apache License v2.0 with Runtime Library Exception
+//
+// See https://swift.org/LICENSE.txt for license information
+//
+//===----------------------------------------------------------------------===//
+
+import GenUtils
+
+// The long names of every script, in the order of the cases of
+// `Unicode.Script` in _RegexParser. A script's value in the generated tables
+// is its position in this list, so this must be kept in sync with that enum.
+let scriptNames: [String] = [
+  "Adlam", "Ahom", "Anatolian_Hieroglyphs", "Arabic", "Armenian", "Avestan",
+  "Balinese", "Bamum", "Bassa_Vah", "Batak", "Bengali", "Bhaiksuki",
+  "Bopomofo", "Brahmi", "Braille", "Buginese", "Buhid", "Canadian_Aboriginal",
+  "Carian", "Caucasian_Albanian", "Chakma", "Cham", "Cherokee", "Chorasmian",
+  "Common", "Coptic", "Cuneiform", "Cypriot", "Cyrillic", "Cypro_Minoan",
+  "Deseret", "Devanagari", "Dives_Akuru", "Dogra", "Duployan",
+  "Egyptian_Hieroglyphs", "Elbasan", "Elymaic", "Ethiopic", "Garay",
+  "Georgian", "Glagolitic", "Gothic", "Grantha", "Greek", "Gujarati",
+  "Gunjala_Gondi", "Gurmukhi", "Gurung_Khema", "Han", "Hangul",
+  "Hanifi_Rohingya", "Hanunoo", "Hatran", "Hebrew", "Hiragana",
+  "Imperial_Aramaic", "Inherited", "Inscriptional_Pahlavi",
+  "Inscriptional_Parthian", "Javanese", "Kaithi", "Kannada", "Katakana",
+  "Katakana_Or_Hiragana", "Kawi", "Kayah_Li", "Kharoshthi",
+  "Khitan_Small_Script", "Khmer", "Khojki", "Khudawadi", "Lao", "Latin",
+  "Lepcha", "Limbu", "Linear_A", "Linear_B", "Lisu", "Lycian", "Lydian",
+  "Kirat_Rai", "Mahajani", "Makasar", "Malayalam", "Mandaic", "Manichaean",
+  "Marchen", "Masaram_Gondi", "Medefaidrin", "Meetei_Mayek", "Mende_Kikakui",
+  "Meroitic_Cursive", "Meroitic_Hieroglyphs", "Miao", "Modi", "Mongolian",
+  "Mro", "Multani", "Myanmar", "Nabataean", "Nag_Mundari", "Nandinagari",
+  "Newa", "New_Tai_Lue", "Nko", "Nushu", "Nyiakeng_Puachue_Hmong", "Ogham",
+  "Ol_Chiki", "Old_Hungarian", "Old_Italic", "Old_North_Arabian", "Old_Permic",
+  "Old_Persian", "Old_Sogdian", "Old_South_Arabian", "Old_Turkic",
+  "Old_Uyghur", "Ol_Onal", "Oriya", "Osage", "Osmanya", "Pahawh_Hmong",
+  "Palmyrene", "Pau_Cin_Hau", "Phags_Pa", "Phoenician", "Psalter_Pahlavi",
+  "Rejang", "Runic", "Samaritan", "Saurashtra", "Sharada", "Shavian",
+  "Siddham", "SignWriting", "Sinhala", "Sogdian", "Sora_Sompeng", "Soyombo",
+  "Sundanese", "Sunuwar", "Syloti_Nagri", "Syriac", "Tagalog", "Tagbanwa",
+  "Tai_Le", "Tai_Tham", "Tai_Viet", "Takri", "Tamil", "Tangsa", "Tangut",
+  "Telugu", "Thaana", "Thai", "Tibetan", "Tifinagh", "Tirhuta", "Todhri",
+  "Toto", "Tulu_Tigalari", "Ugaritic", "Unknown", "Vai", "Vithkuqi", "Wancho",
+  "Warang_Citi", "Yezidi", "Yi", "Zanabazar_Square",
+]
+
+// Parses the scalar or scalar range in the first field of a UCD data line.
+func parseScalars(_ field: Substring) -> ClosedRange<UInt32> {
+  let filteredScalars = field.filter { !$0.isWhitespace }
+
+  // If we have . appear, it means we have a legitimate range. Otherwise,
+  // it's a singular scalar.
+  if filteredScalars.contains(".") {
+    let range = filteredScalars.split(separator: ".")
+
+    return UInt32(range[0], radix: 16)! ... UInt32(range[1], radix: 16)!
+  } else {
+    let scalar = UInt32(filteredScalars, radix: 16)!
+
+    return scalar ... scalar
+  }
+}
+
+// Returns the data lines of a UCD file split into their fields, without
+// comments.
+func dataLines(_ data: String) -> [[Substring]] {
+  data.split(separator: "\n").compactMap { line -> [Substring]? in
+    guard !line.hasPrefix("#") else {
+      return nil
+    }
+    let info = line.split(separator: "#", omittingEmptySubsequences: false)
+    let components = info[0].split(separator: ";")
+    guard components.count >= 2 else {
+      return nil
+    }
+    return components.map { component in
+      let start = component.drop(while: \.isWhitespace)
+      return start.dropLast(
+        start.reversed().prefix(while: \.isWhitespace).count)
+    }
+  }
+}
+
+// Maps both the short and long names of each script to its value.
+func getScriptValues(from aliases: String) -> [Substring: UInt8] {
+  var result: [Substring: UInt8] = [:]
+  for (value, name) in scriptNames.enumerated() {
+    result[Substring(name)] = UInt8(value)
+  }
+  for components in dataLines(aliases) where components[0] == "sc" {
+    guard let value = result[components[2]] else {
+      fatalError("Unknown script \(components[2]), update scriptNames")
+    }
+    result[components[1]] = value
+  }
+  return result
+}
+
+// Returns the script of every scalar. Scalars that aren't listed are in the
+// Unknown script.
+func getScripts(
+  from data: String,
+  values: [Substring: UInt8]
+) -> [UInt8] {
+  let unknown = values["Unknown"]!
+  var result = [UInt8](repeating: unknown, count: 0x110000)
+  for components in dataLines(data) {
+    let script = values[components[1]]!
+    for scalar in parseScalars(components[0]) {
+      result[Int(scalar)] = script
+    }
+  }
+  return result
+}
+
+// Returns the script extensions of every scalar that has some other than its
+// script, with each list of scripts sorted by value.
+func getScriptExtensions(
+  from data: String,
+  values: [Substring: UInt8]
+) -> [(ClosedRange<UInt32>, [UInt8])] {
+  dataLines(data).map { components -> (ClosedRange<UInt32>, [UInt8]) in
+    let scripts = components[1]
+    let extensions = scripts.split(separator: " ").map { values[$0]! }
+    return (parseScalars(components[0]), extensions.sorted())
+  }
+}
+
+func emitScripts(_ scripts: [UInt8], into result: inout String) {
+  let table = ThreeStageTable(scripts)
+  result += """
+  #define SCRIPT_TRIE_BLOCK_BITS \(table.blockBits)
+  #define SCRIPT_TRIE_VALUE_BITS \(table.valueBits)
+
+
+  """
+  emitThreeStageTable(
+    table,
+    name: "_swift_stdlib_scripts",
+    valueType: "uint8_t",
+    into: &result
+  )
+}
+
+// Emits each distinct list of script extensions into one array, and a table
+// from every scalar to its list: the list's count in the top 5 bits and its
+// offset in the low 11. Scalars without script extensions map to zero.
+func emitScriptExtensions(
+  _ extensions: [(ClosedRange<UInt32>, [UInt8])],
+  into result: inout String
+) {
+  var data: [UInt8] = []
+  var offsets: [[UInt8]: Int] = [:]
+  var scalarValues = [UInt16](repeating: 0, count: 0x110000)
+
+  for (scalars, scripts) in extensions {
+    let offset: Int
+    if let existing = offsets[scripts] {
+      offset = existing
+    } else {
+      offset = data.count
+      offsets[scripts] = offset
+      data += scripts
+    }
+    precondition(offset < 1 << 11 && scripts.count < 1 << 5)
+
+    for scalar in scalars {
+      scalarValues[Int(scalar)] = UInt16(scripts.count) << 11 | UInt16(offset)
+    }
+  }
+
+  emitCollection(
+    data,
+    name: "_swift_stdlib_script_extensions_data",
+    type: "uint8_t",
+    into: &result
+  ) {
+    "0x\(String($0, radix: 16, uppercase: true))"
+  }
+  emitThreeStageTable(
+    ThreeStageTable(scalarValues),
+    name: "_swift_stdlib_script_extensions",
+    valueType: "uint16_t",
+    into: &result
+  )
+}
+
+func generateScripts(into result: inout String) {
+  let values = getScriptValues(
+    from: readFile("Data/PropertyValueAliases.txt"))
+  let scripts = getScripts(from: readFile("Data/Scripts.txt"), values: values)
+  let extensions = getScriptExtensions(
+    from: readFile("Data/ScriptExtensions.txt"), values: values)
+
+  emitScripts(scripts, into: &result)
+  emitScriptExtensions(extensions, into: &result)
+}
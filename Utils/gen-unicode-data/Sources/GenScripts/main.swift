@@ -0,0 +1,29 @@
+//===----------------------------------------------------------------------===//
+//
+// This source file is part of the Swift.org open source project
+//
+// Copyright (c) 2025 Apple Inc. and the Swift project authors
+// Licensed under Apache License v2.0 with Runtime Library Exception
+//
+// See https://swift.org/LICENSE.txt for license information
+//
+//===----------------------------------------------------------------------===//
+
+import GenUtils
+
+// Reads Scripts.txt, ScriptExtensions.txt, and PropertyValueAliases.txt from
+// the UCD in Data/.
+func generateScriptData() {
+  var result = readFile("Input/ScriptData.h")
+
+  generateScripts(into: &result)
+
+  result += """
+  #endif // #ifndef SCRIPT_DATA_H
+
+  """
+
+  write(result, to: "Output/Common/ScriptData.h")
+}
+
+generateScriptData()
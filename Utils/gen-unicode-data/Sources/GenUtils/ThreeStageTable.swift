@@ -0,0 +1,105 @@
+//===----------------------------------------------------------------------===//
+//
+// This source file is part of the Swift.org open source project
+//
+// Copyright (c) 2025 Apple Inc. and the Swift project authors
+// Licensed under Apache License v2.0 with Runtime Library Exception
+//
+// See https://swift.org/LICENSE.txt for license information
+//
+//===----------------------------------------------------------------------===//
+
+// A lookup table from every scalar to a value, split into three stages so
+// that a lookup is a constant three loads:
+//
+//     let block = index[scalar >> (valueBits + blockBits)]
+//     let values = blocks[block << blockBits | (scalar >> valueBits) & blockMask]
+//     let value = self.values[values << valueBits | scalar & valueMask]
+//
+// Identical runs of values, and identical runs of block indices, are only
+// stored once, which keeps the table small for properties that change value
+// rarely.
+public struct ThreeStageTable<Value: FixedWidthInteger> {
+  public let blockBits: Int
+  public let valueBits: Int
+
+  public var index: [UInt8] = []
+  public var blocks: [UInt16] = []
+  public var values: [Value] = []
+
+  public init(
+    _ scalarValues: [Value],
+    blockBits: Int = 5,
+    valueBits: Int = 4
+  ) {
+    precondition(scalarValues.count == 0x110000)
+    self.blockBits = blockBits
+    self.valueBits = valueBits
+
+    var valueBlocks: [ArraySlice<Value>: UInt16] = [:]
+    var valueBlockIndices: [UInt16] = []
+    for start in stride(from: 0, to: scalarValues.count, by: 1 << valueBits) {
+      let block = scalarValues[start ..< start + (1 << valueBits)]
+      if let existing = valueBlocks[block] {
+        valueBlockIndices.append(existing)
+        continue
+      }
+      precondition(valueBlocks.count <= UInt16.max, "Too many value blocks")
+      let new = UInt16(valueBlocks.count)
+      valueBlocks[block] = new
+      valueBlockIndices.append(new)
+      values += block
+    }
+
+    var indexBlocks: [ArraySlice<UInt16>: UInt8] = [:]
+    for start in stride(
+      from: 0, to: valueBlockIndices.count, by: 1 << blockBits
+    ) {
+      let block = valueBlockIndices[start ..< start + (1 << blockBits)]
+      if let existing = indexBlocks[block] {
+        index.append(existing)
+        continue
+      }
+      precondition(indexBlocks.count <= UInt8.max, "Too many index blocks")
+      let new = UInt8(indexBlocks.count)
+      indexBlocks[block] = new
+      index.append(new)
+      blocks += block
+    }
+  }
+
+  public subscript(_ scalar: UInt32) -> Value {
+    let scalar = Int(scalar)
+    let block = Int(index[scalar >> (valueBits + blockBits)])
+    let blockMask = (1 << blockBits) - 1
+    let valueMask = (1 << valueBits) - 1
+    let valueBlock = Int(
+      blocks[block << blockBits | (scalar >> valueBits) & blockMask])
+    return values[valueBlock << valueBits | scalar & valueMask]
+  }
+}
+
+// Emits the three arrays of a three-stage table, named with the given prefix
+// and the suffixes `_index`, `_blocks`, and `_values`.
+public func emitThreeStageTable<Value>(
+  _ table: ThreeStageTable<Value>,
+  name: String,
+  valueType: String,
+  into result: inout String
+) {
+  emitCollection(
+    table.index, name: "\(name)_index", type: "uint8_t", into: &result
+  ) {
+    "0x\(String($0, radix: 16, uppercase: true))"
+  }
+  emitCollection(
+    table.blocks, name: "\(name)_blocks", type: "uint16_t", into: &result
+  ) {
+    "0x\(String($0, radix: 16, uppercase: true))"
+  }
+  emitCollection(
+    table.values, name: "\(name)_values", type: valueType, into: &result
+  ) {
+    "0x\(String($0, radix: 16, uppercase: true))"
+  }
+}